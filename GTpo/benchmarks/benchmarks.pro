@@ -6,13 +6,14 @@ QT          += core
 DEPENDPATH  += ../src
 INCLUDEPATH += ../src
 
-include (../common.pri)
+include (../gtpo-common.pri)
 
 # On win32, set Google Benchmarks source and library directories manually
 win32-msvc*:GBENCHMARK_DIR =  c:/projects/DELIA/libs/benchmark
 win32-msvc*:INCLUDEPATH     += $$GBENCHMARK_DIR/include
 
-SOURCES	+=  gtpoBenchmarks.cpp
+SOURCES	+=  gtpoBenchmarks.cpp                      \
+            ../src/pugixml/src/pugixml.cpp
 HEADERS	+=  
 
 CONFIG(debug, debug|release) {
@@ -22,3 +23,11 @@ CONFIG(debug, debug|release) {
     win32-g++*:     LIBS	+= -L../build/ -lgtpod
 }
 
+# Benchmark results are only meaningful in release, JSON report is written to gtpoBenchmarks.json (see main())
+CONFIG(release, debug|release) {
+    linux-g++*:     LIBS	+= -L../build/ -lbenchmark -lprotobuf
+    win32-msvc*:    PRE_TARGETDEPS +=  ../build/gtpo.lib
+    win32-msvc*:    LIBS	+= ../build/gtpo.lib $$GBENCHMARK_DIR/src/Release/benchmark.lib Shlwapi.lib $$PROTOCOL_BUFFER_LIBDIR_RELEASE/libprotobuf.lib
+    win32-g++*:     LIBS	+= -L../build/ -lgtpo
+}
+
@@ -27,38 +27,656 @@
 
 // STD headers
 #include <list>
+#include <vector>
+#include <array>
+#include <cmath>
 #include <memory>
 #include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <limits>
+#include <algorithm>
 
 // GTpo headers
 #include <GTpo>
 #include <GTpoStd>
 #include <gtpoProtoSerializer.h>
+#include <gtpoGmlSerializer.h>
 #include <gtpoProgressNotifier.h>
 
 // Google Benchmark
 #include <benchmark/benchmark.h>
 
-static void BM_GraphCreationWithBehaviours(benchmark::State& state) {
+static void BM_GraphContainsNode(benchmark::State& state) {
     stpo::Graph g;
+    std::vector< stpo::Graph::WeakNode > nodes;
+    for ( int n = 0; n < state.range(0); ++n )
+        nodes.push_back( g.createNode() );
+    std::size_t n = 0;
     while ( state.KeepRunning( ) ) {
-        auto n1 = g.createNode();
-        auto n2 = g.createNode();
-        auto e = g.createEdge( n1, n2 );
+        benchmark::DoNotOptimize( g.contains( nodes[ n ] ) );
+        n = ( n + 7919 ) % nodes.size();
     }
 }
 
-static void BM_GraphCreationWithoutBehaviours(benchmark::State& state) {
+static void BM_GraphContainsNodePtr(benchmark::State& state) {
     stpo::Graph g;
+    std::vector< const stpo::Node* > nodes;
+    for ( int n = 0; n < state.range(0); ++n )
+        nodes.push_back( g.createNode().lock().get() );
+    std::size_t n = 0;
     while ( state.KeepRunning( ) ) {
-        auto n1 = g.createNode();
-        auto n2 = g.createNode();
-        auto e = g.createEdge( n1, n2 );
+        benchmark::DoNotOptimize( g.contains( nodes[ n ] ) );
+        n = ( n + 7919 ) % nodes.size();
     }
 }
 
-BENCHMARK(BM_GraphCreationWithBehaviours);
-BENCHMARK(BM_GraphCreationWithoutBehaviours);
+static void BM_GraphContainsEdge(benchmark::State& state) {
+    stpo::Graph g;
+    std::vector< stpo::Graph::WeakEdge > edges;
+    auto source = g.createNode();
+    for ( int e = 0; e < state.range(0); ++e )
+        edges.push_back( g.createEdge( source, g.createNode() ) );
+    std::size_t e = 0;
+    while ( state.KeepRunning( ) ) {
+        benchmark::DoNotOptimize( g.contains( edges[ e ] ) );
+        e = ( e + 7919 ) % edges.size();
+    }
+}
+
+static void BM_GraphIsRootNode(benchmark::State& state) {
+    stpo::Graph g;
+    std::vector< stpo::Graph::WeakNode > nodes;
+    for ( int n = 0; n < state.range(0); ++n )
+        nodes.push_back( g.createNode() );
+    std::size_t n = 0;
+    while ( state.KeepRunning( ) ) {
+        benchmark::DoNotOptimize( g.isRootNode( nodes[ n ] ) );
+        n = ( n + 7919 ) % nodes.size();
+    }
+}
+
+static void BM_GroupHasNode(benchmark::State& state) {
+    stpo::Graph g;
+    auto group = g.createGroup().lock();
+    std::vector< stpo::Graph::WeakNode > nodes;
+    for ( int n = 0; n < state.range(0); ++n ) {
+        nodes.push_back( g.createNode() );
+        group->insertNode( nodes.back() );
+    }
+    std::size_t n = 0;
+    while ( state.KeepRunning( ) ) {
+        benchmark::DoNotOptimize( group->hasNode( nodes[ n ] ) );
+        n = ( n + 7919 ) % nodes.size();
+    }
+}
+
+static void BM_GraphHasEdge(benchmark::State& state) {
+    stpo::Graph g;
+    std::vector< stpo::Graph::WeakNode > nodes;
+    for ( int n = 0; n < state.range(0); ++n )
+        nodes.push_back( g.createNode() );
+    for ( std::size_t n = 1; n < nodes.size(); ++n )
+        g.createEdge( nodes[ n - 1 ], nodes[ n ] );
+    std::size_t n = 1;
+    while ( state.KeepRunning( ) ) {
+        benchmark::DoNotOptimize( g.hasEdge( nodes[ n - 1 ], nodes[ n ] ) );
+        n = 1 + ( n + 7919 ) % ( nodes.size() - 1 );
+    }
+}
+
+struct UnorderedConfig : public gtpo::GraphConfig,
+                         public gtpo::StdContainerAccessors,
+                         public gtpo::PropertiesAccessors< gtpo::GenNode<UnorderedConfig>,
+                                                           gtpo::GenEdge<UnorderedConfig>,
+                                                           gtpo::GenGroup<UnorderedConfig> >
+{
+    using Removal   = gtpo::UnorderedRemoval;
+    using Node      = gtpo::GenNode<UnorderedConfig>;
+    using Edge      = gtpo::GenEdge<UnorderedConfig>;
+    using Group     = gtpo::GenGroup<UnorderedConfig>;
+};
+
+//! gtpo::UnorderedRemoval with default group adjacent edges behaviours.
+struct UnorderedGroupsConfig : public gtpo::GraphConfig,
+                               public gtpo::StdContainerAccessors,
+                               public gtpo::PropertiesAccessors< gtpo::GenNode<UnorderedGroupsConfig>,
+                                                                 gtpo::GenEdge<UnorderedGroupsConfig>,
+                                                                 gtpo::GenGroup<UnorderedGroupsConfig> >
+{
+    using Removal           = gtpo::UnorderedRemoval;
+    using GraphBehaviours   = std::tuple< gtpo::GraphGroupAjacentEdgesBehaviour< UnorderedGroupsConfig > >;
+    using GroupBehaviours   = std::tuple< gtpo::GroupAdjacentEdgesBehaviour< UnorderedGroupsConfig > >;
+    using Node              = gtpo::GenNode<UnorderedGroupsConfig>;
+    using Edge              = gtpo::GenEdge<UnorderedGroupsConfig>;
+    using Group             = gtpo::GenGroup<UnorderedGroupsConfig>;
+};
+
+struct PooledConfig : public gtpo::GraphConfig,
+                      public gtpo::StdContainerAccessors,
+                      public gtpo::PropertiesAccessors< gtpo::GenNode<PooledConfig>,
+                                                        gtpo::GenEdge<PooledConfig>,
+                                                        gtpo::GenGroup<PooledConfig> >
+{
+    using Allocation    = gtpo::PoolAllocation;
+    using Node          = gtpo::GenNode<PooledConfig>;
+    using Edge          = gtpo::GenEdge<PooledConfig>;
+    using Group         = gtpo::GenGroup<PooledConfig>;
+};
+
+struct InlineAdjacencyConfig : public gtpo::GraphConfig,
+                               public gtpo::StdContainerAccessors,
+                               public gtpo::PropertiesAccessors< gtpo::GenNode<InlineAdjacencyConfig>,
+                                                                 gtpo::GenEdge<InlineAdjacencyConfig>,
+                                                                 gtpo::GenGroup<InlineAdjacencyConfig> >
+{
+    using Adjacency     = gtpo::InlineAdjacency<4>;
+    using AdjacentNodes = gtpo::DerivedAdjacentNodes;
+    using Node          = gtpo::GenNode<InlineAdjacencyConfig>;
+    using Edge          = gtpo::GenEdge<InlineAdjacencyConfig>;
+    using Group         = gtpo::GenGroup<InlineAdjacencyConfig>;
+};
+
+//! GraphConfig default static behaviours tuples are empty.
+struct BehaviourFreeConfig : public gtpo::GraphConfig,
+                             public gtpo::StdContainerAccessors,
+                             public gtpo::PropertiesAccessors< gtpo::GenNode<BehaviourFreeConfig>,
+                                                               gtpo::GenEdge<BehaviourFreeConfig>,
+                                                               gtpo::GenGroup<BehaviourFreeConfig> >
+{
+    using Node          = gtpo::GenNode<BehaviourFreeConfig>;
+    using Edge          = gtpo::GenEdge<BehaviourFreeConfig>;
+    using Group         = gtpo::GenGroup<BehaviourFreeConfig>;
+};
+
+template < class Graph >
+static auto createChainGraph( Graph& g, int nodeCount ) -> std::vector< typename Graph::WeakNode > {
+    std::vector< typename Graph::WeakNode > nodes;
+    for ( int n = 0; n < nodeCount; ++n )
+        nodes.push_back( g.createNode() );
+    for ( std::size_t n = 1; n < nodes.size(); ++n )
+        g.createEdge( nodes[ n - 1 ], nodes[ n ] );
+    return nodes;
+}
+
+/* Graph creation, removal and clear() *///-----------------------------------
+// Benchmarks templated on graph type are run with stpo::Graph and gtpo::GenGraph<>
+// (both with default static behaviours, including gtpo::GroupAdjacentEdgesBehaviour),
+// BM_GraphInsertNodes compare with a behaviour-free graph to measure notification overhead.
+
+template < class Graph >
+static void BM_GraphCreation(benchmark::State& state) {
+    while ( state.KeepRunning( ) ) {
+        Graph g;
+        benchmark::DoNotOptimize( createChainGraph( g, state.range(0) ).size() );
+        state.PauseTiming();
+        g.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) * 2 );   // Nodes and edges
+}
+
+template < class Graph >
+static void BM_GraphInsertNodes(benchmark::State& state) {
+    while ( state.KeepRunning( ) ) {
+        Graph g;
+        for ( int n = 0; n < state.range(0); ++n )
+            benchmark::DoNotOptimize( g.createNode() );
+        state.PauseTiming();
+        g.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) );
+}
+
+template < class Graph >
+static void BM_GraphRemoveNodes(benchmark::State& state) {
+    while ( state.KeepRunning( ) ) {
+        state.PauseTiming();
+        Graph g;
+        auto nodes = createChainGraph( g, state.range(0) );
+        state.ResumeTiming();
+        for ( auto node = nodes.rbegin(); node != nodes.rend(); ++node )  // Ordered removal is O(n), sizes are limited to 10^5
+            g.removeNode( *node );
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) );
+}
+
+template < class Graph >
+static void BM_GraphRemoveEdges(benchmark::State& state) {
+    while ( state.KeepRunning( ) ) {
+        state.PauseTiming();
+        Graph g;
+        createChainGraph( g, state.range(0) );
+        std::vector< typename Graph::WeakEdge > edges( g.getEdges().cbegin(), g.getEdges().cend() );
+        state.ResumeTiming();
+        for ( auto edge = edges.rbegin(); edge != edges.rend(); ++edge )
+            g.removeEdge( *edge );
+        state.PauseTiming();
+        g.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) );
+}
+
+template < class Graph >
+static void BM_GraphClear(benchmark::State& state) {
+    while ( state.KeepRunning( ) ) {
+        state.PauseTiming();
+        Graph g;
+        createChainGraph( g, state.range(0) );
+        state.ResumeTiming();
+        g.clear();
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) * 2 );
+}
+//-----------------------------------------------------------------------------
+
+/* Graph queries *///-----------------------------------------------------------
+template < class Graph >
+static void BM_GraphFindEdge(benchmark::State& state) {
+    Graph g;
+    auto nodes = createChainGraph( g, state.range(0) );
+    std::size_t n = 1;
+    while ( state.KeepRunning( ) ) {
+        benchmark::DoNotOptimize( g.findEdge( nodes[ n - 1 ], nodes[ n ] ) );
+        n = 1 + ( n + 7919 ) % ( nodes.size() - 1 );
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Groups *///------------------------------------------------------------------
+template < class Graph >
+static void BM_GroupInsertRemoveNodes(benchmark::State& state) {
+    Graph g;
+    auto nodes = createChainGraph( g, state.range(0) );
+    auto group = g.createGroup().lock();
+    while ( state.KeepRunning( ) ) {
+        for ( auto& node : nodes )
+            group->insertNode( node );
+        for ( auto& node : nodes )
+            group->removeNode( node );
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) * 2 );
+}
+
+//! Same as BM_GroupInsertRemoveNodes, with nodes inserted at once with GenGroup::insertNodes().
+template < class Graph >
+static void BM_GroupInsertNodesBulk(benchmark::State& state) {
+    Graph g;
+    auto nodes = createChainGraph( g, state.range(0) );
+    auto group = g.createGroup().lock();
+    while ( state.KeepRunning( ) ) {
+        group->insertNodes( nodes );
+        for ( auto& node : nodes )
+            group->removeNode( node );
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) * 2 );
+}
+//-----------------------------------------------------------------------------
+
+/* Serialization *///-----------------------------------------------------------
+static void BM_ProtoSerializerRoundTrip(benchmark::State& state) {
+    gtpo::GenGraph<> go;
+    createChainGraph( go, state.range(0) );
+    gtpo::ProtoSerializer<> ps;
+    gtpo::ProgressNotifier progress;
+    while ( state.KeepRunning( ) ) {
+        std::stringstream stream;
+        ps.serializeOut( go, stream, progress );
+        gtpo::GenGraph<> gi;
+        ps.serializeIn( stream, gi, progress );
+        benchmark::DoNotOptimize( gi.getNodeCount() );
+        state.PauseTiming();
+        gi.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) * 2 );
+}
+
+//! GraphML is only supported for out serialization, graph is written to the working directory.
+static void BM_GmlSerializerOut(benchmark::State& state) {
+    gtpo::GenGraph<> g;
+    createChainGraph( g, state.range(0) );
+    while ( state.KeepRunning( ) ) {
+        gtpo::OutGmlSerializer<> gs{ "gtpoBenchmarks.graphml" };
+        gs.serializeOut( g );
+        gs.finishOut();
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) * 2 );
+}
+//-----------------------------------------------------------------------------
+
+static void BM_GraphTraverseWeak(benchmark::State& state) {
+    stpo::Graph g;
+    createChainGraph( g, state.range(0) );
+    while ( state.KeepRunning( ) ) {
+        std::size_t reached = 0;
+        for ( const auto& node : g.getNodes() )
+            for ( const auto& outNode : node->getOutNodes() )
+                reached += outNode.expired() ? 0 : 1;
+        benchmark::DoNotOptimize( reached );
+    }
+}
+
+static void BM_GraphTraverseCsr(benchmark::State& state) {
+    stpo::Graph g;
+    createChainGraph( g, state.range(0) );
+    gtpo::CsrSnapshot< stpo::Graph > csr{ g };
+    while ( state.KeepRunning( ) ) {
+        std::size_t reached = 0;
+        for ( std::uint32_t n = 0; n < csr.getNodeCount(); ++n )
+            for ( auto outNode : csr.getOutNodes( n ) )
+                reached += outNode;
+        benchmark::DoNotOptimize( reached );
+    }
+}
+
+static void BM_GraphCsrSnapshot(benchmark::State& state) {
+    stpo::Graph g;
+    createChainGraph( g, state.range(0) );
+    while ( state.KeepRunning( ) ) {
+        gtpo::CsrSnapshot< stpo::Graph > csr{ g };
+        benchmark::DoNotOptimize( csr.getEdgeCount() );
+    }
+}
+
+/*! Modify 100 nodes of a graph with range(0) nodes, then take an incremental snapshot (GenGraph::snapshot()).
+ *
+ * Previous snapshot is kept alive (like a snapshot still used by a worker thread), modified storage is thus copied.
+ */
+static void BM_GraphSnapshotIncremental(benchmark::State& state) {
+    stpo::Graph g;
+    auto nodes = createChainGraph( g, state.range(0) );
+    auto snapshot = g.snapshot();       // Enable change tracking
+    std::size_t n = 0;
+    double x = 0.;
+    while ( state.KeepRunning( ) ) {
+        for ( int m = 0; m < 100; ++m ) {
+            nodes[ n ].lock()->setX( ++x );
+            n = ( n + 7919 ) % nodes.size();
+        }
+        snapshot = g.snapshot();
+        benchmark::DoNotOptimize( snapshot.getVersion() );
+    }
+}
+
+static void BM_GeometryBoundingBoxAccessors(benchmark::State& state) {
+    stpo::Graph g;
+    createChainGraph( g, state.range(0) );
+    while ( state.KeepRunning( ) ) {
+        double left = std::numeric_limits< double >::max(), right = std::numeric_limits< double >::lowest();
+        for ( const auto& node : g.getNodes() ) {
+            left = std::min( left, stpo::Config::getX( node.get() ) );
+            right = std::max( right, stpo::Config::getX( node.get() ) + stpo::Config::getWidth( node.get() ) );
+        }
+        benchmark::DoNotOptimize( left + right );
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) );
+}
+
+static void BM_GeometryBoundingBoxStore(benchmark::State& state) {
+    stpo::Graph g;
+    createChainGraph( g, state.range(0) );
+    gtpo::GeometryStore< stpo::Graph > store{ g };
+    while ( state.KeepRunning( ) ) {
+        double left = 0., top = 0., right = 0., bottom = 0.;
+        store.getNodes().getBoundingBox( left, top, right, bottom );
+        benchmark::DoNotOptimize( left + right );
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) );
+}
+
+static void BM_GeometryStoreLoadCommit(benchmark::State& state) {
+    stpo::Graph g;
+    createChainGraph( g, state.range(0) );
+    gtpo::GeometryStore< stpo::Graph > store{ g };
+    while ( state.KeepRunning( ) ) {
+        store.load();
+        store.getNodes().translate( 1., 1. );
+        store.commit();
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) );
+}
+
+//! Shared random snapshot with 250k nodes and 1M edges (built once, graph creation is not measured).
+static auto getMillionEdgesSnapshot() -> const gtpo::CsrSnapshot< stpo::Graph >& {
+    static stpo::Graph g;
+    static std::unique_ptr< gtpo::CsrSnapshot< stpo::Graph > > csr;
+    if ( !csr ) {
+        const int nodeCount = 250000;
+        std::vector< stpo::Graph::WeakNode > nodes;
+        nodes.reserve( nodeCount );
+        stpo::Graph::BatchScope batch{ g };
+        for ( int n = 0; n < nodeCount; ++n )
+            nodes.push_back( g.createNode() );
+        std::mt19937 gen( 42 );
+        std::uniform_int_distribution< int > nodeDist( 0, nodeCount - 1 );
+        std::uniform_real_distribution< double > weightDist( 0.1, 10. );
+        for ( int e = 0; e < 4 * nodeCount; ++e ) {
+            auto edge = g.createEdge( nodes[ e % nodeCount ], nodes[ nodeDist( gen ) ] );
+            edge.lock()->setWeight( weightDist( gen ) );
+        }
+        csr.reset( new gtpo::CsrSnapshot< stpo::Graph >{ g } );
+    }
+    return *csr;
+}
+
+//! Viewport sized query (1920x1080) on nodes laid out in a 45x33 pitch grid (like QuickQanava 40k sample).
+static void BM_SpatialGridQuery(benchmark::State& state) {
+    gtpo::SpatialGrid< int > grid;
+    const int count = static_cast< int >( state.range(0) );
+    const int columns = static_cast< int >( std::sqrt( count ) );
+    for ( int n = 0; n < count; ++n )
+        grid.insert( n, ( n % columns ) * 45., ( n / columns ) * 33., 40., 30. );
+    while ( state.KeepRunning( ) ) {
+        int found = 0;
+        grid.query( 2000., 2000., 1920., 1080., [&found]( int ) { ++found; } );
+        benchmark::DoNotOptimize( found );
+    }
+}
+
+static void BM_SpatialLinearQuery(benchmark::State& state) {
+    const int count = static_cast< int >( state.range(0) );
+    const int columns = static_cast< int >( std::sqrt( count ) );
+    std::vector< std::array< double, 4 > > boxes;
+    for ( int n = 0; n < count; ++n )
+        boxes.push_back( { ( n % columns ) * 45., ( n / columns ) * 33., 40., 30. } );
+    while ( state.KeepRunning( ) ) {
+        int found = 0;
+        for ( const auto& b : boxes )
+            found += b[ 0 ] <= 3920. && 2000. <= b[ 0 ] + b[ 2 ] && b[ 1 ] <= 3080. && 2000. <= b[ 1 ] + b[ 3 ] ? 1 : 0;
+        benchmark::DoNotOptimize( found );
+    }
+}
+
+static void BM_AlgorithmBfs(benchmark::State& state) {
+    const auto& csr = getMillionEdgesSnapshot();
+    while ( state.KeepRunning( ) )
+        benchmark::DoNotOptimize( gtpo::algorithm::bfs( csr, 0, nullptr, static_cast< unsigned >( state.range(0) ) ).reachedCount );
+}
 
-BENCHMARK_MAIN()
+static void BM_AlgorithmTopologicalSort(benchmark::State& state) {
+    const auto& csr = getMillionEdgesSnapshot();
+    while ( state.KeepRunning( ) )
+        benchmark::DoNotOptimize( gtpo::algorithm::topologicalSort( csr ).order.size() );
+}
+
+static void BM_AlgorithmScc(benchmark::State& state) {
+    const auto& csr = getMillionEdgesSnapshot();
+    while ( state.KeepRunning( ) )
+        benchmark::DoNotOptimize( gtpo::algorithm::stronglyConnectedComponents( csr ).componentCount );
+}
+
+static void BM_AlgorithmShortestPaths(benchmark::State& state) {
+    const auto& csr = getMillionEdgesSnapshot();
+    const auto weights = gtpo::algorithm::getEdgeWeights( csr );
+    while ( state.KeepRunning( ) )
+        benchmark::DoNotOptimize( gtpo::algorithm::shortestPaths( csr, weights, 0 ).distances.size() );
+}
+
+template < class Graph >
+static void BM_AllocationCreate(benchmark::State& state) {
+    while ( state.KeepRunning( ) ) {
+        Graph g;
+        benchmark::DoNotOptimize( createChainGraph( g, state.range(0) ).size() );
+        state.PauseTiming();
+        g.clear();
+        state.ResumeTiming();
+    }
+}
+
+template < class Graph >
+static void BM_AllocationTraverse(benchmark::State& state) {
+    Graph g;
+    createChainGraph( g, state.range(0) );
+    while ( state.KeepRunning( ) ) {
+        std::size_t degrees = 0;
+        for ( const auto& node : g.getNodes() )
+            degrees += node->getOutDegree() + node->getInDegree();
+        benchmark::DoNotOptimize( degrees );
+    }
+}
+
+template < class Graph >
+static void BM_AllocationClear(benchmark::State& state) {
+    while ( state.KeepRunning( ) ) {
+        state.PauseTiming();
+        Graph g;
+        createChainGraph( g, state.range(0) );
+        state.ResumeTiming();
+        g.clear();
+    }
+}
+
+static void BM_GraphRemoveNodesBulk(benchmark::State& state) {
+    while ( state.KeepRunning( ) ) {
+        state.PauseTiming();
+        stpo::Graph g;
+        auto nodes = createChainGraph( g, state.range(0) );
+        state.ResumeTiming();
+        g.removeNodes( nodes );
+        state.PauseTiming();
+        g.clear();
+        state.ResumeTiming();
+    }
+}
+
+static void BM_GraphRemoveNodeUnordered(benchmark::State& state) {
+    using Graph = gtpo::GenGraph< UnorderedConfig >;
+    while ( state.KeepRunning( ) ) {
+        state.PauseTiming();
+        Graph g;
+        auto nodes = createChainGraph( g, state.range(0) );
+        state.ResumeTiming();
+        for ( auto& node : nodes )
+            g.removeNode( node );
+        state.PauseTiming();
+        g.clear();
+        state.ResumeTiming();
+    }
+}
+
+static void BM_GraphCreateChain(benchmark::State& state) {
+    while ( state.KeepRunning( ) ) {
+        stpo::Graph g;
+        createChainGraph( g, state.range(0) );
+        state.PauseTiming();
+        g.clear();
+        state.ResumeTiming();
+    }
+}
+
+static void BM_GraphCreateChainBatch(benchmark::State& state) {
+    while ( state.KeepRunning( ) ) {
+        stpo::Graph g;
+        {
+            stpo::Graph::BatchScope batch{ g };
+            createChainGraph( g, state.range(0) );
+        }
+        state.PauseTiming();
+        g.clear();
+        state.ResumeTiming();
+    }
+}
+
+// Parameterised sizes, from 10^3 to 10^6 primitives
+#define GTPO_BENCHMARK_SIZES    RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond)
+
+BENCHMARK_TEMPLATE(BM_GraphCreation, stpo::Graph)->GTPO_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_GraphCreation, gtpo::GenGraph<>)->GTPO_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_GraphCreation, gtpo::GenGraph<InlineAdjacencyConfig>)->GTPO_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_GraphInsertNodes, stpo::Graph)->GTPO_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_GraphInsertNodes, gtpo::GenGraph<BehaviourFreeConfig>)->GTPO_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_GraphRemoveNodes, stpo::Graph)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_GraphRemoveNodes, gtpo::GenGraph<>)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_GraphRemoveEdges, stpo::Graph)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_GraphRemoveEdges, gtpo::GenGraph<>)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_GraphClear, stpo::Graph)->GTPO_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_GraphClear, gtpo::GenGraph<>)->GTPO_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_GraphClear, gtpo::GenGraph<InlineAdjacencyConfig>)->GTPO_BENCHMARK_SIZES;
+BENCHMARK_TEMPLATE(BM_GraphFindEdge, stpo::Graph)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_GroupInsertRemoveNodes, stpo::Graph)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_GroupInsertRemoveNodes, gtpo::GenGraph<>)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_GroupInsertNodesBulk, stpo::Graph)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_GroupInsertRemoveNodes, gtpo::GenGraph<UnorderedGroupsConfig>)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_GroupInsertNodesBulk, gtpo::GenGraph<UnorderedGroupsConfig>)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ProtoSerializerRoundTrip)->GTPO_BENCHMARK_SIZES;
+BENCHMARK(BM_GmlSerializerOut)->GTPO_BENCHMARK_SIZES;
+BENCHMARK(BM_GraphContainsNode)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_GraphContainsNodePtr)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_GraphContainsEdge)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_GraphIsRootNode)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_GroupHasNode)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_GraphHasEdge)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_GraphRemoveNodesBulk)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GraphRemoveNodeUnordered)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GraphCreateChain)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GraphCreateChainBatch)->Arg(100000)->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_GraphTraverseWeak)->GTPO_BENCHMARK_SIZES;
+BENCHMARK(BM_GraphTraverseCsr)->GTPO_BENCHMARK_SIZES;
+BENCHMARK(BM_GraphCsrSnapshot)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GraphSnapshotIncremental)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GeometryBoundingBoxAccessors)->GTPO_BENCHMARK_SIZES;
+BENCHMARK(BM_GeometryBoundingBoxStore)->GTPO_BENCHMARK_SIZES;
+BENCHMARK(BM_GeometryStoreLoadCommit)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SpatialGridQuery)->Arg(40000)->Arg(1000000);
+BENCHMARK(BM_SpatialLinearQuery)->Arg(40000)->Arg(1000000);
+
+BENCHMARK(BM_AlgorithmBfs)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AlgorithmTopologicalSort)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AlgorithmScc)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AlgorithmShortestPaths)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_AllocationCreate, gtpo::GenGraph<>)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AllocationCreate, gtpo::GenGraph<PooledConfig>)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AllocationTraverse, gtpo::GenGraph<>)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AllocationTraverse, gtpo::GenGraph<PooledConfig>)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AllocationClear, gtpo::GenGraph<>)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AllocationClear, gtpo::GenGraph<PooledConfig>)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+/*! Run all benchmarks and write results to gtpoBenchmarks.json (unless an output is specified on command line).
+ *
+ * Archive the JSON report for every library release and compare reports with Google Benchmark
+ * tools/compare.py to track performance regressions.
+ */
+int main( int argc, char** argv )
+{
+    std::vector< char* > args( argv, argv + argc );
+    bool hasOutput = false;
+    for ( int a = 1; a < argc; ++a )
+        hasOutput |= std::string( argv[ a ] ).compare( 0, 16, "--benchmark_out=" ) == 0;
+    std::string out{ "--benchmark_out=gtpoBenchmarks.json" };
+    std::string outFormat{ "--benchmark_out_format=json" };
+    if ( !hasOutput ) {
+        args.push_back( &out[ 0 ] );
+        args.push_back( &outFormat[ 0 ] );
+    }
+    int argCount = static_cast< int >( args.size() );
+    gtpo::ProtoSerializer<>::initProtocolBuffer();
+    benchmark::Initialize( &argCount, args.data() );
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -36,8 +36,14 @@
 #include "./gtpoUtils.h"
 #include "./gtpoBehaviour.h"
 #include "./gtpoGraph.h"
+#include "./gtpoDenseGraph.h"
+#include "./gtpoCsrSnapshot.h"
+#include "./gtpoGeometryStore.h"
+#include "./gtpoMpscQueue.h"
+#include "./gtpoSpatialGrid.h"
 #include "./gtpoSerializer.h"
 #include "./gtpoRandomGraph.h"
 #include "./gtpoProgressNotifier.h"
+#include "./gtpoAlgorithm.h"
 
 #endif // GTpo_h
@@ -8,6 +8,18 @@ HEADERS +=  $$PWD/gtpoUtils.h               \
             $$PWD/gtpoEdge.hpp              \
             $$PWD/gtpoGraph.h               \
             $$PWD/gtpoGraph.hpp             \
+            $$PWD/gtpoSlotMap.h             \
+            $$PWD/gtpoPool.h                \
+            $$PWD/gtpoSmallVector.h         \
+            $$PWD/gtpoCountedSet.h          \
+            $$PWD/gtpoDenseGraph.h          \
+            $$PWD/gtpoDenseGraph.hpp        \
+            $$PWD/gtpoCsrSnapshot.h         \
+            $$PWD/gtpoSnapshot.h            \
+            $$PWD/gtpoGeometryStore.h       \
+            $$PWD/gtpoMpscQueue.h           \
+            $$PWD/gtpoSpatialGrid.h         \
+            $$PWD/gtpoAlgorithm.h           \
             $$PWD/gtpoRandomGraph.h         \
             $$PWD/gtpoBehaviour.h           \
             $$PWD/gtpoBehaviour.hpp         \
@@ -11,6 +11,18 @@ include (../gtpo-common.pri)
 HEADERS +=  ./gtpoUtils.h               \
             ./gtpoGraph.h               \
             ./gtpoGraph.hpp             \
+            ./gtpoSlotMap.h             \
+            ./gtpoPool.h                \
+            ./gtpoSmallVector.h         \
+            ./gtpoCountedSet.h          \
+            ./gtpoDenseGraph.h          \
+            ./gtpoDenseGraph.hpp        \
+            ./gtpoCsrSnapshot.h         \
+            ./gtpoSnapshot.h            \
+            ./gtpoGeometryStore.h       \
+            ./gtpoMpscQueue.h           \
+            ./gtpoSpatialGrid.h         \
+            ./gtpoAlgorithm.h           \
             ./gtpoEdge.hpp              \
             ./gtpoNode.hpp              \
             ./gtpoGroup.hpp             \
@@ -0,0 +1,470 @@
+/*
+    The MIT License (MIT)
+
+    Copyright (c) 2016 Benoit AUTHEMAN
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	gtpoAlgorithm.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef gtpoAlgorithm_h
+#define gtpoAlgorithm_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <cstdint>
+#include <algorithm>        // std::min std::max
+#include <vector>
+#include <memory>           // std::unique_ptr
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <queue>            // std::priority_queue
+#include <limits>
+#include <functional>       // std::greater std::function
+#include <utility>          // std::pair
+
+// GTpo headers
+#include "./gtpoUtils.h"
+#include "./gtpoCsrSnapshot.h"
+#include "./gtpoProgressNotifier.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Graph traversal and analysis algorithms.
+ *
+ * Algorithms run on an immutable gtpo::CsrSnapshot (build one from a live graph with
+ * \c gtpo::CsrSnapshot<Graph>{ graph }), they do not lock any graph primitive and could be
+ * run from a worker thread while the source graph is edited. Results are expressed with
+ * snapshot dense node/edge indices, use CsrSnapshot::getNode() and CsrSnapshot::getEdge()
+ * to map them back to graph primitives.
+ *
+ * All algorithms accept an optional gtpo::IProgressNotifier, progress is reported in the
+ * [0.;1.] range and cancellation requested with IProgressNotifier::cancel() is polled
+ * regularly: a canceled algorithm return early with a partial result and \c canceled set.
+ */
+namespace algorithm { // ::gtpo::algorithm
+
+using Index     = std::uint32_t;
+constexpr Index  invalidIndex = std::numeric_limits< Index >::max();
+
+namespace impl { // ::gtpo::algorithm::impl
+
+//! Throttled progress reporting and cancellation polling (no-op on nullptr progress).
+class ProgressReporter
+{
+public:
+    ProgressReporter( IProgressNotifier* progress, std::size_t total, const std::string& label ) :
+        _progress{ progress }, _total{ total > 0 ? total : 1 }, _step{ total / 100 + 1 } {
+        if ( _progress != nullptr )
+            _progress->beginProgress( label );
+    }
+    ~ProgressReporter() {
+        if ( _progress != nullptr )
+            _progress->endProgress();
+    }
+    ProgressReporter( const ProgressReporter& ) = delete;
+    ProgressReporter& operator=( const ProgressReporter& ) = delete;
+
+    //! Report \c done work items over total and return false if task has been canceled.
+    inline auto update( std::size_t done ) -> bool {
+        if ( _progress == nullptr )
+            return true;
+        if ( done >= _next ) {
+            _next = done + _step;
+            _progress->setProgress( static_cast< double >( done ) / static_cast< double >( _total ) );
+        }
+        return !_progress->isCanceled();
+    }
+    inline auto isCanceled() const noexcept -> bool { return _progress != nullptr && _progress->isCanceled(); }
+private:
+    IProgressNotifier*  _progress{ nullptr };
+    std::size_t         _total{ 1 };
+    std::size_t         _step{ 1 };
+    std::size_t         _next{ 0 };
+};
+
+
+/*! \brief Fixed set of worker threads running the same job for each level of a level synchronous traversal.
+ *
+ * Threads are started once on construction and joined on destruction, run() wake them and block until
+ * all threads, including the calling one (with thread index 0), have completed the job.
+ */
+class LevelWorkers
+{
+public:
+    explicit LevelWorkers( unsigned threadCount ) {
+        _threads.reserve( threadCount > 0 ? threadCount - 1 : 0 );
+        for ( unsigned t = 1; t < threadCount; ++t )
+            _threads.emplace_back( [this, t]() { work( t ); } );
+    }
+    ~LevelWorkers() {
+        {
+            std::lock_guard< std::mutex > lock{ _mutex };
+            _stop = true;
+        }
+        _start.notify_all();
+        for ( auto& thread : _threads )
+            thread.join();
+    }
+    LevelWorkers( const LevelWorkers& ) = delete;
+    LevelWorkers& operator=( const LevelWorkers& ) = delete;
+
+    //! Run \c job( t ) on every thread (t in [0, threadCount[) and return once all threads are done.
+    void    run( std::function< void( unsigned ) > job ) {
+        {
+            std::lock_guard< std::mutex > lock{ _mutex };
+            _job = std::move( job );
+            _pending = _threads.size();
+            ++_generation;
+        }
+        _start.notify_all();
+        _job( 0 );
+        std::unique_lock< std::mutex > lock{ _mutex };
+        _done.wait( lock, [this]() { return _pending == 0; } );
+    }
+private:
+    void    work( unsigned t ) {
+        std::size_t generation = 0;
+        std::unique_lock< std::mutex > lock{ _mutex };
+        for ( ;; ) {
+            _start.wait( lock, [this, generation]() { return _stop || _generation != generation; } );
+            if ( _stop )
+                return;
+            generation = _generation;
+            lock.unlock();
+            _job( t );      // _job is not modified until _pending reach 0
+            lock.lock();
+            if ( --_pending == 0 )
+                _done.notify_one();
+        }
+    }
+
+    std::vector< std::thread >          _threads;
+    std::function< void( unsigned ) >   _job;
+    std::mutex                          _mutex;
+    std::condition_variable             _start;
+    std::condition_variable             _done;
+    std::size_t                         _generation{ 0 };
+    std::size_t                         _pending{ 0 };
+    bool                                _stop{ false };
+};
+
+} // ::gtpo::algorithm::impl
+
+/*! \name Breadth First Search *///-------------------------------------------
+//@{
+struct BfsResult {
+    //! Hop distance from source for every snapshot node, invalidIndex for unreached nodes.
+    std::vector< Index >    levels;
+    Index                   reachedCount{ 0 };
+    bool                    canceled{ false };
+};
+
+/*! \brief Level synchronous breadth first search from snapshot node \c source.
+ *
+ * Large frontiers are expanded in parallel with \c threadCount threads (0 for std::thread::hardware_concurrency()):
+ * frontier is split in fixed size chunks and idle threads grab the next unprocessed chunk, so that threads
+ * expanding high degree nodes do not stall the whole level. Small frontiers are expanded on the calling thread.
+ * Worker threads are started on the first large frontier and reused for all following levels of the traversal.
+ *
+ * \throw gtpo::bad_topology_error if \c source is not a valid snapshot node index.
+ */
+template < class Graph >
+auto    bfs( const CsrSnapshot< Graph >& csr, Index source,
+             IProgressNotifier* progress = nullptr, unsigned threadCount = 0 ) noexcept( false ) -> BfsResult
+{
+    const Index nodeCount = csr.getNodeCount();
+    assert_throw( source < nodeCount, "gtpo::algorithm::bfs(): Error: invalid source node index." );
+    if ( threadCount == 0 )
+        threadCount = std::max( 1u, std::thread::hardware_concurrency() );
+    constexpr std::size_t chunkSize = 256;
+    constexpr std::size_t parallelThreshold = 4 * chunkSize;
+
+    impl::ProgressReporter reporter{ progress, nodeCount, "Breadth first search" };
+    std::unique_ptr< std::atomic< Index >[] > levels{ new std::atomic< Index >[ nodeCount ] };
+    for ( Index n = 0; n < nodeCount; ++n )
+        levels[ n ].store( invalidIndex, std::memory_order_relaxed );
+
+    // Return true if node was unvisited and has been tagged with level by this call
+    const auto visit = [&levels]( Index node, Index level ) noexcept {
+        Index unvisited = invalidIndex;
+        return levels[ node ].load( std::memory_order_relaxed ) == invalidIndex &&
+               levels[ node ].compare_exchange_strong( unvisited, level, std::memory_order_relaxed );
+    };
+    const auto expand = [&csr, &visit]( const Index* first, const Index* last, Index level, std::vector< Index >& next ) {
+        for ( ; first != last; ++first )
+            for ( auto dst : csr.getOutNodes( *first ) )
+                if ( visit( dst, level ) )
+                    next.push_back( dst );
+    };
+
+    BfsResult result;
+    std::vector< Index > frontier{ source };
+    std::vector< Index > next;
+    std::unique_ptr< impl::LevelWorkers > workers;
+    levels[ source ].store( 0, std::memory_order_relaxed );
+    std::size_t reached = 1;
+    for ( Index level = 1; !frontier.empty(); ++level ) {
+        if ( !reporter.update( reached ) ) {
+            result.canceled = true;
+            break;
+        }
+        next.clear();
+        if ( threadCount < 2 || frontier.size() < parallelThreshold )
+            expand( frontier.data(), frontier.data() + frontier.size(), level, next );
+        else {
+            std::atomic< std::size_t > cursor{ 0 };
+            std::vector< std::vector< Index > > threadsNext( threadCount );
+            const auto worker = [&]( unsigned t ) {
+                for ( ;; ) {
+                    const auto first = cursor.fetch_add( chunkSize, std::memory_order_relaxed );
+                    if ( first >= frontier.size() || reporter.isCanceled() )
+                        break;
+                    const auto last = std::min( first + chunkSize, frontier.size() );
+                    expand( frontier.data() + first, frontier.data() + last, level, threadsNext[ t ] );
+                }
+            };
+            if ( !workers )
+                workers.reset( new impl::LevelWorkers{ threadCount } );
+            workers->run( worker );
+            for ( const auto& threadNext : threadsNext )
+                next.insert( next.end(), threadNext.cbegin(), threadNext.cend() );
+        }
+        reached += next.size();
+        frontier.swap( next );
+    }
+
+    result.levels.resize( nodeCount );
+    for ( Index n = 0; n < nodeCount; ++n )
+        result.levels[ n ] = levels[ n ].load( std::memory_order_relaxed );
+    result.reachedCount = static_cast< Index >( reached );
+    return result;
+}
+//@}
+//-----------------------------------------------------------------------------
+
+/*! \name Topological Sort *///-----------------------------------------------
+//@{
+struct TopologicalSortResult {
+    //! Snapshot node indices in topological order (only nodes not involved in or downstream of a circuit).
+    std::vector< Index >    order;
+    //! Nodes that could not be ordered because they belong to (or are reachable from) a circuit.
+    std::vector< Index >    cycleNodes;
+    bool                    canceled{ false };
+
+    inline auto isAcyclic() const noexcept -> bool { return !canceled && cycleNodes.empty(); }
+};
+
+/*! \brief Kahn topological sort of a snapshot, circuits (including trivial circuits) are reported in \c cycleNodes.
+ */
+template < class Graph >
+auto    topologicalSort( const CsrSnapshot< Graph >& csr, IProgressNotifier* progress = nullptr ) -> TopologicalSortResult
+{
+    const Index nodeCount = csr.getNodeCount();
+    impl::ProgressReporter reporter{ progress, nodeCount, "Topological sort" };
+    TopologicalSortResult result;
+    std::vector< Index > inDegrees( nodeCount );
+    result.order.reserve( nodeCount );
+    for ( Index n = 0; n < nodeCount; ++n ) {
+        inDegrees[ n ] = csr.getInDegree( n );
+        if ( inDegrees[ n ] == 0 )
+            result.order.push_back( n );
+    }
+    for ( std::size_t head = 0; head < result.order.size(); ++head ) {   // result.order is used as the FIFO queue
+        if ( !reporter.update( head ) ) {
+            result.canceled = true;
+            return result;
+        }
+        for ( auto dst : csr.getOutNodes( result.order[ head ] ) )
+            if ( --inDegrees[ dst ] == 0 )
+                result.order.push_back( dst );
+    }
+    for ( Index n = 0; n < nodeCount; ++n )
+        if ( inDegrees[ n ] != 0 )
+            result.cycleNodes.push_back( n );
+    return result;
+}
+//@}
+//-----------------------------------------------------------------------------
+
+/*! \name Strongly Connected Components *///----------------------------------
+//@{
+struct SccResult {
+    //! Component index for every snapshot node (invalidIndex for nodes not visited because of cancellation).
+    std::vector< Index >    components;
+    Index                   componentCount{ 0 };
+    bool                    canceled{ false };
+};
+
+/*! \brief Tarjan strongly connected components, components are numbered in reverse topological order.
+ *
+ * Implementation is iterative and does not overflow the call stack on very deep graphs.
+ */
+template < class Graph >
+auto    stronglyConnectedComponents( const CsrSnapshot< Graph >& csr, IProgressNotifier* progress = nullptr ) -> SccResult
+{
+    const Index nodeCount = csr.getNodeCount();
+    impl::ProgressReporter reporter{ progress, nodeCount, "Strongly connected components" };
+    SccResult result;
+    result.components.assign( nodeCount, invalidIndex );
+    std::vector< Index > indices( nodeCount, invalidIndex );
+    std::vector< Index > lowLinks( nodeCount, 0 );
+    std::vector< bool > onStack( nodeCount, false );
+    std::vector< Index > stack;
+    std::vector< std::pair< Index, Index > > callStack;    // (node, next out edge position)
+    Index nextIndex = 0;
+
+    for ( Index root = 0; root < nodeCount; ++root ) {
+        if ( indices[ root ] != invalidIndex )
+            continue;
+        if ( !reporter.update( nextIndex ) ) {
+            result.canceled = true;
+            return result;
+        }
+        callStack.emplace_back( root, 0 );
+        indices[ root ] = lowLinks[ root ] = nextIndex++;
+        stack.push_back( root );
+        onStack[ root ] = true;
+        while ( !callStack.empty() ) {
+            auto& frame = callStack.back();
+            const auto node = frame.first;
+            const auto outNodes = csr.getOutNodes( node );
+            if ( frame.second < outNodes.size() ) {
+                const auto dst = outNodes[ frame.second++ ];
+                if ( indices[ dst ] == invalidIndex ) {     // Recurse on dst
+                    indices[ dst ] = lowLinks[ dst ] = nextIndex++;
+                    stack.push_back( dst );
+                    onStack[ dst ] = true;
+                    callStack.emplace_back( dst, 0 );
+                } else if ( onStack[ dst ] )
+                    lowLinks[ node ] = std::min( lowLinks[ node ], indices[ dst ] );
+                continue;
+            }
+            if ( lowLinks[ node ] == indices[ node ] ) {    // node is a component root, pop its component
+                Index member = invalidIndex;
+                do {
+                    member = stack.back();
+                    stack.pop_back();
+                    onStack[ member ] = false;
+                    result.components[ member ] = result.componentCount;
+                } while ( member != node );
+                ++result.componentCount;
+            }
+            callStack.pop_back();
+            if ( !callStack.empty() ) {
+                const auto parent = callStack.back().first;
+                lowLinks[ parent ] = std::min( lowLinks[ parent ], lowLinks[ node ] );
+            }
+        }
+    }
+    return result;
+}
+//@}
+//-----------------------------------------------------------------------------
+
+/*! \name Shortest Paths *///-------------------------------------------------
+//@{
+/*! \brief Collect snapshot edges weights using graph \c Config::getWeight() properties accessor.
+ *
+ * \note Must be called from the thread owning the graph (edges are locked), weights of expired edges are 0.
+ */
+template < class Graph >
+auto    getEdgeWeights( const CsrSnapshot< Graph >& csr ) -> std::vector< double >
+{
+    std::vector< double > weights( csr.getEdgeCount(), 0. );
+    for ( Index e = 0; e < csr.getEdgeCount(); ++e ) {
+        const auto edge = csr.getEdge( e ).lock();
+        if ( edge )
+            weights[ e ] = Graph::Configuration::getWeight( edge.get() );
+    }
+    return weights;
+}
+
+struct ShortestPathsResult {
+    //! Distance from source for every snapshot node, infinity for unreached nodes.
+    std::vector< double >   distances;
+    //! Index of the edge used to reach every snapshot node on its shortest path, invalidIndex for source and unreached nodes.
+    std::vector< Index >    predecessors;
+    bool                    canceled{ false };
+};
+
+/*! \brief Dijkstra single source shortest paths from snapshot node \c source with edge weights \c weights.
+ *
+ * \c weights is indexed by snapshot edge index (see getEdgeWeights()).
+ * \throw gtpo::bad_topology_error if \c source is invalid, \c weights size does not match snapshot edge
+ * count or a weight is negative.
+ */
+template < class Graph >
+auto    shortestPaths( const CsrSnapshot< Graph >& csr, const std::vector< double >& weights, Index source,
+                       IProgressNotifier* progress = nullptr ) noexcept( false ) -> ShortestPathsResult
+{
+    const Index nodeCount = csr.getNodeCount();
+    assert_throw( source < nodeCount, "gtpo::algorithm::shortestPaths(): Error: invalid source node index." );
+    assert_throw( weights.size() == csr.getEdgeCount(), "gtpo::algorithm::shortestPaths(): Error: weights and snapshot edges count mismatch." );
+    for ( auto weight : weights )
+        assert_throw( weight >= 0., "gtpo::algorithm::shortestPaths(): Error: negative edge weight." );
+
+    impl::ProgressReporter reporter{ progress, nodeCount, "Shortest paths" };
+    ShortestPathsResult result;
+    result.distances.assign( nodeCount, std::numeric_limits< double >::infinity() );
+    result.predecessors.assign( nodeCount, invalidIndex );
+    using Entry = std::pair< double, Index >;
+    std::priority_queue< Entry, std::vector< Entry >, std::greater< Entry > > queue;
+    result.distances[ source ] = 0.;
+    queue.emplace( 0., source );
+    std::size_t settled = 0;
+    while ( !queue.empty() ) {
+        const auto entry = queue.top();
+        queue.pop();
+        const auto node = entry.second;
+        if ( entry.first > result.distances[ node ] )
+            continue;       // Stale queue entry
+        if ( !reporter.update( ++settled ) ) {
+            result.canceled = true;
+            break;
+        }
+        const auto outNodes = csr.getOutNodes( node );
+        const auto outEdges = csr.getOutEdges( node );
+        for ( std::size_t o = 0; o < outNodes.size(); ++o ) {
+            const auto dst = outNodes[ o ];
+            const auto distance = entry.first + weights[ outEdges[ o ] ];
+            if ( distance < result.distances[ dst ] ) {
+                result.distances[ dst ] = distance;
+                result.predecessors[ dst ] = outEdges[ o ];
+                queue.emplace( distance, dst );
+            }
+        }
+    }
+    return result;
+}
+//@}
+//-----------------------------------------------------------------------------
+
+} // ::gtpo::algorithm
+} // ::gtpo
+
+#endif // gtpoAlgorithm_h
@@ -35,15 +35,97 @@
 
 // STD headers
 #include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint32_t
 #include <functional>       // std::function
 #include <vector>
+#include <array>
 #include <memory>
+#include <tuple>
+#include <type_traits>      // std::integral_constant
 
 // GTpo headers
 // Nil
 
 namespace gtpo { // ::gtpo
 
+/*! \name Behaviour Events *///-----------------------------------------------
+//@{
+
+//! Bitwise combination of gtpo::BehaviourEvent values.
+using BehaviourEventMask = std::uint32_t;
+
+/*! \brief Notifications a behaviour could subscribe to, one bit per behaviour notification method.
+ *
+ * Batch notifications (gtpo::GraphBehaviour::nodesInserted() and edgesInserted()) are delivered to
+ * behaviours subscribing to NodeInserted and EdgeInserted.
+ */
+struct BehaviourEvent {
+    enum : BehaviourEventMask {
+        None                    = 0,
+        NodeInserted            = 1u << 0,
+        NodeRemoved             = 1u << 1,
+        NodeModified            = 1u << 2,
+        EdgeInserted            = 1u << 3,
+        EdgeRemoved             = 1u << 4,
+        EdgeModified            = 1u << 5,
+        GroupInserted           = 1u << 6,
+        GroupRemoved            = 1u << 7,
+        GroupModified           = 1u << 8,
+        InNodeInserted          = 1u << 9,
+        InNodeAboutToBeRemoved  = 1u << 10,
+        InNodeRemoved           = 1u << 11,
+        OutNodeInserted         = 1u << 12,
+        OutNodeRemoved          = 1u << 13,
+        All                     = ( 1u << 14 ) - 1
+    };
+    //! Number of distinct events (ie number of bits used in All).
+    enum : std::size_t { Count = 14 };
+
+    //! Return the bit index of single event \c event (for example 3 for EdgeInserted).
+    static constexpr auto   index( BehaviourEventMask event ) noexcept -> std::size_t {
+        return ( event & 1u ) != 0 || event == 0 ? 0 : 1 + index( event >> 1 );
+    }
+};
+
+template < class... >
+struct make_void { using type = void; };
+
+/*! \brief Compile time event mask of static behaviour \c B.
+ *
+ * Default to the \c B::events static constexpr member if \c B declare one, gtpo::BehaviourEvent::All
+ * otherwise. Static behaviours (behaviours registered in Config::GraphBehaviours, GroupBehaviours or
+ * NodeBehaviours tuples) are never called for events outside of their mask, dispatch code for these
+ * events is not even generated. Could be specialized for behaviours that can't be modified:
+ * \code
+ *   template <>
+ *   struct gtpo::behaviour_events< MyBehaviour > :
+ *       std::integral_constant< gtpo::BehaviourEventMask, gtpo::BehaviourEvent::NodeInserted > { };
+ * \endcode
+ */
+template < class B, class = void >
+struct behaviour_events : std::integral_constant< BehaviourEventMask, BehaviourEvent::All > { };
+
+template < class B >
+struct behaviour_events< B, typename make_void< decltype( B::events ) >::type > :
+        std::integral_constant< BehaviourEventMask, B::events > { };
+
+//! Union of all \c Behaviours static behaviours event masks.
+template < class... Behaviours >
+struct behaviours_events;
+
+template <>
+struct behaviours_events<> : std::integral_constant< BehaviourEventMask, BehaviourEvent::None > { };
+
+template < class B, class... Behaviours >
+struct behaviours_events< B, Behaviours... > :
+        std::integral_constant< BehaviourEventMask, behaviour_events< B >::value |
+                                                    behaviours_events< Behaviours... >::value > { };
+
+template < class... Behaviours >
+struct behaviours_events< std::tuple< Behaviours... > > : behaviours_events< Behaviours... > { };
+//@}
+//-----------------------------------------------------------------------------
+
 /*! \brief Define a node observer interface.
  *
  */
@@ -68,6 +150,14 @@ protected:
 private:
     std::string _name = "";
 
+public:
+    /*! \brief Return the events this behaviour should be notified of (default to gtpo::BehaviourEvent::All).
+     *
+     * Mask is read once when the behaviour is registered with gtpo::Behaviourable::addBehaviour(), a
+     * behaviour is never called for an event outside of its mask.
+     */
+    virtual auto    getEvents() const noexcept -> BehaviourEventMask { return BehaviourEvent::All; }
+
 public:
     /*! \brief Called immediatly after an in-edge with source \c weakInNode has been inserted.
      */
@@ -172,6 +262,9 @@ public:
     //! Optionnal notifier for the enabled property.
     virtual void    notifyEnabledChanged() { }
 
+    //! \copydoc gtpo::NodeBehaviour::getEvents()
+    virtual auto    getEvents() const noexcept -> BehaviourEventMask { return BehaviourEvent::All; }
+
 protected:
     bool            _enabled = true;
 };
@@ -253,6 +346,32 @@ public:
     using SharedGroup   = std::shared_ptr< typename Config::Group >;
     using WeakGroup     = std::weak_ptr< typename Config::Group >;
 
+    //! Contiguous set of primitives inserted during a graph batch (see gtpo::GenGraph::beginBatch()).
+    using WeakNodesBatch    = std::vector< WeakNode >;
+    using WeakEdgesBatch    = std::vector< WeakEdge >;
+
+    /*! \name Batch Notification Interface *///--------------------------------
+    //@{
+public:
+    /*! \brief Called once at the end of a graph batch with all nodes inserted during the batch.
+     *
+     * Default implementation call nodeInserted() for every node, override to process a change set at once.
+     */
+    virtual void    nodesInserted( const WeakNodesBatch& weakNodes ) noexcept {
+        for ( auto weakNode : weakNodes )
+            this->nodeInserted( weakNode );
+    }
+    /*! \brief Called once at the end of a graph batch with all edges inserted during the batch.
+     *
+     * Default implementation call edgeInserted() for every edge, override to process a change set at once.
+     */
+    virtual void    edgesInserted( const WeakEdgesBatch& weakEdges ) noexcept {
+        for ( auto weakEdge : weakEdges )
+            this->edgeInserted( weakEdge );
+    }
+    //@}
+    //-------------------------------------------------------------------------
+
     //! Called immediatly after group \c weakGroup has been inserted in graph.
     virtual void    groupInserted( WeakGroup& weakGroup ) noexcept { (void)weakGroup; }
     //! Called immediatly before group \c weakGroup is removed from graph.
@@ -287,6 +406,19 @@ void for_each_in_tuple( std::tuple<Ts...>& tuple, F func ) noexcept {
     for_each_in_tuple( tuple, func, std::make_index_sequence<sizeof...(Ts)>() );
 }
 
+//! Apply a functor on a static behaviour only if it subscribe to the notified event (see Behaviourable::sNotifyBehaviours()).
+template < bool Subscribed >
+struct static_notify {
+    template < class B, class Functor >
+    static inline auto  apply( B& behaviour, Functor& f ) noexcept -> void { f( behaviour ); }
+};
+
+template <>
+struct static_notify< false > {
+    template < class B, class Functor >
+    static inline auto  apply( B&, Functor& ) noexcept -> void { }
+};
+
 //! Empty interface definition for graph primitives supporting behaviour concept.
 struct IBehaviorable {
     IBehaviorable() noexcept = default;
@@ -306,13 +438,13 @@ class Behaviourable : public IBehaviorable
     //@{
 public:
     Behaviourable() noexcept { }
-    ~Behaviourable() { _behaviours.clear(); }
+    ~Behaviourable() { clear(); }
     Behaviourable( const Behaviourable& ) = delete;
     Behaviourable& operator=( const Behaviourable& ) = delete;
 
 public:
     //! Clear all actually regsitered behaviours (they are automatically deleted).
-    inline  auto    clear( ) -> void { _behaviours.clear(); }
+    inline  auto    clear( ) -> void { _events = BehaviourEvent::None; _subscribers.reset(); _behaviours.clear(); }
     //@}
     //-------------------------------------------------------------------------
 
@@ -331,9 +463,7 @@ public:
      *
      * \param behaviour Graph will get behaviour ownership.
      */
-    inline auto     addBehaviour( std::unique_ptr<Behaviour> behaviour ) -> void {
-        _behaviours.emplace_back( std::move( behaviour ) );
-    }
+    auto     addBehaviour( std::unique_ptr<Behaviour> behaviour ) -> void;
 
     //! std::vector of std::unique_ptr pointers on Behaviour.
     using Behaviours = std::vector< std::unique_ptr< Behaviour > >;
@@ -345,40 +475,61 @@ public:
     //! Return a read only container of actually registered behaviours.
     inline auto    getBehaviours() const noexcept -> const Behaviours& { return _behaviours; }
 
+    //! Return the union of registered behaviours event masks (see gtpo::NodeBehaviour::getEvents()).
+    inline auto    getEvents() const noexcept -> BehaviourEventMask { return _events; }
+
 protected:
-    /*! \brief Apply a method pointer on all registered behaviours.
+    /*! \brief Apply a method pointer on all registered behaviours subscribing to \c Event.
      *
      * Example use:
      * \code
      *    // For a given NodeBehaviour method: auto    notifyNodeModified( WeakNode& node ) -> void;
-     *    notifyBehaviours< WeakNode >( &Behaviour::nodeModified, node );
+     *    notifyBehaviours< BehaviourEvent::NodeModified, WeakNode >( &Behaviour::nodeModified, node );
      * \endcode
      */
-    template < class T >
+    template < BehaviourEventMask Event, class T >
     auto    notifyBehaviours( void (Behaviour::*method)(T&) noexcept, T& arg ) noexcept -> void;
 
     //! Similar to notifyBahaviours() but without arguments.
+    template < BehaviourEventMask Event >
     auto    notifyBehaviours0( void (Behaviour::*method)() noexcept ) noexcept -> void;
 
 private:
-    Behaviours  _behaviours;
+    //! Raw pointers on behaviours owned in _behaviours, one list per event.
+    using Subscribers = std::array< std::vector< Behaviour* >, BehaviourEvent::Count >;
+
+    Behaviours                      _behaviours;
+    //! Union of registered behaviours event masks, notifications for other events return immediately.
+    BehaviourEventMask              _events = BehaviourEvent::None;
+    //! Allocated when the first behaviour is registered, most primitives never have one.
+    std::unique_ptr< Subscribers >  _subscribers;
     //@}
     //-------------------------------------------------------------------------
 
     /*! \name Static Behaviours Management *///--------------------------------
     //@{
 public:
-    /*! \brief Apply a functor on all registered static behaviours.
+    /*! \brief Apply a functor on all registered static behaviours subscribing to \c Event (see gtpo::behaviour_events).
+     *
+     * Functor is not instantiated for behaviours outside of \c Event, when no static behaviour subscribe to
+     * \c Event, the call compile to nothing.
      *
      * Example use:
      * \code
+     *   sNotifyBehaviours< BehaviourEvent::NodeModified >( [&](auto& behaviour) noexcept { behaviour.nodeModified( node ); } );
      * \endcode
      */
-    template < class Functor >
+    template < BehaviourEventMask Event = BehaviourEvent::All, class Functor >
     auto    sNotifyBehaviours( Functor f ) noexcept -> void {
-        for_each_in_tuple( _sBehaviours, f );
+        for_each_in_tuple( _sBehaviours, [&f](auto& behaviour) noexcept {
+            using B = std::decay_t< decltype( behaviour ) >;
+            static_notify< ( behaviour_events< B >::value & Event ) != 0 >::apply( behaviour, f );
+        } );
     }
 
+    //! Union of static behaviours event masks.
+    static constexpr auto   getStaticEvents() noexcept -> BehaviourEventMask { return behaviours_events< SBehaviours >::value; }
+
 private:
     SBehaviours  _sBehaviours;
     //@}
@@ -392,6 +543,10 @@ public:
     template < class Node >
     auto    notifyNodeInserted( Node& node ) noexcept -> void;
 
+    //! Notify all behaviours that nodes \c nodes have been inserted (graph behaviours only, see gtpo::GraphBehaviour::nodesInserted()).
+    template < class Nodes >
+    auto    notifyNodesInserted( const Nodes& nodes ) noexcept -> void;
+
     template < class Node >
     auto    notifyNodeRemoved( Node& node ) noexcept -> void;
 
@@ -402,6 +557,10 @@ public:
     template < class Edge >
     auto    notifyEdgeInserted( Edge& edge ) noexcept -> void;
 
+    //! Notify all behaviours that edges \c edges have been inserted (graph behaviours only, see gtpo::GraphBehaviour::edgesInserted()).
+    template < class Edges >
+    auto    notifyEdgesInserted( const Edges& edges ) noexcept -> void;
+
     template < class Edge >
     auto    notifyEdgeRemoved( Edge& edge ) noexcept -> void;
 
@@ -445,6 +604,10 @@ public:
     using WeakGroup     = std::weak_ptr< typename Config::Group >;
     using SharedGroup   = std::shared_ptr< typename Config::Group >;
 
+    //! Group adjacent edge set only depends on nodes insertion and removal.
+    static constexpr BehaviourEventMask events = BehaviourEvent::NodeInserted | BehaviourEvent::NodeRemoved;
+    virtual auto    getEvents() const noexcept -> BehaviourEventMask override { return events; }
+
 public:
     virtual void    groupModified( WeakGroup& weakGroup ) noexcept override { (void)weakGroup; }
     virtual void    nodeInserted( WeakNode& weakNode ) noexcept override;
@@ -473,6 +636,10 @@ public:
     using WeakGroup     = std::weak_ptr< typename Config::Group >;
     using SharedGroup   = std::shared_ptr< typename Config::Group >;
 
+    //! Group edge sets only depends on edges insertion and removal.
+    static constexpr BehaviourEventMask events = BehaviourEvent::EdgeInserted | BehaviourEvent::EdgeRemoved;
+    virtual auto    getEvents() const noexcept -> BehaviourEventMask override { return events; }
+
 public:
     virtual void    edgeInserted( WeakEdge& weakEdge ) noexcept override;
     virtual void    edgeRemoved( WeakEdge& weakEdge ) noexcept override;
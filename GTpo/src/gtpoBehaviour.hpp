@@ -36,25 +36,41 @@ namespace gtpo { // ::gtpo
 
 /* Virtual Behaviours Management *///------------------------------------------
 template < class Behaviour, class SBehaviours  >
-template < class T >
+auto    Behaviourable< Behaviour, SBehaviours >::addBehaviour( std::unique_ptr<Behaviour> behaviour ) -> void
+{
+    if ( behaviour == nullptr )
+        return;
+    if ( !_subscribers )
+        _subscribers = std::make_unique< Subscribers >();
+    const auto events = behaviour->getEvents() & BehaviourEvent::All;
+    for ( std::size_t e = 0; e < BehaviourEvent::Count; ++e )
+        if ( ( events & ( 1u << e ) ) != 0 )
+            (*_subscribers)[ e ].push_back( behaviour.get() );
+    _events |= events;
+    _behaviours.emplace_back( std::move( behaviour ) );
+}
+
+template < class Behaviour, class SBehaviours  >
+template < BehaviourEventMask Event, class T >
 auto    Behaviourable< Behaviour, SBehaviours >::notifyBehaviours( void (Behaviour::*method)(T&), T& arg ) noexcept -> void
 {
+    if ( ( _events & Event ) == 0 )     // Fast path, also taken when there is no registered behaviours
+        return;
     // Note 20160314: See http://stackoverflow.com/questions/1485983/calling-c-class-methods-via-a-function-pointer
     // For calling pointer on template template parameter template keyword functions.
-    // std::unique_ptr has no overload for .* or ->* operator
-    // (*behaviour) == (*behaviour.get())
-    // Equivalent to: ((*behaviour.get()).*method)(arg)
-    for ( auto& behaviour : _behaviours )
-        if ( behaviour != nullptr )
-            ((*behaviour).*method)(arg);
+    // Equivalent to: ((*behaviour).*method)(arg)
+    for ( auto behaviour : (*_subscribers)[ BehaviourEvent::index( Event ) ] )
+        (behaviour->*method)(arg);
 }
 
 template < class Behaviour, class SBehaviours  >
+template < BehaviourEventMask Event >
 auto    Behaviourable< Behaviour, SBehaviours >::notifyBehaviours0( void (Behaviour::*method)() ) noexcept -> void
 {
-    for ( auto& behaviour : _behaviours )
-        if ( behaviour != nullptr )
-            ((*behaviour).*method)();
+    if ( ( _events & Event ) == 0 )
+        return;
+    for ( auto behaviour : (*_subscribers)[ BehaviourEvent::index( Event ) ] )
+        (behaviour->*method)();
 }//-----------------------------------------------------------------------------
 
 
@@ -63,72 +79,88 @@ template < class Behaviour, class SBehaviours  >
 template < class Node >
 auto    Behaviourable< Behaviour, SBehaviours >::notifyNodeInserted( Node& node ) noexcept -> void
 {
-    notifyBehaviours< Node >( &Behaviour::nodeInserted, node );
-    sNotifyBehaviours( [&](auto& behaviour) noexcept { behaviour.nodeInserted( node ); } );
+    notifyBehaviours< BehaviourEvent::NodeInserted, Node >( &Behaviour::nodeInserted, node );
+    sNotifyBehaviours< BehaviourEvent::NodeInserted >( [&](auto& behaviour) noexcept { behaviour.nodeInserted( node ); } );
+}
+
+template < class Behaviour, class SBehaviours  >
+template < class Nodes >
+auto    Behaviourable< Behaviour, SBehaviours >::notifyNodesInserted( const Nodes& nodes ) noexcept -> void
+{
+    notifyBehaviours< BehaviourEvent::NodeInserted, const Nodes >( &Behaviour::nodesInserted, nodes );
+    sNotifyBehaviours< BehaviourEvent::NodeInserted >( [&](auto& behaviour) noexcept { behaviour.nodesInserted( nodes ); } );
 }
 
 template < class Behaviour, class SBehaviours  >
 template < class Node >
 auto    Behaviourable< Behaviour, SBehaviours >::notifyNodeRemoved( Node& node ) noexcept -> void
 {
-    notifyBehaviours< Node >( &Behaviour::nodeRemoved, node );
-    sNotifyBehaviours( [&](auto& behaviour) noexcept { behaviour.nodeRemoved( node ); } );
+    notifyBehaviours< BehaviourEvent::NodeRemoved, Node >( &Behaviour::nodeRemoved, node );
+    sNotifyBehaviours< BehaviourEvent::NodeRemoved >( [&](auto& behaviour) noexcept { behaviour.nodeRemoved( node ); } );
 }
 
 template < class Behaviour, class SBehaviours  >
 template < class Node >
 auto    Behaviourable< Behaviour, SBehaviours >::notifyNodeModified( Node& node ) noexcept -> void
 {
-    notifyBehaviours< Node >( &Behaviour::nodeModified, node );
-    sNotifyBehaviours( [&](auto& behaviour) noexcept { behaviour.nodeModified( node ); } );
+    notifyBehaviours< BehaviourEvent::NodeModified, Node >( &Behaviour::nodeModified, node );
+    sNotifyBehaviours< BehaviourEvent::NodeModified >( [&](auto& behaviour) noexcept { behaviour.nodeModified( node ); } );
 }
 
 template < class Behaviour, class SBehaviours  >
 template < class Edge >
 auto    Behaviourable< Behaviour, SBehaviours >::notifyEdgeInserted( Edge& edge ) noexcept -> void
 {
-    notifyBehaviours< Edge >( &Behaviour::edgeInserted, edge );
-    sNotifyBehaviours( [&](auto& behaviour) noexcept { behaviour.edgeInserted( edge ); } );
+    notifyBehaviours< BehaviourEvent::EdgeInserted, Edge >( &Behaviour::edgeInserted, edge );
+    sNotifyBehaviours< BehaviourEvent::EdgeInserted >( [&](auto& behaviour) noexcept { behaviour.edgeInserted( edge ); } );
+}
+
+template < class Behaviour, class SBehaviours  >
+template < class Edges >
+auto    Behaviourable< Behaviour, SBehaviours >::notifyEdgesInserted( const Edges& edges ) noexcept -> void
+{
+    notifyBehaviours< BehaviourEvent::EdgeInserted, const Edges >( &Behaviour::edgesInserted, edges );
+    sNotifyBehaviours< BehaviourEvent::EdgeInserted >( [&](auto& behaviour) noexcept { behaviour.edgesInserted( edges ); } );
 }
 
 template < class Behaviour, class SBehaviours  >
 template < class Edge >
 auto    Behaviourable< Behaviour, SBehaviours >::notifyEdgeRemoved( Edge& edge ) noexcept -> void
 {
-    notifyBehaviours< Edge >( &Behaviour::edgeRemoved, edge );
-    sNotifyBehaviours( [&](auto& behaviour) noexcept { behaviour.edgeRemoved( edge ); } );
+    notifyBehaviours< BehaviourEvent::EdgeRemoved, Edge >( &Behaviour::edgeRemoved, edge );
+    sNotifyBehaviours< BehaviourEvent::EdgeRemoved >( [&](auto& behaviour) noexcept { behaviour.edgeRemoved( edge ); } );
 }
 
 template < class Behaviour, class SBehaviours  >
 template < class Edge >
 auto    Behaviourable< Behaviour, SBehaviours >::notifyEdgeModified( Edge& edge ) noexcept -> void
 {
-    notifyBehaviours< Edge >( &Behaviour::edgeModified, edge );
-    sNotifyBehaviours( [&](auto& behaviour) noexcept { behaviour.edgeModified( edge ); } );
+    notifyBehaviours< BehaviourEvent::EdgeModified, Edge >( &Behaviour::edgeModified, edge );
+    sNotifyBehaviours< BehaviourEvent::EdgeModified >( [&](auto& behaviour) noexcept { behaviour.edgeModified( edge ); } );
 }
 
 template < class Behaviour, class SBehaviours  >
 template < class Group >
 auto    Behaviourable< Behaviour, SBehaviours >::notifyGroupInserted( Group& group ) noexcept -> void
 {
-    notifyBehaviours< Group >( &Behaviour::groupInserted, group );
-    sNotifyBehaviours( [&](auto& behaviour) noexcept { behaviour.groupInserted( group ); } );
+    notifyBehaviours< BehaviourEvent::GroupInserted, Group >( &Behaviour::groupInserted, group );
+    sNotifyBehaviours< BehaviourEvent::GroupInserted >( [&](auto& behaviour) noexcept { behaviour.groupInserted( group ); } );
 }
 
 template < class Behaviour, class SBehaviours  >
 template < class Group >
 auto    Behaviourable< Behaviour, SBehaviours >::notifyGroupRemoved( Group& group ) noexcept -> void
 {
-    notifyBehaviours< Group >( &Behaviour::groupRemoved, group );
-    sNotifyBehaviours( [&](auto& behaviour) noexcept { behaviour.groupRemoved( group ); } );
+    notifyBehaviours< BehaviourEvent::GroupRemoved, Group >( &Behaviour::groupRemoved, group );
+    sNotifyBehaviours< BehaviourEvent::GroupRemoved >( [&](auto& behaviour) noexcept { behaviour.groupRemoved( group ); } );
 }
 
 template < class Behaviour, class SBehaviours  >
 template < class G >
 auto    Behaviourable< Behaviour, SBehaviours >::notifyGroupModified( G& group ) noexcept -> void
 {
-    notifyBehaviours< G >( &Behaviour::groupModified, group );
-    sNotifyBehaviours( [&](auto& behaviour) noexcept { behaviour.groupModified( group ); } );
+    notifyBehaviours< BehaviourEvent::GroupModified, G >( &Behaviour::groupModified, group );
+    sNotifyBehaviours< BehaviourEvent::GroupModified >( [&](auto& behaviour) noexcept { behaviour.groupModified( group ); } );
 }
 //-----------------------------------------------------------------------------
 
@@ -141,10 +173,13 @@ void    GroupAdjacentEdgesBehaviour< Config >::nodeInserted( WeakNode& weakNode
     if ( node ) {
         SharedGroup group = node->getGroup().lock();
         if ( group ) {
-            for ( const auto& inEdge : node->getInEdges() ) // Add all node in/out edges to adjacent edge set
-                Config::template insert<WeakEdgesSearch>::into( group->getAdjacentEdges(), inEdge );
+            // Reference all node in/out edges once in group adjacent edge set (twice for an edge with
+            // both endpoints in group), O(degree)
+            auto& adjacentEdges = group->getAdjacentEdges();
+            for ( const auto& inEdge : node->getInEdges() )
+                adjacentEdges.insert( inEdge, inEdge.lock().get() );
             for ( const auto& outEdge : node->getOutEdges() )
-                Config::template insert<WeakEdgesSearch>::into( group->getAdjacentEdges(), outEdge );
+                adjacentEdges.insert( outEdge, outEdge.lock().get() );
         }
     }
 }
@@ -156,26 +191,13 @@ void    GroupAdjacentEdgesBehaviour< Config >::nodeRemoved( WeakNode& weakNode )
     if ( node ) {
         auto group = node->getGroup().lock();
         if ( group ) {
-            // Remove all node in/out edges from group adjacent edge set
-            // Except if this edge "other" src or dst is still part of the group
-            for ( const auto& inWeakEdge : node->getInEdges() ) {
-                SharedEdge inEdge = inWeakEdge.lock();
-                if ( inEdge ) {
-                    auto inEdgeSrc = inEdge->getSrc().lock();
-                    if ( inEdgeSrc &&
-                         inEdgeSrc->getGroup().lock().get() != group.get() )
-                        Config::template remove<WeakEdgesSearch>::from( group->getAdjacentEdges(), inWeakEdge );
-                }
-            }
-            for ( const auto& outWeakEdge : node->getOutEdges() ) {
-                SharedEdge outEdge = outWeakEdge.lock();
-                if ( outEdge ) {
-                    SharedNode outEdgeDst = outEdge->getDst().lock();
-                    if ( outEdgeDst &&
-                         outEdgeDst->getGroup().lock().get() != group.get() )
-                        Config::template remove<WeakEdgesSearch>::from( group->getAdjacentEdges(), outWeakEdge );
-                }
-            }
+            // Release node in/out edges references, an edge whose "other" src or dst is still part
+            // of the group keep a reference and thus stay adjacent, O(degree)
+            auto& adjacentEdges = group->getAdjacentEdges();
+            for ( const auto& inEdge : node->getInEdges() )
+                adjacentEdges.release( inEdge.lock().get() );
+            for ( const auto& outEdge : node->getOutEdges() )
+                adjacentEdges.release( outEdge.lock().get() );
         }
     }
 }
@@ -185,22 +207,20 @@ void    GroupAdjacentEdgesBehaviour< Config >::nodeRemoved( WeakNode& weakNode )
 template < class Config >
 void    GraphGroupAjacentEdgesBehaviour< Config >::edgeInserted( WeakEdge& weakEdge ) noexcept
 {
-    if ( !weakEdge.expired() ) {
-        SharedEdge edge = weakEdge.lock();
-        if ( edge != nullptr ) {
-            // If either src or dst is inside a group, add edge to group adjacent edge set
-            SharedNode src = edge->getSrc().lock();
-            if ( src != nullptr ) {
-                SharedGroup srcGroup = src->getGroup().lock();
-                if ( srcGroup != nullptr )
-                    Config::template insert<WeakEdgesSearch>::into( srcGroup->getAdjacentEdges(), weakEdge );
-            }
-            SharedNode dst = edge->getDst().lock();
-            if ( dst != nullptr ) {
-                SharedGroup dstGroup = dst->getGroup().lock();
-                if ( dstGroup != nullptr )
-                    Config::template insert<WeakEdgesSearch>::into( dstGroup->getAdjacentEdges(), weakEdge );
-            }
+    SharedEdge edge = weakEdge.lock();
+    if ( edge != nullptr ) {
+        // If either src or dst is inside a group, reference edge in group adjacent edge set
+        SharedNode src = edge->getSrc().lock();
+        if ( src != nullptr ) {
+            SharedGroup srcGroup = src->getGroup().lock();
+            if ( srcGroup != nullptr )
+                srcGroup->getAdjacentEdges().insert( weakEdge, edge.get() );
+        }
+        SharedNode dst = edge->getDst().lock();
+        if ( dst != nullptr ) {
+            SharedGroup dstGroup = dst->getGroup().lock();
+            if ( dstGroup != nullptr )
+                dstGroup->getAdjacentEdges().insert( weakEdge, edge.get() );
         }
     }
 }
@@ -208,22 +228,20 @@ void    GraphGroupAjacentEdgesBehaviour< Config >::edgeInserted( WeakEdge& weakE
 template < class Config >
 void    GraphGroupAjacentEdgesBehaviour< Config >::edgeRemoved( WeakEdge& weakEdge ) noexcept
 {
-    if ( !weakEdge.expired() ) {
-        SharedEdge edge = weakEdge.lock();
-        if ( edge != nullptr ) {
-            // If either src or dst is inside a group, remove edge from group adjacent edge set
-            SharedNode src = edge->getSrc().lock();
-            if ( src != nullptr ) {
-                SharedGroup srcGroup = src->getGroup().lock();
-                if ( srcGroup != nullptr )
-                    Config::template remove<WeakEdgesSearch>::from( srcGroup->getAdjacentEdges(), weakEdge );
-            }
-            SharedNode dst = edge->getDst().lock();
-            if ( dst != nullptr ) {
-                SharedGroup dstGroup = dst->getGroup().lock();
-                if ( dstGroup != nullptr )
-                    Config::template remove<WeakEdgesSearch>::from( dstGroup->getAdjacentEdges(), weakEdge );
-            }
+    SharedEdge edge = weakEdge.lock();
+    if ( edge != nullptr ) {
+        // If either src or dst is inside a group, remove edge from group adjacent edge set
+        SharedNode src = edge->getSrc().lock();
+        if ( src != nullptr ) {
+            SharedGroup srcGroup = src->getGroup().lock();
+            if ( srcGroup != nullptr )
+                srcGroup->getAdjacentEdges().erase( edge.get() );
+        }
+        SharedNode dst = edge->getDst().lock();
+        if ( dst != nullptr ) {
+            SharedGroup dstGroup = dst->getGroup().lock();
+            if ( dstGroup != nullptr )
+                dstGroup->getAdjacentEdges().erase( edge.get() );
         }
     }
 }
@@ -0,0 +1,172 @@
+/*
+    The MIT License (MIT)
+
+    Copyright (c) 2016 Benoit AUTHEMAN
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	gtpoCountedSet.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef gtpoCountedSet_h
+#define gtpoCountedSet_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <memory>           // std::weak_ptr
+#include <utility>          // std::move
+#include <vector>
+#include <unordered_map>
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Counted set of std::weak_ptr keyed by their owner pointer.
+ *
+ * Used for group adjacent edges: an edge is referenced once per endpoint inside the group, and stay in the
+ * set while its count is not zero. Elements are keyed by their owner raw pointer, insertion, release and
+ * lookup are O(1) expected and never lock or hash a std::weak_ptr.
+ *
+ * Elements are stored contiguously and iterated as a container of std::weak_ptr (the container interface
+ * used by gtpo::find_weak_ptr() or range for loops), removal move last element in the removed element slot,
+ * iteration order is thus unspecified (like the std::unordered_set it replaces).
+ */
+template < class T >
+class CountedSet
+{
+public:
+    using Key               = const T*;
+    using value_type        = std::weak_ptr< T >;
+    using size_type         = std::size_t;
+    using Elements          = std::vector< value_type >;
+    using const_iterator    = typename Elements::const_iterator;
+    using iterator          = const_iterator;
+
+    CountedSet() = default;
+    ~CountedSet() = default;
+    CountedSet( const CountedSet& ) = default;
+    CountedSet& operator=( const CountedSet& ) = default;
+    CountedSet( CountedSet&& ) = default;
+    CountedSet& operator=( CountedSet&& ) = default;
+
+public:
+    inline auto begin() const noexcept -> const_iterator { return _elements.cbegin(); }
+    inline auto end() const noexcept -> const_iterator { return _elements.cend(); }
+    inline auto cbegin() const noexcept -> const_iterator { return _elements.cbegin(); }
+    inline auto cend() const noexcept -> const_iterator { return _elements.cend(); }
+
+    inline auto size() const noexcept -> size_type { return _elements.size(); }
+    inline auto empty() const noexcept -> bool { return _elements.empty(); }
+
+    //! Return true if an element with owner \c key is registered, O(1).
+    inline auto contains( Key key ) const noexcept -> bool { return _slots.find( key ) != _slots.cend(); }
+    //! Return element with owner \c key reference count (0 if \c key is not registered), O(1).
+    inline auto getCount( Key key ) const noexcept -> size_type {
+        const auto slot = _slots.find( key );
+        return slot != _slots.cend() ? slot->second.count : 0;
+    }
+
+public:
+    /*! \brief Reference \c element (with owner \c key) \c count times.
+     *
+     * \return true if \c element was not previously registered.
+     */
+    auto    insert( const value_type& element, Key key, size_type count = 1 ) -> bool {
+        if ( key == nullptr || count == 0 )
+            return false;
+        auto slot = _slots.find( key );
+        if ( slot != _slots.end() ) {
+            slot->second.count += count;
+            return false;
+        }
+        _elements.emplace_back( element );
+        _keys.emplace_back( key );
+        _slots.emplace( key, Slot{ _elements.size() - 1, count } );
+        return true;
+    }
+
+    /*! \brief Release \c count references on element with owner \c key, element is removed when its count reach 0.
+     *
+     * \return true if the element has been removed.
+     */
+    auto    release( Key key, size_type count = 1 ) noexcept -> bool {
+        auto slot = _slots.find( key );
+        if ( slot == _slots.end() )
+            return false;
+        if ( slot->second.count > count ) {
+            slot->second.count -= count;
+            return false;
+        }
+        eraseSlot( slot );
+        return true;
+    }
+
+    //! Remove element with owner \c key whatever its count is, return true if the element has been removed.
+    auto    erase( Key key ) noexcept -> bool {
+        auto slot = _slots.find( key );
+        if ( slot == _slots.end() )
+            return false;
+        eraseSlot( slot );
+        return true;
+    }
+
+    auto    reserve( size_type capacity ) -> void {
+        _elements.reserve( capacity );
+        _keys.reserve( capacity );
+        _slots.reserve( capacity );
+    }
+
+    auto    clear() noexcept -> void {
+        _elements.clear();
+        _keys.clear();
+        _slots.clear();
+    }
+
+private:
+    struct Slot {
+        size_type   index;
+        size_type   count;
+    };
+    using Slots = std::unordered_map< Key, Slot >;
+
+    auto    eraseSlot( typename Slots::iterator slot ) noexcept -> void {
+        const size_type index = slot->second.index;
+        const size_type last = _elements.size() - 1;
+        if ( index != last ) {      // Move last element in the removed element slot
+            _elements[ index ] = std::move( _elements[ last ] );
+            _keys[ index ] = _keys[ last ];
+            _slots.find( _keys[ index ] )->second.index = index;
+        }
+        _elements.pop_back();
+        _keys.pop_back();
+        _slots.erase( slot );
+    }
+
+    Elements            _elements;
+    std::vector< Key >  _keys;
+    Slots               _slots;
+};
+
+} // ::gtpo
+
+#endif // gtpoCountedSet_h
@@ -0,0 +1,228 @@
+/*
+    The MIT License (MIT)
+
+    Copyright (c) 2016 Benoit AUTHEMAN
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	gtpoCsrSnapshot.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef gtpoCsrSnapshot_h
+#define gtpoCsrSnapshot_h
+
+// STD headers
+#include <cstdint>
+#include <cstddef>          // std::size_t
+#include <vector>
+#include <memory>           // std::weak_ptr
+#include <limits>
+#include <unordered_map>
+
+// GTpo headers
+#include "./gtpoUtils.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Immutable compressed sparse row (CSR) snapshot of a graph topology.
+ *
+ * Nodes are given dense indices in 0..N-1 (following graph main nodes container order), node to node
+ * edges dense indices in 0..E-1 (following graph main edges container order). Out and in adjacency are
+ * stored in contiguous offsets/targets arrays, iterating a node neighbours does not lock any weak_ptr.
+ * Snapshot is built in one O(N+E) pass and keep weak references to original primitives, mapping dense
+ * indices back to graph primitives is O(1).
+ *
+ * A snapshot does not reference its source graph: once built on the thread owning the graph, it could be
+ * moved to a worker thread for analytics kernels (traversals, components, layouts) while the live graph is
+ * still edited. Do not lock the returned weak references outside of the graph owning thread.
+ *
+ * \note Hyper edges (edges with an edge destination) and edges whose endpoints are not in graph are not
+ * part of the snapshot.
+ *
+ * \code
+ * gtpo::CsrSnapshot< stpo::Graph > csr{ graph };
+ * for ( auto n = 0u; n < csr.getNodeCount(); ++n )
+ *   for ( auto dst : csr.getOutNodes( n ) )
+ *     std::cout << n << "->" << dst << std::endl;
+ * \endcode
+ */
+template < class Graph >
+class CsrSnapshot
+{
+public:
+    using Index     = std::uint32_t;
+    using Indices   = std::vector< Index >;
+    using Node      = typename Graph::Configuration::Node;
+    using Edge      = typename Graph::Configuration::Edge;
+    using WeakNode  = typename Graph::WeakNode;
+    using WeakEdge  = typename Graph::WeakEdge;
+
+    //! Index value returned for primitives not in snapshot.
+    static constexpr Index  invalidIndex = std::numeric_limits< Index >::max();
+
+    //! Contiguous read only range of indices (valid as long as the snapshot is alive).
+    class IndexRange
+    {
+    public:
+        IndexRange( const Index* first, const Index* last ) noexcept : _first{ first }, _last{ last } { }
+        inline auto begin() const noexcept -> const Index* { return _first; }
+        inline auto end() const noexcept -> const Index* { return _last; }
+        inline auto size() const noexcept -> std::size_t { return static_cast< std::size_t >( _last - _first ); }
+        inline auto empty() const noexcept -> bool { return _first == _last; }
+        inline auto operator[]( std::size_t i ) const noexcept -> Index { return _first[ i ]; }
+    private:
+        const Index*    _first;
+        const Index*    _last;
+    };
+
+    CsrSnapshot() noexcept = default;
+    //! Build a snapshot of \c graph actual topology, O(N+E). \throw gtpo::bad_topology_error if graph is too large to be indexed.
+    explicit CsrSnapshot( const Graph& graph ) noexcept( false ) { build( graph ); }
+    ~CsrSnapshot() noexcept = default;
+
+    CsrSnapshot( const CsrSnapshot& ) = default;
+    CsrSnapshot& operator=( const CsrSnapshot& ) = default;
+    CsrSnapshot( CsrSnapshot&& ) noexcept = default;
+    CsrSnapshot& operator=( CsrSnapshot&& ) noexcept = default;
+
+public:
+    inline auto getNodeCount() const noexcept -> Index { return static_cast< Index >( _nodes.size() ); }
+    inline auto getEdgeCount() const noexcept -> Index { return static_cast< Index >( _edges.size() ); }
+
+    inline auto getOutDegree( Index node ) const noexcept -> Index { return _outOffsets[ node + 1 ] - _outOffsets[ node ]; }
+    inline auto getInDegree( Index node ) const noexcept -> Index { return _inOffsets[ node + 1 ] - _inOffsets[ node ]; }
+
+    //! Return destination node indices of \c node out edges (parallel edges lead to duplicate indices).
+    inline auto getOutNodes( Index node ) const noexcept -> IndexRange { return range( _outTargets, _outOffsets, node ); }
+    //! Return edge indices of \c node out edges, in the same order than getOutNodes().
+    inline auto getOutEdges( Index node ) const noexcept -> IndexRange { return range( _outEdges, _outOffsets, node ); }
+    //! Return source node indices of \c node in edges.
+    inline auto getInNodes( Index node ) const noexcept -> IndexRange { return range( _inSources, _inOffsets, node ); }
+    //! Return edge indices of \c node in edges, in the same order than getInNodes().
+    inline auto getInEdges( Index node ) const noexcept -> IndexRange { return range( _inEdges, _inOffsets, node ); }
+
+    inline auto getEdgeSrc( Index edge ) const noexcept -> Index { return _edgeSrc[ edge ]; }
+    inline auto getEdgeDst( Index edge ) const noexcept -> Index { return _edgeDst[ edge ]; }
+
+    //! Raw CSR arrays, out targets of node n are in [getOutOffsets()[n], getOutOffsets()[n+1]).
+    inline auto getOutOffsets() const noexcept -> const Indices& { return _outOffsets; }
+    inline auto getOutTargets() const noexcept -> const Indices& { return _outTargets; }
+    inline auto getInOffsets() const noexcept -> const Indices& { return _inOffsets; }
+    inline auto getInSources() const noexcept -> const Indices& { return _inSources; }
+
+public:
+    //! Map a snapshot node index back to its graph node (might be expired if node has since been removed from graph).
+    inline auto getNode( Index node ) const noexcept -> const WeakNode& { return _nodes[ node ]; }
+    //! Map a snapshot edge index back to its graph edge (might be expired if edge has since been removed from graph).
+    inline auto getEdge( Index edge ) const noexcept -> const WeakEdge& { return _edges[ edge ]; }
+
+    //! Return snapshot index of \c node, or invalidIndex if \c node was not in graph when snapshot was built.
+    inline auto getNodeIndex( const Node* node ) const noexcept -> Index {
+        const auto nodeIndex = _nodeIndices.find( node );
+        return nodeIndex != _nodeIndices.cend() ? nodeIndex->second : invalidIndex;
+    }
+    inline auto getNodeIndex( const WeakNode& node ) const noexcept -> Index { return getNodeIndex( node.lock().get() ); }
+
+private:
+    inline auto range( const Indices& values, const Indices& offsets, Index node ) const noexcept -> IndexRange {
+        return IndexRange{ values.data() + offsets[ node ], values.data() + offsets[ node + 1 ] };
+    }
+
+    auto    build( const Graph& graph ) noexcept( false ) -> void {
+        const auto& nodes = graph.getNodes();
+        const auto& edges = graph.getEdges();
+        assert_throw( static_cast< std::size_t >( nodes.size() ) < invalidIndex &&
+                      static_cast< std::size_t >( edges.size() ) < invalidIndex,
+                      "gtpo::CsrSnapshot<>::build(): Error: graph is too large to be indexed." );
+        const auto nodeCount = static_cast< Index >( nodes.size() );
+
+        _nodes.reserve( nodeCount );
+        _nodeIndices.reserve( nodeCount );
+        for ( const auto& node : nodes ) {
+            _nodeIndices.emplace( node.get(), static_cast< Index >( _nodes.size() ) );
+            _nodes.emplace_back( node );
+        }
+
+        // Resolve edges endpoints and count degrees
+        _outOffsets.assign( nodeCount + 1, 0 );
+        _inOffsets.assign( nodeCount + 1, 0 );
+        _edges.reserve( edges.size() );
+        _edgeSrc.reserve( edges.size() );
+        _edgeDst.reserve( edges.size() );
+        for ( const auto& edge : edges ) {
+            const auto src = getNodeIndex( edge->getSrc().lock().get() );
+            const auto dst = getNodeIndex( edge->getDst().lock().get() );  // Hyper edges have no destination node
+            if ( src == invalidIndex || dst == invalidIndex )
+                continue;
+            _edges.emplace_back( edge );
+            _edgeSrc.push_back( src );
+            _edgeDst.push_back( dst );
+            ++_outOffsets[ src + 1 ];
+            ++_inOffsets[ dst + 1 ];
+        }
+        for ( Index n = 0; n < nodeCount; ++n ) {   // Prefix sum degrees to offsets
+            _outOffsets[ n + 1 ] += _outOffsets[ n ];
+            _inOffsets[ n + 1 ] += _inOffsets[ n ];
+        }
+
+        // Scatter edges in adjacency arrays, preserving graph edges order for a given node
+        const auto edgeCount = getEdgeCount();
+        _outTargets.resize( edgeCount );
+        _outEdges.resize( edgeCount );
+        _inSources.resize( edgeCount );
+        _inEdges.resize( edgeCount );
+        Indices outCursor( _outOffsets.cbegin(), _outOffsets.cend() - 1 );
+        Indices inCursor( _inOffsets.cbegin(), _inOffsets.cend() - 1 );
+        for ( Index e = 0; e < edgeCount; ++e ) {
+            const auto src = _edgeSrc[ e ];
+            const auto dst = _edgeDst[ e ];
+            const auto out = outCursor[ src ]++;
+            _outTargets[ out ] = dst;
+            _outEdges[ out ] = e;
+            const auto in = inCursor[ dst ]++;
+            _inSources[ in ] = src;
+            _inEdges[ in ] = e;
+        }
+    }
+
+private:
+    Indices                 _outOffsets;
+    Indices                 _outTargets;
+    Indices                 _outEdges;
+    Indices                 _inOffsets;
+    Indices                 _inSources;
+    Indices                 _inEdges;
+    Indices                 _edgeSrc;
+    Indices                 _edgeDst;
+    std::vector< WeakNode > _nodes;
+    std::vector< WeakEdge > _edges;
+    std::unordered_map< const Node*, Index >    _nodeIndices;
+};
+
+template < class Graph >
+constexpr typename CsrSnapshot< Graph >::Index  CsrSnapshot< Graph >::invalidIndex;
+
+} // ::gtpo
+
+#endif // gtpoCsrSnapshot_h
@@ -0,0 +1,523 @@
+/*
+    The MIT License (MIT)
+
+    Copyright (c) 2016 Benoit AUTHEMAN
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	gtpoDenseGraph.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef gtpoDenseGraph_h
+#define gtpoDenseGraph_h
+
+// STD headers
+#include <algorithm>      // std::find()
+#include <string>
+#include <vector>
+
+// GTpo headers
+#include "./gtpoUtils.h"
+#include "./gtpoSlotMap.h"
+#include "./gtpoGraph.h"
+
+namespace gtpo { // ::gtpo
+
+struct DenseConfig;
+
+template < class Config >
+class GenDenseNode;
+
+template < class Config >
+class GenDenseEdge;
+
+template < class Config >
+class GenDenseGroup;
+
+/*! \brief Directed edge linking two nodes in a gtpo::DenseStorage graph.
+ *
+ * Dense edges are stored by value in their graph, source and destinations are gtpo::Handle.
+ *
+ * \nosubgrouping
+ */
+template < class Config = DenseConfig >
+class GenDenseEdge : public Config::EdgeBase
+{
+    friend GenGraph< Config, DenseStorage >;   // Graph maintain edge topology
+
+    /*! \name Edge Construction *///-------------------------------------------
+    //@{
+public:
+    using WeakNode      = gtpo::Handle< typename Config::Node >;
+    using WeakEdge      = gtpo::Handle< typename Config::Edge >;
+    using WeakNodes     = typename Config::template NodeContainer< WeakNode >;
+    using WeakEdges     = typename Config::template EdgeContainer< WeakEdge >;
+
+    GenDenseEdge() = default;
+    ~GenDenseEdge() = default;
+    GenDenseEdge( GenDenseEdge&& ) = default;
+    GenDenseEdge& operator=( GenDenseEdge&& ) = default;
+    GenDenseEdge( const GenDenseEdge& ) = delete;
+    GenDenseEdge& operator=( const GenDenseEdge& ) = delete;
+
+    //! Return edge class name (default to "gtpo::Edge").
+    inline std::string  getClassName() const noexcept { return "gtpo::Edge"; }
+    //! Return this edge handle in its graph.
+    inline auto         getHandle() const noexcept -> WeakEdge { return _handle; }
+private:
+    WeakEdge            _handle;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Edge Meta Properties *///----------------------------------------
+    //@{
+public:
+    inline  auto    getSerializable( ) const -> bool { return _serializable; }
+    inline  auto    isSerializable( ) const -> bool { return getSerializable(); }
+    inline  auto    setSerializable( bool serializable ) -> void { _serializable = serializable; }
+private:
+    bool            _serializable = true;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Source / Destination Management *///-----------------------------
+    //@{
+public:
+    inline auto getSrc( ) const noexcept -> WeakNode { return _src; }
+    inline auto getDst( ) const noexcept -> WeakNode { return _dst; }
+private:
+    WeakNode    _src;
+    WeakNode    _dst;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Restricted Hyper Edge Management *///----------------------------
+    //@{
+public:
+    inline auto getHDst() const noexcept -> WeakEdge { return _hDst; }
+    inline auto getInHEdges() const noexcept -> const WeakEdges& { return _inHEdges; }
+    inline auto getInHNodes() const noexcept -> const WeakNodes& { return _inHNodes; }
+    inline auto getInHDegree() const noexcept -> int { return static_cast<int>( _inHEdges.size() ); }
+private:
+    WeakEdge    _hDst;
+    WeakEdges   _inHEdges;
+    WeakNodes   _inHNodes;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+/*! \brief Node with in/out edges handle arrays in a gtpo::DenseStorage graph.
+ *
+ * \nosubgrouping
+ */
+template < class Config = DenseConfig >
+class GenDenseNode : public Config::NodeBase
+{
+    friend GenGraph< Config, DenseStorage >;   // Graph maintain node topology
+
+    /*! \name Node Management *///---------------------------------------------
+    //@{
+public:
+    using WeakNode      = gtpo::Handle< typename Config::Node >;
+    using WeakEdge      = gtpo::Handle< typename Config::Edge >;
+    using WeakGroup     = gtpo::Handle< typename Config::Group >;
+    using WeakNodes     = typename Config::template NodeContainer< WeakNode >;
+    using WeakEdges     = typename Config::template EdgeContainer< WeakEdge >;
+
+    GenDenseNode() = default;
+    ~GenDenseNode() = default;
+    GenDenseNode( GenDenseNode&& ) = default;
+    GenDenseNode& operator=( GenDenseNode&& ) = default;
+    GenDenseNode( const GenDenseNode& ) = delete;
+    GenDenseNode& operator=( const GenDenseNode& ) = delete;
+
+    //! Return node class name (default to "gtpo::Node").
+    inline std::string  getClassName() const noexcept { return "gtpo::Node"; }
+    //! Return this node handle in its graph.
+    inline auto         getHandle() const noexcept -> WeakNode { return _handle; }
+private:
+    WeakNode            _handle;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Node Meta Properties *///----------------------------------------
+    //@{
+public:
+    inline  auto    getSerializable( ) const -> bool { return _serializable; }
+    inline  auto    isSerializable( ) const -> bool { return getSerializable(); }
+    inline  auto    setSerializable( bool serializable ) -> void { _serializable = serializable; }
+    inline  auto    getResizable( ) const -> bool { return _resizable; }
+    inline  auto    isResizable( ) const -> bool { return getResizable(); }
+    inline  auto    setResizable( bool resizable ) -> void { _resizable = resizable; }
+private:
+    bool            _serializable = true;
+    bool            _resizable = true;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Node Edges Management *///---------------------------------------
+    //@{
+public:
+    inline auto     getInEdges() const noexcept -> const WeakEdges& { return _inEdges; }
+    inline auto     getOutEdges() const noexcept -> const WeakEdges& { return _outEdges; }
+
+    inline auto     getInNodes() const noexcept -> const WeakNodes& { return _inNodes; }
+    inline auto     getOutNodes() const noexcept -> const WeakNodes& { return _outNodes; }
+
+    inline auto     getInDegree() const noexcept -> unsigned int { return static_cast<unsigned int>( _inEdges.size() ); }
+    inline auto     getOutDegree() const noexcept -> unsigned int { return static_cast<unsigned int>( _outEdges.size() ); }
+private:
+    WeakEdges       _inEdges;
+    WeakEdges       _outEdges;
+    WeakNodes       _inNodes;
+    WeakNodes       _outNodes;
+    //! Root node cache flag (node is counted in GenGraph::getRootNodeCount()).
+    bool            _root = true;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Node Group Management *///---------------------------------------
+    //@{
+public:
+    inline auto     getGroup( ) const noexcept -> WeakGroup { return _group; }
+private:
+    WeakGroup       _group;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+/*! \brief Group of nodes in a gtpo::DenseStorage graph.
+ *
+ * \nosubgrouping
+ */
+template < class Config = DenseConfig >
+class GenDenseGroup : public Config::GroupBase
+{
+    friend GenGraph< Config, DenseStorage >;   // Graph maintain group topology
+
+public:
+    using WeakNode      = gtpo::Handle< typename Config::Node >;
+    using WeakGroup     = gtpo::Handle< typename Config::Group >;
+    using WeakNodes     = typename Config::template NodeContainer< WeakNode >;
+
+    GenDenseGroup() = default;
+    ~GenDenseGroup() = default;
+    GenDenseGroup( GenDenseGroup&& ) = default;
+    GenDenseGroup& operator=( GenDenseGroup&& ) = default;
+    GenDenseGroup( const GenDenseGroup& ) = delete;
+    GenDenseGroup& operator=( const GenDenseGroup& ) = delete;
+
+    //! Return group class name (default to "gtpo::Group").
+    inline std::string  getClassName() const noexcept { return "gtpo::Group"; }
+    //! Return this group handle in its graph.
+    inline auto         getHandle() const noexcept -> WeakGroup { return _handle; }
+
+    //! Return group's nodes.
+    inline auto getNodes() const noexcept -> const WeakNodes& { return _nodes; }
+    //! Return group registered node count.
+    inline auto getNodeCount( ) const noexcept -> int { return static_cast< int >( _nodes.size() ); }
+    //! Return true if group contains \c node.
+    inline auto hasNode( WeakNode node ) const noexcept -> bool {
+        return std::find( _nodes.cbegin(), _nodes.cend(), node ) != _nodes.cend();
+    }
+private:
+    WeakGroup   _handle;
+    WeakNodes   _nodes;
+};
+
+/*! \brief Default configuration for a gtpo::DenseStorage graph.
+ *
+ * \code
+ *   gtpo::GenGraph< gtpo::DenseConfig > g;
+ *   auto n1 = g.createNode();          // n1 is a gtpo::Handle< gtpo::GenDenseNode<> >
+ *   auto n2 = g.createNode();
+ *   auto e = g.createEdge( n1, n2 );
+ *   for ( auto outEdge : g.getNode( n1 )->getOutEdges() ) { }
+ * \endcode
+ */
+struct DenseConfig :    public GraphConfig,
+                        public StdContainerAccessors,
+                        public PropertiesAccessors< GenDenseNode<DenseConfig>,
+                                                    GenDenseEdge<DenseConfig>,
+                                                    GenDenseGroup<DenseConfig> >
+{
+    //! Primitives are stored in slot maps and referenced by handles.
+    using Storage = DenseStorage;
+
+    //! Concrete final node primitive type.
+    using Node  = GenDenseNode<DenseConfig>;
+    //! Concrete final edge primitive type.
+    using Edge  = GenDenseEdge<DenseConfig>;
+    //! Concrete final group primitive type.
+    using Group = GenDenseGroup<DenseConfig>;
+
+    //! Define the container used to store node handles (default to std::vector).
+    template <class...Ts>
+    using NodeContainer = std::vector<Ts...>;
+
+    //! Define the container used to store edge handles (default to std::vector).
+    template <class...Ts>
+    using EdgeContainer = std::vector<Ts...>;
+};
+
+/*! \brief Directed graph storing its primitives by value in generational slot maps (gtpo::DenseStorage policy).
+ *
+ * Dense graph expose the same topology interface than the default gtpo::SharedStorage graph, but "Weak"
+ * references are 32 bits gtpo::Handle instead of std::weak_ptr: following an edge or a node does not
+ * require any reference counting, and in/out adjacency is stored as handle arrays.
+ *
+ * Primitives content is accessed with getNode(), getEdge() and getGroup(), returned pointers
+ * are invalidated by any insertion or removal in the same primitive container.
+ *
+ * \note Dense graph does not support behaviours nor control nodes, primitive base classes (Config::NodeBase,
+ * Config::EdgeBase and Config::GroupBase) must be movable.
+ * \nosubgrouping
+ */
+template < class Config >
+class GenGraph< Config, DenseStorage > : public Config::GraphBase
+{
+    /*! \name Graph Management *///--------------------------------------------
+    //@{
+public:
+    using Configuration = Config;
+    using Graph         = GenGraph< Config, DenseStorage >;
+
+    using Node          = typename Config::Node;
+    using Edge          = typename Config::Edge;
+    using Group         = typename Config::Group;
+
+    using WeakNode      = gtpo::Handle< Node >;
+    using WeakEdge      = gtpo::Handle< Edge >;
+    using WeakGroup     = gtpo::Handle< Group >;
+    using WeakNodes     = typename Config::template NodeContainer< WeakNode >;
+    using WeakEdges     = typename Config::template EdgeContainer< WeakEdge >;
+
+    using Nodes         = gtpo::SlotMap< Node >;
+    using Edges         = gtpo::SlotMap< Edge >;
+    using Groups        = gtpo::SlotMap< Group >;
+
+    using Size          = typename Nodes::Size;
+
+    GenGraph() noexcept : Config::GraphBase() { }
+    template < class B >
+    explicit GenGraph( B* parent ) noexcept : Config::GraphBase( parent ) { }
+    virtual ~GenGraph() { clear(); }
+
+    GenGraph( const GenGraph& ) = delete;
+    GenGraph& operator=( const GenGraph& ) = delete;
+
+    //! Clear the graph from all its content (nodes, edges, groups), all existing handles become stale.
+    void    clear() noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Node Management *///---------------------------------------
+    //@{
+public:
+    /*! \brief Create node and insert it in the graph an return an handle on it.
+     *
+     * \throw gtpo::bad_topology_error if the node handle space is exhausted.
+     */
+    auto    createNode( ) noexcept( false ) -> WeakNode;
+
+    //! Create a node with the given \c className (only "gtpo::Node" is supported by default).
+    virtual WeakNode    createNode( const std::string& className ) noexcept( false );
+
+    /*! \brief Remove node \c node and all its in/out edges from graph.
+     *
+     * \throw gtpo::bad_topology_error if node handle is stale.
+     */
+    auto    removeNode( WeakNode node ) noexcept( false ) -> void;
+
+    //! Remove all nodes in range \c nodes (stale handles are ignored), O(removed nodes degree).
+    template < class WeakNodesRange >
+    auto    removeNodes( const WeakNodesRange& nodes ) noexcept( false ) -> void {
+        for ( const auto node : nodes )
+            if ( _nodes.contains( node ) )
+                removeNode( node );
+    }
+
+    //! Return the number of nodes actually registered in graph.
+    inline auto getNodeCount( ) const noexcept -> Size { return _nodes.size(); }
+    //! Return the number of root nodes (ie nodes with a zero in degree).
+    inline auto getRootNodeCount( ) const noexcept -> Size { return _rootNodeCount; }
+
+    /*! \brief Test if a given \c node is a root node.
+     *
+     * \throw gtpo::bad_topology_error if node handle is stale.
+     */
+    auto    isRootNode( WeakNode node ) const noexcept( false ) -> bool;
+
+    //! Return true if \c node is a valid handle on a node of this graph, O(1).
+    inline auto contains( WeakNode node ) const noexcept -> bool { return _nodes.contains( node ); }
+
+    //! Return node referenced by \c node, or nullptr if handle is stale.
+    inline auto getNode( WeakNode node ) noexcept -> Node* { return _nodes.get( node ); }
+    inline auto getNode( WeakNode node ) const noexcept -> const Node* { return _nodes.get( node ); }
+
+    //! Graph main nodes container (iteration is contiguous).
+    inline auto getNodes() const noexcept -> const Nodes& { return _nodes; }
+    inline auto begin( ) const noexcept -> typename Nodes::const_iterator { return _nodes.begin( ); }
+    inline auto end( ) const noexcept -> typename Nodes::const_iterator { return _nodes.end( ); }
+    inline auto cbegin() const noexcept -> typename Nodes::const_iterator { return _nodes.cbegin(); }
+    inline auto cend() const noexcept -> typename Nodes::const_iterator { return _nodes.cend(); }
+private:
+    Nodes       _nodes;
+    Size        _rootNodeCount{ 0 };
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Edge Management *///---------------------------------------
+    //@{
+public:
+    /*! \brief Create a directed edge between \c source and \c destination node, then insert it into the graph.
+     *
+     * Complexity is O(1).
+     * \throw a gtpo::bad_topology_error if creation fails (either \c source or \c destination handle is stale).
+     */
+    auto        createEdge( WeakNode source, WeakNode destination ) noexcept( false ) -> WeakEdge;
+
+    /*! \brief Create a directed restricted hyper edge between \c source node and \c destination edge.
+     *
+     * Complexity is O(1).
+     * \throw a gtpo::bad_topology_error if creation fails (either \c source or \c destination handle is stale).
+     */
+    auto        createEdge( WeakNode source, WeakEdge destination ) noexcept( false ) -> WeakEdge;
+
+    //! Create a directed edge of a given \c className (only "gtpo::Edge" is supported by default).
+    virtual WeakEdge    createEdge( const std::string& className, WeakNode source, WeakNode destination ) noexcept( false );
+
+    //! Create a restricted directed hyperedge of a given \c className from \c source node to \c destination edge.
+    virtual WeakEdge    createEdge( const std::string& className, WeakNode source, WeakEdge destination ) noexcept( false );
+
+    /*! \brief Remove first directed edge found between \c source and \c destination node.
+     *
+     * Complexity is O(source out degree).
+     * \throw a gtpo::bad_topology_error if either \c source or \c destination handle is stale.
+     */
+    auto        removeEdge( WeakNode source, WeakNode destination ) noexcept( false ) -> void;
+
+    /*! \brief Remove all directed edge between \c source and \c destination node.
+     *
+     * \throw a gtpo::bad_topology_error if either \c source or \c destination handle is stale.
+     */
+    auto        removeAllEdges( WeakNode source, WeakNode destination ) noexcept( false ) -> void;
+
+    /*! \brief Remove directed edge \c edge (and all its in hyper edges).
+     *
+     * \throw a gtpo::bad_topology_error if \c edge handle is stale.
+     */
+    auto        removeEdge( WeakEdge edge ) noexcept( false ) -> void;
+
+    //! Remove all edges in range \c edges (stale handles are ignored).
+    template < class WeakEdgesRange >
+    auto        removeEdges( const WeakEdgesRange& edges ) noexcept( false ) -> void {
+        for ( const auto edge : edges )
+            if ( _edges.contains( edge ) )
+                removeEdge( edge );
+    }
+
+    //! Look for the first directed edge between \c source and \c destination and return it (null handle if there is no such edge), O(source out degree).
+    auto        findEdge( WeakNode source, WeakNode destination ) const noexcept -> WeakEdge;
+    //! Test if a directed edge exists between nodes \c source and \c destination, O(source out degree).
+    auto        hasEdge( WeakNode source, WeakNode destination ) const noexcept -> bool { return !findEdge( source, destination ).isNull(); }
+    //! Look for the first directed restricted hyper edge between \c source node and \c destination edge.
+    auto        findEdge( WeakNode source, WeakEdge destination ) const noexcept -> WeakEdge;
+    //! Test if a directed restricted hyper edge exists between \c source node and \c destination edge.
+    auto        hasEdge( WeakNode source, WeakEdge destination ) const noexcept -> bool { return !findEdge( source, destination ).isNull(); }
+
+    //! Return the number of edges currently existing in graph.
+    inline auto getEdgeCount( ) const noexcept -> unsigned int { return static_cast<unsigned int>( _edges.size() ); }
+    //! Return the number of (parallel) directed edges between nodes \c source and \c destination, O(source out degree).
+    auto        getEdgeCount( WeakNode source, WeakNode destination ) const noexcept -> unsigned int;
+
+    //! Return true if \c edge is a valid handle on an edge of this graph, O(1).
+    inline auto contains( WeakEdge edge ) const noexcept -> bool { return _edges.contains( edge ); }
+
+    //! Return edge referenced by \c edge, or nullptr if handle is stale.
+    inline auto getEdge( WeakEdge edge ) noexcept -> Edge* { return _edges.get( edge ); }
+    inline auto getEdge( WeakEdge edge ) const noexcept -> const Edge* { return _edges.get( edge ); }
+
+    //! Graph main edges container (iteration is contiguous).
+    inline auto getEdges() const noexcept -> const Edges& { return _edges; }
+private:
+    Edges       _edges;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Group Management *///--------------------------------------
+    //@{
+public:
+    //! Create a new empty group and insert it into the graph.
+    auto        createGroup( ) noexcept( false ) -> WeakGroup;
+
+    //! Create a group with the given \c className (only "gtpo::Group" is supported by default).
+    virtual WeakGroup   createGroup( const std::string& className ) noexcept( false );
+
+    /*! \brief Remove group \c group, group's nodes are not removed from graph, but ungrouped.
+     *
+     * \throw a gtpo::bad_topology_error if \c group handle is stale.
+     */
+    auto        removeGroup( WeakGroup group ) noexcept( false ) -> void;
+
+    //! Return true if a given group \c group is registered in the graph, O(1).
+    inline auto hasGroup( WeakGroup group ) const noexcept -> bool { return _groups.contains( group ); }
+
+    //! Return the number of groups currently existing in graph.
+    inline auto getGroupCount( ) const noexcept -> int { return static_cast<int>( _groups.size() ); }
+
+    //! Return group referenced by \c group, or nullptr if handle is stale.
+    inline auto getGroup( WeakGroup group ) noexcept -> Group* { return _groups.get( group ); }
+    inline auto getGroup( WeakGroup group ) const noexcept -> const Group* { return _groups.get( group ); }
+
+    //! Graph main groups container.
+    inline auto getGroups() const noexcept -> const Groups& { return _groups; }
+
+    /*! \brief Insert \c node in \c group (node is first removed from its actual group if any).
+     *
+     * \throw a gtpo::bad_topology_error if either \c group or \c node handle is stale.
+     */
+    auto        groupNode( WeakGroup group, WeakNode node ) noexcept( false ) -> void;
+
+    /*! \brief Remove \c node from \c group.
+     *
+     * \throw a gtpo::bad_topology_error if either \c group or \c node handle is stale.
+     */
+    auto        ungroupNode( WeakGroup group, WeakNode node ) noexcept( false ) -> void;
+private:
+    Groups      _groups;
+    //@}
+    //-------------------------------------------------------------------------
+
+private:
+    //! Remove first occurrence of \c item in handle container \c container.
+    template < class C, class T >
+    static auto removeOne( C& container, const T& item ) noexcept -> void;
+};
+
+} // ::gtpo
+
+#include "./gtpoDenseGraph.hpp"
+
+#endif // gtpoDenseGraph_h
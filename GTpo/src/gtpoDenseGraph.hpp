@@ -0,0 +1,342 @@
+/*
+    The MIT License (MIT)
+
+    Copyright (c) 2016 Benoit AUTHEMAN
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	gtpoDenseGraph.hpp
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+namespace gtpo { // ::gtpo
+
+/* Dense Graph Management *///-------------------------------------------------
+template < class Config >
+void    GenGraph< Config, DenseStorage >::clear() noexcept
+{
+    _edges.clear();
+    _nodes.clear();
+    _rootNodeCount = 0;
+    _groups.clear();
+}
+
+template < class Config >
+template < class C, class T >
+auto    GenGraph< Config, DenseStorage >::removeOne( C& container, const T& item ) noexcept -> void
+{
+    auto iter = std::find( container.begin(), container.end(), item );
+    if ( iter != container.end() )
+        container.erase( iter );
+}
+//-----------------------------------------------------------------------------
+
+/* Dense Graph Node Management *///--------------------------------------------
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::createNode( ) -> WeakNode
+{
+    WeakNode node = _nodes.emplace();
+    _nodes.get( node )->_handle = node;
+    ++_rootNodeCount;
+    return node;
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::createNode( const std::string& className ) noexcept( false ) -> WeakNode
+{
+    if ( className == "gtpo::Node" )
+        return createNode();
+    return WeakNode{};
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::removeNode( WeakNode node ) -> void
+{
+    Node* nodePtr = _nodes.get( node );
+    gtpo::assert_throw( nodePtr != nullptr, "gtpo::GenGraph<DenseStorage>::removeNode(): Error: trying to remove an expired node." );
+
+    if ( !nodePtr->_group.isNull() )
+        ungroupNode( nodePtr->_group, node );
+
+    // Removing all orphant edges pointing to node (edge removal modify node adjacency, work on copies)
+    const WeakEdges nodeInEdges{ nodePtr->_inEdges };
+    for ( const auto inEdge : nodeInEdges )
+        if ( _edges.contains( inEdge ) )    // Might have already been removed as an hyper edge or a circuit
+            removeEdge( inEdge );
+    const WeakEdges nodeOutEdges{ nodePtr->_outEdges };
+    for ( const auto outEdge : nodeOutEdges )
+        if ( _edges.contains( outEdge ) )
+            removeEdge( outEdge );
+
+    if ( nodePtr->_root )       // Edge removal does not modify _nodes, nodePtr is still valid
+        --_rootNodeCount;
+    _nodes.erase( node );
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::isRootNode( WeakNode node ) const -> bool
+{
+    const Node* nodePtr = _nodes.get( node );
+    assert_throw( nodePtr != nullptr, "gtpo::GenGraph<DenseStorage>::isRootNode(): Error: node is expired." );
+    return nodePtr->getInDegree() == 0 && nodePtr->_root;
+}
+//-----------------------------------------------------------------------------
+
+/* Dense Graph Edge Management *///--------------------------------------------
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::createEdge( WeakNode source, WeakNode destination ) -> WeakEdge
+{
+    Node* sourcePtr = _nodes.get( source );
+    Node* destinationPtr = _nodes.get( destination );
+    if ( sourcePtr == nullptr ||
+         destinationPtr == nullptr )
+        throw gtpo::bad_topology_error( "gtpo::GenGraph<DenseStorage>::createEdge(Node,Node): Insertion of edge failed, either source or destination nodes are expired." );
+
+    WeakEdge edge = _edges.emplace();
+    Edge* edgePtr = _edges.get( edge );
+    edgePtr->_handle = edge;
+    edgePtr->_src = source;
+    edgePtr->_dst = destination;
+
+    Config::template insert< WeakEdges >::into( sourcePtr->_outEdges, edge );
+    Config::template insert< WeakNodes >::into( sourcePtr->_outNodes, destination );
+    Config::template insert< WeakEdges >::into( destinationPtr->_inEdges, edge );
+    Config::template insert< WeakNodes >::into( destinationPtr->_inNodes, source );
+    if ( source != destination &&       // If edge define is a trivial circuit, do not remove destination from root nodes
+         destinationPtr->_root ) {
+        destinationPtr->_root = false;
+        --_rootNodeCount;
+    }
+    return edge;
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::createEdge( WeakNode source, WeakEdge destination ) -> WeakEdge
+{
+    Node* sourcePtr = _nodes.get( source );
+    if ( sourcePtr == nullptr ||
+         !_edges.contains( destination ) )
+        throw gtpo::bad_topology_error( "gtpo::GenGraph<DenseStorage>::createEdge(Node,Edge): Insertion of edge failed, either source node and/or destination edge is expired." );
+
+    WeakEdge edge = _edges.emplace();
+    Edge* edgePtr = _edges.get( edge );     // Get destination after emplace(), edge insertion invalidate edge pointers
+    Edge* destinationPtr = _edges.get( destination );
+    edgePtr->_handle = edge;
+    edgePtr->_src = source;
+    edgePtr->_hDst = destination;
+
+    Config::template insert< WeakEdges >::into( sourcePtr->_outEdges, edge );
+    Config::template insert< WeakEdges >::into( destinationPtr->_inHEdges, edge );
+    Config::template insert< WeakNodes >::into( destinationPtr->_inHNodes, source );
+    // Note: hEdge does not modify root nodes.
+    return edge;
+}
+
+template < class Config >
+typename GenGraph< Config, DenseStorage >::WeakEdge    GenGraph< Config, DenseStorage >::createEdge( const std::string& className, WeakNode src, WeakNode dst ) noexcept( false )
+{
+    return ( className == "gtpo::Edge" ) ? createEdge( src, dst ) : WeakEdge{};
+}
+
+template < class Config >
+typename GenGraph< Config, DenseStorage >::WeakEdge    GenGraph< Config, DenseStorage >::createEdge( const std::string& className, WeakNode src, WeakEdge dst ) noexcept( false )
+{
+    return ( className == "gtpo::Edge" ) ? createEdge( src, dst ) : WeakEdge{};
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::removeEdge( WeakNode source, WeakNode destination ) -> void
+{
+    if ( !_nodes.contains( source ) ||
+         !_nodes.contains( destination ) )
+        throw gtpo::bad_topology_error( "gtpo::GenGraph<DenseStorage>::removeEdge(): Topology error." );
+    const WeakEdge edge = findEdge( source, destination );
+    if ( !edge.isNull() )
+        removeEdge( edge );
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::removeAllEdges( WeakNode source, WeakNode destination ) -> void
+{
+    const Node* sourcePtr = _nodes.get( source );
+    if ( sourcePtr == nullptr ||
+         !_nodes.contains( destination ) )
+        throw gtpo::bad_topology_error( "gtpo::GenGraph<DenseStorage>::removeAllEdges(): Topology error." );
+    WeakEdges edges;
+    for ( const auto outEdge : sourcePtr->_outEdges ) {
+        const Edge* outEdgePtr = _edges.get( outEdge );
+        if ( outEdgePtr != nullptr &&
+             outEdgePtr->_dst == destination )
+            Config::template insert< WeakEdges >::into( edges, outEdge );
+    }
+    for ( const auto edge : edges )
+        removeEdge( edge );
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::removeEdge( WeakEdge edge ) -> void
+{
+    Edge* edgePtr = _edges.get( edge );
+    if ( edgePtr == nullptr )
+        throw gtpo::bad_topology_error( "gtpo::GenGraph<DenseStorage>::removeEdge(): Error: Edge to be removed is already expired." );
+
+    // If there is in hyper edges, remove them since their destination edge is beeing destroyed
+    if ( !edgePtr->_inHEdges.empty() ) {
+        const WeakEdges inHEdges{ edgePtr->_inHEdges };
+        for ( const auto inHEdge : inHEdges )
+            removeEdge( inHEdge );
+        edgePtr = _edges.get( edge );       // Edge removal invalidate edge pointers
+    }
+
+    const WeakNode source = edgePtr->_src;
+    const WeakNode destination = edgePtr->_dst;
+    Node* sourcePtr = _nodes.get( source );
+    if ( sourcePtr != nullptr ) {
+        removeOne( sourcePtr->_outEdges, edge );
+        if ( !destination.isNull() )
+            removeOne( sourcePtr->_outNodes, destination );
+    }
+    Node* destinationPtr = _nodes.get( destination );
+    if ( destinationPtr != nullptr ) {      // Remove edge from destination in edges
+        removeOne( destinationPtr->_inEdges, edge );
+        removeOne( destinationPtr->_inNodes, source );
+        if ( destinationPtr->_inEdges.empty() &&
+             !destinationPtr->_root ) {
+            destinationPtr->_root = true;
+            ++_rootNodeCount;
+        }
+    }
+    Edge* hDestinationPtr = _edges.get( edgePtr->_hDst );
+    if ( hDestinationPtr != nullptr ) {     // Remove edge from hyper destination in hyper edges
+        removeOne( hDestinationPtr->_inHEdges, edge );
+        removeOne( hDestinationPtr->_inHNodes, source );
+    }
+    _edges.erase( edge );
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::findEdge( WeakNode source, WeakNode destination ) const noexcept -> WeakEdge
+{
+    const Node* sourcePtr = _nodes.get( source );
+    if ( sourcePtr == nullptr ||
+         destination.isNull() )
+        return WeakEdge{};
+    for ( const auto outEdge : sourcePtr->_outEdges ) {
+        const Edge* outEdgePtr = _edges.get( outEdge );
+        if ( outEdgePtr != nullptr &&
+             outEdgePtr->_dst == destination )
+            return outEdge;
+    }
+    return WeakEdge{};
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::findEdge( WeakNode source, WeakEdge destination ) const noexcept -> WeakEdge
+{
+    const Node* sourcePtr = _nodes.get( source );
+    if ( sourcePtr == nullptr ||
+         destination.isNull() )
+        return WeakEdge{};
+    for ( const auto outEdge : sourcePtr->_outEdges ) {
+        const Edge* outEdgePtr = _edges.get( outEdge );
+        if ( outEdgePtr != nullptr &&
+             outEdgePtr->_hDst == destination )
+            return outEdge;
+    }
+    return WeakEdge{};
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::getEdgeCount( WeakNode source, WeakNode destination ) const noexcept -> unsigned int
+{
+    const Node* sourcePtr = _nodes.get( source );
+    if ( sourcePtr == nullptr )
+        return 0;
+    unsigned int edgeCount = 0;
+    for ( const auto outEdge : sourcePtr->_outEdges ) {
+        const Edge* outEdgePtr = _edges.get( outEdge );
+        if ( outEdgePtr != nullptr &&
+             outEdgePtr->_dst == destination )
+            ++edgeCount;
+    }
+    return edgeCount;
+}
+//-----------------------------------------------------------------------------
+
+/* Dense Graph Group Management *///-------------------------------------------
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::createGroup( ) -> WeakGroup
+{
+    WeakGroup group = _groups.emplace();
+    _groups.get( group )->_handle = group;
+    return group;
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::createGroup( const std::string& className ) noexcept( false ) -> WeakGroup
+{
+    if ( className == "gtpo::Group" )
+        return createGroup();
+    return WeakGroup{};
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::removeGroup( WeakGroup group ) -> void
+{
+    Group* groupPtr = _groups.get( group );
+    gtpo::assert_throw( groupPtr != nullptr, "gtpo::GenGraph<DenseStorage>::removeGroup(): Error: trying to remove an expired group." );
+    for ( const auto node : groupPtr->_nodes ) {
+        Node* nodePtr = _nodes.get( node );
+        if ( nodePtr != nullptr )
+            nodePtr->_group = WeakGroup{};
+    }
+    _groups.erase( group );
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::groupNode( WeakGroup group, WeakNode node ) -> void
+{
+    Group* groupPtr = _groups.get( group );
+    Node* nodePtr = _nodes.get( node );
+    gtpo::assert_throw( groupPtr != nullptr && nodePtr != nullptr, "gtpo::GenGraph<DenseStorage>::groupNode(): Error: either group or node is expired." );
+    if ( nodePtr->_group == group )
+        return;
+    if ( !nodePtr->_group.isNull() )
+        ungroupNode( nodePtr->_group, node );
+    Config::template insert< WeakNodes >::into( groupPtr->_nodes, node );
+    nodePtr->_group = group;
+}
+
+template < class Config >
+auto    GenGraph< Config, DenseStorage >::ungroupNode( WeakGroup group, WeakNode node ) -> void
+{
+    Group* groupPtr = _groups.get( group );
+    Node* nodePtr = _nodes.get( node );
+    gtpo::assert_throw( groupPtr != nullptr && nodePtr != nullptr, "gtpo::GenGraph<DenseStorage>::ungroupNode(): Error: either group or node is expired." );
+    removeOne( groupPtr->_nodes, node );
+    if ( nodePtr->_group == group )
+        nodePtr->_group = WeakGroup{};
+}
+//-----------------------------------------------------------------------------
+
+} // ::gtpo
@@ -0,0 +1,317 @@
+/*
+    The MIT License (MIT)
+
+    Copyright (c) 2016 Benoit AUTHEMAN
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	gtpoGeometryStore.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef gtpoGeometryStore_h
+#define gtpoGeometryStore_h
+
+// STD headers
+#include <cstdint>          // std::uintptr_t
+#include <cstddef>          // std::size_t
+#include <vector>
+#include <memory>           // std::weak_ptr
+#include <limits>
+#include <new>              // ::operator new std::bad_alloc
+#include <unordered_map>
+
+// GTpo headers
+#include "./gtpoUtils.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Standard allocator returning memory aligned on \c Alignment bytes (for SIMD loads on geometry arrays).
+ *
+ * \note C++14 ::operator new does not support over-aligned requests, memory is over allocated and the
+ * original pointer is stored just before the aligned block.
+ */
+template < class T, std::size_t Alignment = 32 >
+class AlignedAllocator
+{
+    static_assert( Alignment >= alignof( void* ) && ( Alignment & ( Alignment - 1 ) ) == 0,
+                   "gtpo::AlignedAllocator<>: Alignment must be a power of two larger than pointer alignment." );
+public:
+    using value_type = T;
+    template < class U >
+    struct rebind { using other = AlignedAllocator< U, Alignment >; };
+
+    AlignedAllocator() noexcept = default;
+    template < class U >
+    AlignedAllocator( const AlignedAllocator< U, Alignment >& ) noexcept { }
+
+    auto    allocate( std::size_t n ) -> T* {
+        if ( n > ( std::numeric_limits< std::size_t >::max() - Alignment - sizeof( void* ) ) / sizeof( T ) )
+            throw std::bad_alloc{};
+        void* raw = ::operator new( n * sizeof( T ) + Alignment + sizeof( void* ) );
+        const auto first = reinterpret_cast< std::uintptr_t >( raw ) + sizeof( void* );
+        void* aligned = reinterpret_cast< void* >( ( first + Alignment - 1 ) & ~static_cast< std::uintptr_t >( Alignment - 1 ) );
+        static_cast< void** >( aligned )[ -1 ] = raw;
+        return static_cast< T* >( aligned );
+    }
+    auto    deallocate( T* p, std::size_t ) noexcept -> void {
+        if ( p != nullptr )
+            ::operator delete( reinterpret_cast< void** >( p )[ -1 ] );
+    }
+};
+
+template < class T, class U, std::size_t Alignment >
+inline bool operator==( const AlignedAllocator< T, Alignment >&, const AlignedAllocator< U, Alignment >& ) noexcept { return true; }
+template < class T, class U, std::size_t Alignment >
+inline bool operator!=( const AlignedAllocator< T, Alignment >&, const AlignedAllocator< U, Alignment >& ) noexcept { return false; }
+
+/*! \brief Structure of arrays (SoA) geometry for a set of primitives, one slot per primitive.
+ *
+ * Arrays are contiguous and aligned on 32 bytes, loops over a single coordinate could be vectorized by
+ * the compiler (or written with SIMD intrinsics).
+ */
+class GeometryArrays
+{
+public:
+    using Values = std::vector< double, AlignedAllocator< double, 32 > >;
+
+    Values  x, y, z, width, height;
+
+    inline auto size() const noexcept -> std::size_t { return x.size(); }
+    inline auto empty() const noexcept -> bool { return x.empty(); }
+
+    auto    resize( std::size_t size ) -> void {
+        x.resize( size ); y.resize( size ); z.resize( size ); width.resize( size ); height.resize( size );
+    }
+    auto    clear() noexcept -> void {
+        x.clear(); y.clear(); z.clear(); width.clear(); height.clear();
+    }
+
+    //! Bounding box of all slots geometry, \c left/top/right/bottom are left unmodified if arrays are empty.
+    auto    getBoundingBox( double& left, double& top, double& right, double& bottom ) const noexcept -> bool {
+        const auto count = size();
+        if ( count == 0 )
+            return false;
+        const double* xs = x.data(); const double* ys = y.data();
+        const double* ws = width.data(); const double* hs = height.data();
+        double minX = xs[ 0 ], minY = ys[ 0 ];
+        double maxX = xs[ 0 ] + ws[ 0 ], maxY = ys[ 0 ] + hs[ 0 ];
+        for ( std::size_t s = 0; s < count; ++s ) {     // Branch free body, vectorizable
+            minX = xs[ s ] < minX ? xs[ s ] : minX;
+            minY = ys[ s ] < minY ? ys[ s ] : minY;
+            const double r = xs[ s ] + ws[ s ];
+            const double b = ys[ s ] + hs[ s ];
+            maxX = r > maxX ? r : maxX;
+            maxY = b > maxY ? b : maxY;
+        }
+        left = minX; top = minY; right = maxX; bottom = maxY;
+        return true;
+    }
+
+    //! Translate all slots by \c dx, \c dy.
+    auto    translate( double dx, double dy ) noexcept -> void {
+        const auto count = size();
+        double* xs = x.data(); double* ys = y.data();
+        for ( std::size_t s = 0; s < count; ++s ) {
+            xs[ s ] += dx;
+            ys[ s ] += dy;
+        }
+    }
+};
+
+/*! \brief Optional structure of arrays store for nodes and groups geometry (x, y, z, width, height).
+ *
+ * Layout and spatial algorithms usually read and write geometry one primitive at a time through the
+ * Config properties accessors (getX(), getY(), setX(), ...), for some configurations (QuickQanava for
+ * example), every access is a virtual call on a scattered heap object. GeometryStore load geometry once
+ * in contiguous aligned arrays indexed by a dense slot (following graph nodes and groups containers order),
+ * algorithms then work on arrays and modified geometry is written back to primitives in a single pass with
+ * commit().
+ *
+ * Use GeometryStore::BatchScope to run a layout inside a graph batch (see gtpo::GenGraph::beginBatch()),
+ * geometry is committed before batch notifications are sent:
+ * \code
+ * gtpo::GeometryStore< stpo::Graph > store{ graph };
+ * {
+ *   gtpo::GeometryStore< stpo::Graph >::BatchScope batch{ store };
+ *   auto& nodes = store.getNodes();
+ *   for ( std::size_t n = 0; n < nodes.size(); ++n )
+ *     nodes.x[ n ] += 10.;
+ * }  // Geometry written back to graph nodes here
+ * \endcode
+ *
+ * \note Store keep a reference on its graph, it must not outlive it. Primitives inserted after load() are
+ * not part of the store (call load() again), primitives removed since load() are ignored by commit().
+ */
+template < class Graph >
+class GeometryStore
+{
+public:
+    using Config    = typename Graph::Configuration;
+    using Node      = typename Config::Node;
+    using Group     = typename Config::Group;
+    using WeakNode  = typename Graph::WeakNode;
+    using WeakGroup = typename Graph::WeakGroup;
+    using Slot      = std::size_t;
+
+    //! Slot value returned for primitives not in store.
+    static constexpr Slot   invalidSlot = std::numeric_limits< Slot >::max();
+
+    //! Build a store and load \c graph nodes and groups actual geometry.
+    explicit GeometryStore( Graph& graph ) : _graph( graph ) { load(); }
+    ~GeometryStore() noexcept = default;
+    GeometryStore( const GeometryStore& ) = delete;
+    GeometryStore& operator=( const GeometryStore& ) = delete;
+
+    inline auto getGraph() noexcept -> Graph& { return _graph; }
+
+public:
+    //! Clear the store and load actual geometry of all graph nodes and groups, O(N).
+    auto    load() -> void {
+        _nodes.clear();
+        _nodeSlots.clear();
+        _weakNodes.clear();
+        const auto& nodes = _graph.getNodes();
+        _nodes.resize( nodes.size() );
+        _weakNodes.reserve( nodes.size() );
+        _nodeSlots.reserve( nodes.size() );
+        for ( const auto& node : nodes ) {
+            const auto s = _weakNodes.size();
+            _nodeSlots.emplace( node.get(), s );
+            _weakNodes.emplace_back( node );
+            read( node.get(), _nodes, s );
+        }
+        _groups.clear();
+        _groupSlots.clear();
+        _weakGroups.clear();
+        const auto& groups = _graph.getGroups();
+        _groups.resize( groups.size() );
+        _weakGroups.reserve( groups.size() );
+        _groupSlots.reserve( groups.size() );
+        for ( const auto& group : groups ) {
+            const auto s = _weakGroups.size();
+            _groupSlots.emplace( group.get(), s );
+            _weakGroups.emplace_back( group );
+            read( group.get(), _groups, s );
+        }
+    }
+
+    //! Write arrays geometry back to all store nodes and groups still in graph, O(N).
+    auto    commit() noexcept -> void {
+        for ( Slot s = 0; s < _weakNodes.size(); ++s ) {
+            auto node = _weakNodes[ s ].lock();
+            if ( node )
+                write( node.get(), _nodes, s );
+        }
+        for ( Slot s = 0; s < _weakGroups.size(); ++s ) {
+            auto group = _weakGroups[ s ].lock();
+            if ( group )
+                write( group.get(), _groups, s );
+        }
+    }
+
+    /*! \brief RAII graph batch scope committing store geometry when the scope is closed.
+     *
+     * Geometry is committed before the graph batch is ended: behaviours notified at the end of the batch
+     * see the final geometry.
+     */
+    class BatchScope
+    {
+    public:
+        explicit BatchScope( GeometryStore& store ) noexcept : _store( store ) { _store.getGraph().beginBatch(); }
+        ~BatchScope() noexcept( false ) {
+            _store.commit();
+            _store.getGraph().endBatch();
+        }
+        BatchScope( const BatchScope& ) = delete;
+        BatchScope& operator=( const BatchScope& ) = delete;
+    private:
+        GeometryStore&  _store;
+    };
+
+public:
+    //! Nodes geometry arrays, indexed by node slot (see getNodeSlot()).
+    inline auto getNodes() noexcept -> GeometryArrays& { return _nodes; }
+    inline auto getNodes() const noexcept -> const GeometryArrays& { return _nodes; }
+    //! Groups geometry arrays, indexed by group slot (see getGroupSlot()).
+    inline auto getGroups() noexcept -> GeometryArrays& { return _groups; }
+    inline auto getGroups() const noexcept -> const GeometryArrays& { return _groups; }
+
+    //! Return slot of \c node in getNodes() arrays, or invalidSlot if \c node was not in graph on last load().
+    inline auto getNodeSlot( const Node* node ) const noexcept -> Slot {
+        const auto slot = _nodeSlots.find( node );
+        return slot != _nodeSlots.cend() ? slot->second : invalidSlot;
+    }
+    inline auto getNodeSlot( const WeakNode& node ) const noexcept -> Slot { return getNodeSlot( node.lock().get() ); }
+    //! Return slot of \c group in getGroups() arrays, or invalidSlot if \c group was not in graph on last load().
+    inline auto getGroupSlot( const Group* group ) const noexcept -> Slot {
+        const auto slot = _groupSlots.find( group );
+        return slot != _groupSlots.cend() ? slot->second : invalidSlot;
+    }
+    inline auto getGroupSlot( const WeakGroup& group ) const noexcept -> Slot { return getGroupSlot( group.lock().get() ); }
+
+    //! Map a node slot back to its graph node (might be expired).
+    inline auto getNode( Slot slot ) const noexcept -> const WeakNode& { return _weakNodes[ slot ]; }
+    //! Map a group slot back to its graph group (might be expired).
+    inline auto getGroup( Slot slot ) const noexcept -> const WeakGroup& { return _weakGroups[ slot ]; }
+
+private:
+    template < class Primitive >
+    static inline auto  read( const Primitive* primitive, GeometryArrays& arrays, Slot s ) noexcept -> void {
+        arrays.x[ s ] = Config::getX( primitive );
+        arrays.y[ s ] = Config::getY( primitive );
+        arrays.z[ s ] = Config::getZ( primitive );
+        arrays.width[ s ] = Config::getWidth( primitive );
+        arrays.height[ s ] = Config::getHeight( primitive );
+    }
+    static inline auto  write( Node* node, const GeometryArrays& arrays, Slot s ) noexcept -> void {
+        Config::setX( node, arrays.x[ s ] );
+        Config::setNodeY( node, arrays.y[ s ] );
+        Config::setZ( node, arrays.z[ s ] );
+        Config::setWidth( node, arrays.width[ s ] );
+        Config::setHeight( node, arrays.height[ s ] );
+    }
+    static inline auto  write( Group* group, const GeometryArrays& arrays, Slot s ) noexcept -> void {
+        Config::setX( group, arrays.x[ s ] );
+        Config::setY( group, arrays.y[ s ] );
+        Config::setZ( group, arrays.z[ s ] );
+        Config::setWidth( group, arrays.width[ s ] );
+        Config::setHeight( group, arrays.height[ s ] );
+    }
+
+private:
+    Graph&                                      _graph;
+    GeometryArrays                              _nodes;
+    GeometryArrays                              _groups;
+    std::vector< WeakNode >                     _weakNodes;
+    std::vector< WeakGroup >                    _weakGroups;
+    std::unordered_map< const Node*, Slot >     _nodeSlots;
+    std::unordered_map< const Group*, Slot >    _groupSlots;
+};
+
+template < class Graph >
+constexpr typename GeometryStore< Graph >::Slot GeometryStore< Graph >::invalidSlot;
+
+} // ::gtpo
+
+#endif // gtpoGeometryStore_h
@@ -35,21 +35,102 @@
 
 // STD headers
 #include <list>
+#include <vector>
+#include <algorithm>        // std::remove_if
 #include <unordered_set>
+#include <unordered_map>
 #include <memory>           // std::shared_ptr std::weak_ptr and std::make_shared
 #include <functional>       // std::hash
 #include <cassert>
 #include <iterator>         // std::back_inserter
+#include <type_traits>      // std::is_same
 
 // GTpo headers
 #include "./gtpoUtils.h"
 #include "./gtpoBehaviour.h"
+#include "./gtpoPool.h"
+#include "./gtpoSmallVector.h"
+#include "./gtpoCountedSet.h"
+#include "./gtpoSnapshot.h"
 
 /*! \brief Main GTpo namespace (\#include \<GTpo\>).
  */
 namespace gtpo { // ::gtpo
 
-template <class Config>
+struct DefaultConfig;
+
+/*! \brief Default GTpo storage policy: primitives are owned by the graph with std::shared_ptr and referenced with std::weak_ptr.
+ *
+ * Select a storage policy with the \c Storage type of a graph configuration (see gtpo::GraphConfig::Storage).
+ */
+struct SharedStorage { };
+
+/*! \brief Dense GTpo storage policy: primitives are stored in generational slot maps and referenced with 32 bits gtpo::Handle.
+ *
+ * See gtpoDenseGraph.h and gtpo::DenseConfig.
+ */
+struct DenseStorage { };
+
+/*! \brief Default GTpo removal policy: nodes and edges removal preserve graph main containers order (O(container size)).
+ *
+ * Select a removal policy with the \c Removal type of a graph configuration (see gtpo::GraphConfig::Removal).
+ */
+struct OrderedRemoval { };
+
+/*! \brief Unordered GTpo removal policy: removed nodes and edges are replaced by the last primitive of graph main containers (O(1)).
+ *
+ * Primitives record their position in graph containers, containers must be random access and support the
+ * \c swap_and_pop container accessor (std::vector does with gtpo::StdContainerAccessors). Policy also apply
+ * to group nodes container (see gtpo::GenGroup::removeNode()).
+ */
+struct UnorderedRemoval { };
+
+/*! \brief Default GTpo allocation policy: nodes, edges and groups are allocated on the global heap with std::make_shared.
+ *
+ * Select an allocation policy with the \c Allocation type of a graph configuration (see gtpo::GraphConfig::Allocation).
+ */
+struct HeapAllocation { };
+
+/*! \brief Pooled GTpo allocation policy: nodes, edges and groups are allocated with std::allocate_shared from per graph gtpo::MemoryPool.
+ *
+ * Primitives of a graph are stored contiguously in large chunks, chunks are released at once by clear() when no
+ * primitive (nor std::weak_ptr on a primitive) is still alive.
+ */
+struct PoolAllocation { };
+
+/*! \brief Default GTpo node adjacency policy: node in/out edges and nodes are stored in Config::EdgeContainer and Config::NodeContainer.
+ *
+ * Select an adjacency policy with the \c Adjacency type of a graph configuration (see gtpo::GraphConfig::Adjacency).
+ */
+struct ContainerAdjacency { };
+
+/*! \brief Inline GTpo node adjacency policy: node in/out edges and nodes are stored in a gtpo::SmallVector with \c N inline elements.
+ *
+ * Nodes with a degree lower or equal to \c N do not allocate any memory for their adjacency.
+ */
+template < std::size_t N = 4 >
+struct InlineAdjacency { };
+
+/*! \brief Default GTpo adjacent nodes policy: node in and out nodes are stored along with in and out edges.
+ *
+ * Select an adjacent nodes policy with the \c AdjacentNodes type of a graph configuration (see gtpo::GraphConfig::AdjacentNodes).
+ */
+struct StoredAdjacentNodes { };
+
+/*! \brief Derived GTpo adjacent nodes policy: GenNode::getInNodes() and getOutNodes() are built on demand from in and out edges.
+ *
+ * Save two containers per node, getInNodes() and getOutNodes() return a container by value (O(degree)).
+ */
+struct DerivedAdjacentNodes { };
+
+//! Map a node adjacency policy to the container type used to store \c T adjacency elements (\c Default with gtpo::ContainerAdjacency).
+template < class Adjacency, class T, class Default >
+struct adjacency_container { using type = Default; };
+
+template < std::size_t N, class T, class Default >
+struct adjacency_container< InlineAdjacency< N >, T, Default > { using type = SmallVector< T, N >; };
+
+template < class Config = DefaultConfig, class Storage = typename Config::Storage >
 class GenGraph;
 
 template <class Config>
@@ -84,6 +165,11 @@ struct StdContainerAccessors : public ContainerAccessors {
         static void  into( std::unordered_set<T>& c, T t ) { c.insert( t ); }
     };
 
+    template <typename T, std::size_t N>
+    struct insert< SmallVector<T, N> > {
+        static void  into( SmallVector<T, N>& c, T t ) { c.emplace_back( t ); }
+    };
+
     template <typename T>
     struct remove { };
 
@@ -109,6 +195,61 @@ struct StdContainerAccessors : public ContainerAccessors {
         static void  from( std::vector<std::shared_ptr<T>>& c, const std::shared_ptr<T> t ) {  // https://en.wikipedia.org/wiki/Erase%E2%80%93remove_idiom
             c.erase( std::remove(c.begin(), c.end(), t), c.end()); }
     };
+
+    template <typename T, std::size_t N>
+    struct remove< SmallVector<std::weak_ptr<T>, N> > {
+        static void  from( SmallVector<std::weak_ptr<T>, N>& c, const std::weak_ptr<T> t ) {
+            c.erase( std::remove_if(c.begin(), c.end(), [=](const std::weak_ptr<T>& wp){
+                    return gtpo::compare_weak_ptr( wp, t );
+                }), c.end());
+            }
+    };
+
+    template <typename T>
+    struct remove_if { };
+
+    template <typename T>
+    struct remove_if< std::list<T> > {
+        template <typename P>
+        static void  from( std::list<T>& c, P p ) { c.remove_if( p ); }
+    };
+    template <typename T>
+    struct remove_if< std::vector<T> > {
+        template <typename P>
+        static void  from( std::vector<T>& c, P p ) { c.erase( std::remove_if(c.begin(), c.end(), p), c.end()); }
+    };
+
+    template <typename T, std::size_t N>
+    struct remove_if< SmallVector<T, N> > {
+        template <typename P>
+        static void  from( SmallVector<T, N>& c, P p ) { c.erase( std::remove_if(c.begin(), c.end(), p), c.end()); }
+    };
+
+    template <typename T>
+    struct swap_and_pop { };
+
+    template <typename T>
+    struct swap_and_pop< std::vector<T> > {
+        static void  from( std::vector<T>& c, std::size_t i ) {
+            if ( i + 1 != c.size() )
+                c[i] = std::move( c.back() );
+            c.pop_back();
+        }
+    };
+
+    template <typename T>
+    struct append_range { };
+
+    template <typename T>
+    struct append_range< std::vector<T> > {
+        template <typename R>
+        static void  into( std::vector<T>& c, const R& r ) { c.insert( c.end(), std::begin( r ), std::end( r ) ); }
+    };
+    template <typename T>
+    struct append_range< std::list<T> > {
+        template <typename R>
+        static void  into( std::list<T>& c, const R& r ) { c.insert( c.end(), std::begin( r ), std::end( r ) ); }
+    };
 };
 
 //! Empty interface for graph primitive properties accessors.
@@ -186,6 +327,21 @@ struct GraphConfig
     //! Define gtpo::GenGroup base class.
     using GroupBase = Empty;
 
+    //! Define primitive storage policy, either gtpo::SharedStorage (default) or gtpo::DenseStorage.
+    using Storage   = SharedStorage;
+
+    //! Define node and edge removal policy, either gtpo::OrderedRemoval (default) or gtpo::UnorderedRemoval.
+    using Removal   = OrderedRemoval;
+
+    //! Define nodes, edges and groups allocation policy, either gtpo::HeapAllocation (default) or gtpo::PoolAllocation.
+    using Allocation = HeapAllocation;
+
+    //! Define node in/out adjacency containers policy, either gtpo::ContainerAdjacency (default) or gtpo::InlineAdjacency<N>.
+    using Adjacency = ContainerAdjacency;
+
+    //! Define if node in/out nodes are stored, either gtpo::StoredAdjacentNodes (default) or gtpo::DerivedAdjacentNodes.
+    using AdjacentNodes = StoredAdjacentNodes;
+
     //! Static behaviours that should be used for node (default to empty node behaviour tuple).
     using NodeBehaviours = std::tuple<>;
 
@@ -206,6 +362,10 @@ struct GraphConfig
     //! Define the unordered container used to search for edges and nodes (default to std::unordered_set).
     template <class T>
     using SearchContainer = std::unordered_set<T>;
+
+    //! Define the hashed multi map used to index node out edges by destination (default to std::unordered_multimap).
+    template <class K, class T>
+    using AdjacencyIndex = std::unordered_multimap<K, T>;
 };
 
 /*! Default configuration for GTpo primitive, containers and behaviours.
@@ -266,9 +426,9 @@ public:
 
     GenEdge() : Config::EdgeBase( ) { }
     explicit GenEdge( typename Config::EdgeBase* parent ) : Config::EdgeBase( parent ) { }
-    explicit GenEdge( WeakNode& src, WeakNode& dst ) :
+    explicit GenEdge( const WeakNode& src, const WeakNode& dst ) :
         _src{ src }, _dst{ dst } { }
-    explicit GenEdge( WeakNode& src, WeakEdge& hDst ) :
+    explicit GenEdge( const WeakNode& src, const WeakEdge& hDst ) :
         _src{ src }, _hDst{ hDst } { }
     virtual ~GenEdge() {
         if ( _graph != nullptr )
@@ -280,12 +440,31 @@ public:
 
     //! Return node class name (default to "gtpo::Edge").
     inline std::string  getClassName() const noexcept { return "gtpo::Edge"; }
+    /*! \brief Reset edge graph, source, destinations and in hyper edges so that it could be inserted again.
+     *
+     * Used to recycle edges once they have been removed from their graph, must not be called on an edge registered in a graph.
+     */
+    auto                resetTopology() noexcept -> void {
+        _graph = nullptr;
+        _graphIndex = 0;
+        _batchPending = false;
+        _snapshotSlot = GraphSnapshot<Config>::invalidIndex;
+        _src.reset(); _dst.reset(); _hDst.reset();
+        _hData.reset();
+    }
 protected:
     inline Graph*       getGraph() noexcept { return _graph; }
     inline const Graph* getGraph() const noexcept { return _graph; }
 private:
     void                setGraph( Graph* graph ) { _graph = graph; }
     Graph*              _graph{ nullptr };
+    //! Edge position in graph main edges container (only maintained with gtpo::UnorderedRemoval).
+    std::size_t         _graphIndex{ 0 };
+    //! True while edge insertion notification is deferred by a graph batch (see GenGraph::beginBatch()).
+    bool                _batchPending{ false };
+    friend SnapshotTracker<Config>;
+    //! Edge slot in graph snapshots (only maintained once GenGraph::snapshot() has been called).
+    std::uint32_t       _snapshotSlot{ GraphSnapshot<Config>::invalidIndex };
     //@}
     //-------------------------------------------------------------------------
 
@@ -308,12 +487,23 @@ private:
     //@{
 public:
     inline auto setSrc( WeakNode src ) noexcept -> void { _src = src; }
-    inline auto setDst( WeakNode dst ) noexcept -> void { _dst = dst; }
+    //! Set edge destination, edge is re-indexed in its source out edges index if it has already been inserted (see GenNode::getOutEdgesIndex()).
+    auto        setDst( WeakNode dst ) noexcept -> void;
     inline auto getSrc( ) noexcept -> WeakNode& { return _src; }
     inline auto getSrc( ) const noexcept -> const WeakNode& { return _src; }
     inline auto getDst( ) noexcept -> WeakNode& { return _dst; }
     inline auto getDst( ) const noexcept -> const WeakNode& { return _dst; }
+    //! Return edge key in its source out edges index: its destination node, or its destination edge for restricted hyper edges.
+    inline auto getOutEdgeKey( ) const noexcept -> const void* {
+        auto destination = _dst.lock();
+        if ( destination )
+            return static_cast< const void* >( destination.get() );
+        return static_cast< const void* >( _hDst.lock().get() );
+    }
 private:
+    //! Move this edge from \c previousKey to its current key in its source out edges index.
+    auto        reindexOutEdge( const void* previousKey ) noexcept -> void;
+
     WeakNode    _src;
     WeakNode    _dst;
     //@}
@@ -325,28 +515,56 @@ public:
     using WeakEdges     = typename Config::template EdgeContainer< WeakEdge >;
     using WeakNodes     = typename Config::template NodeContainer< WeakNode >;
 
-    inline auto setHDst( WeakEdge hDst ) noexcept -> void { _hDst = hDst; }
+    //! Set edge hyper destination, edge is re-indexed in its source out edges index if it has already been inserted.
+    auto        setHDst( WeakEdge hDst ) noexcept -> void;
     inline auto getHDst() const noexcept -> const WeakEdge& { return _hDst; }
-    inline auto getInHEdges() const noexcept -> const WeakEdges& { return _inHEdges; }
+    /*! \brief Return restricted in hyper edges (ie in hyper edges with this edge as a destination).
+     *
+     * \note In hyper edges are stored in a side record allocated on first access, use getInHDegree() to
+     * check if an edge has in hyper edges without allocating it.
+     */
+    inline auto getInHEdges() const -> const WeakEdges& { return getHEdgeData().inHEdges; }
     inline auto addInHEdge( WeakEdge inHEdge ) -> void;
     inline auto removeInHEdge( WeakEdge inHEdge ) -> void;
-    inline auto getInHDegree() const noexcept -> int { return static_cast<int>( _inHEdges.size() ); }
+    inline auto getInHDegree() const noexcept -> int { return _hData ? static_cast<int>( _hData->inHEdges.size() ) : 0; }
 
-    inline auto getInHNodes() const noexcept -> const WeakNodes& { return _inHNodes; }
+    //! Return restricted hyper in nodes (ie all source node for in restricted hyper edges), see getInHEdges().
+    inline auto getInHNodes() const -> const WeakNodes& { return getHEdgeData().inHNodes; }
 
 protected:
-    inline auto getInHEdges() noexcept -> WeakEdges& { return _inHEdges; }
+    inline auto getInHEdges() -> WeakEdges& { return getHEdgeData().inHEdges; }
 private:
     //! Restricted hyper edge destination (ie this edge target another edge as destination).
     WeakEdge    _hDst;
-    //! Restricted in hyper edges (ie an in hyper edge with this edge as a destination).
-    WeakEdges   _inHEdges;
-    //! Restricted hyper in nodes (ie all source node for in restricted hyper edges).
-    WeakNodes   _inHNodes;
+
+    //! In hyper edges bookkeeping, most edges never have in hyper edges.
+    struct HEdgeData {
+        //! Restricted in hyper edges (ie an in hyper edge with this edge as a destination).
+        WeakEdges   inHEdges;
+        //! Restricted hyper in nodes (ie all source node for in restricted hyper edges).
+        WeakNodes   inHNodes;
+    };
+    inline auto getHEdgeData() const -> HEdgeData& {
+        if ( !_hData )
+            _hData = std::make_unique< HEdgeData >();
+        return *_hData;
+    }
+    //! Lazily allocated by getHEdgeData() (mutable since read accessors return references to its containers).
+    mutable std::unique_ptr< HEdgeData >    _hData;
     //@}
     //-------------------------------------------------------------------------
 };
 
+//! Storage for gtpo::GenNode in/out nodes, empty with gtpo::DerivedAdjacentNodes.
+template < class WeakNodes, class AdjacentNodes >
+struct GenNodeAdjacentNodes { };
+
+template < class WeakNodes >
+struct GenNodeAdjacentNodes< WeakNodes, StoredAdjacentNodes > {
+    WeakNodes       _inNodes;
+    WeakNodes       _outNodes;
+};
+
 /*! \brief Base class for modelling nodes with an in/out edges list in a qtpo::GenGraph graph.
  *
  * \nosubgrouping
@@ -355,7 +573,11 @@ template <class Config = DefaultConfig>
 class GenNode : public Config::NodeBase,
                 public gtpo::Behaviourable< gtpo::NodeBehaviour< Config >,
                                             typename Config::NodeBehaviours >,
-                public std::enable_shared_from_this<typename Config::Node>
+                public std::enable_shared_from_this<typename Config::Node>,
+                private GenNodeAdjacentNodes< typename adjacency_container< typename Config::Adjacency,
+                                                                            std::weak_ptr< typename Config::Node >,
+                                                                            typename Config::template NodeContainer< std::weak_ptr< typename Config::Node > > >::type,
+                                              typename Config::AdjacentNodes >
 {
     friend GenGraph<Config>;   // GenGraph need access to setGraph()
 
@@ -365,13 +587,15 @@ public:
     using Graph         = GenGraph<Config>;
     using WeakNode      = std::weak_ptr< typename Config::Node >;
     using SharedNode    = std::shared_ptr< typename Config::Node >;
-    using WeakNodes     = typename Config::template NodeContainer< WeakNode >;
+    //! Node in/out nodes container (see gtpo::GraphConfig::Adjacency).
+    using WeakNodes     = typename adjacency_container< typename Config::Adjacency, WeakNode,
+                                                        typename Config::template NodeContainer< WeakNode > >::type;
 
     GenNode() : Config::NodeBase( ) { }
     explicit GenNode( typename Config::NodeBase* parent ) : Config::NodeBase( parent ) { }
     virtual ~GenNode() {
         _inEdges.clear(); _outEdges.clear();
-        _inNodes.clear(); _outNodes.clear();
+        _outEdgesIndex.clear();
         if ( _graph != nullptr ) {
             std::cerr << "gtpo::GenNode<>::~GenNode(): Warning: Node has been destroyed before beeing removed from the graph." << std::endl;
         }
@@ -382,6 +606,21 @@ public:
 
     //! Return node class name (default to "gtpo::Node").
     inline std::string      getClassName() const noexcept { return "gtpo::Node"; }
+    /*! \brief Reset node graph, in/out edges and group so that it could be inserted again.
+     *
+     * Used to recycle nodes once they have been removed from their graph, must not be called on a node registered in a graph.
+     */
+    auto                    resetTopology() noexcept -> void {
+        _graph = nullptr;
+        _graphIndex = 0;
+        _batchPending = false;
+        _snapshotSlot = GraphSnapshot<Config>::invalidIndex;
+        _inEdges.clear(); _outEdges.clear();
+        _outEdgesIndex.clear();
+        clearAdjacentNodes( AdjacentNodes{} );
+        _group.reset();
+        _groupIndex = 0;
+    }
 
     //! User friendly shortcut type to this concrete node Behaviourable base type.
     using BehaviourableBase = gtpo::Behaviourable< gtpo::NodeBehaviour< Config >,
@@ -392,6 +631,13 @@ protected:
 private:
     inline void             setGraph( Graph* graph ) noexcept { _graph = graph; }
     Graph*                  _graph{ nullptr };
+    //! Node position in graph main nodes container (only maintained with gtpo::UnorderedRemoval).
+    std::size_t             _graphIndex{ 0 };
+    //! True while node insertion notification is deferred by a graph batch (see GenGraph::beginBatch()).
+    bool                    _batchPending{ false };
+    friend SnapshotTracker<Config>;
+    //! Node slot in graph snapshots (only maintained once GenGraph::snapshot() has been called).
+    std::uint32_t           _snapshotSlot{ GraphSnapshot<Config>::invalidIndex };
     //@}
     //-------------------------------------------------------------------------
 
@@ -424,7 +670,9 @@ private:
     //@{
 public:
     using WeakEdge      = std::weak_ptr< typename Config::Edge >;
-    using WeakEdges     = typename Config::template EdgeContainer< WeakEdge >;
+    //! Node in/out edges container (see gtpo::GraphConfig::Adjacency).
+    using WeakEdges     = typename adjacency_container< typename Config::Adjacency, WeakEdge,
+                                                        typename Config::template EdgeContainer< WeakEdge > >::type;
     using SharedEdge    = std::shared_ptr< typename Config::Edge >;
 
     /*! \brief Insert edge \c outEdge as an out edge for this node.
@@ -451,16 +699,68 @@ public:
     inline auto     getInEdges() const noexcept -> const WeakEdges& { return _inEdges; }
     inline auto     getOutEdges() const noexcept -> const WeakEdges& { return _outEdges; }
 
-    inline auto     getInNodes() const noexcept -> const WeakNodes& { return _inNodes; }
-    inline auto     getOutNodes() const noexcept -> const WeakNodes& { return _outNodes; }
+    /*! \brief Return this node in nodes (ie source nodes of in edges).
+     *
+     * Return a const reference on stored in nodes with gtpo::StoredAdjacentNodes, or a container built
+     * from in edges (by value, O(in degree)) with gtpo::DerivedAdjacentNodes.
+     */
+    inline auto     getInNodes() const noexcept( storesAdjacentNodes ) -> decltype(auto) { return inNodes( AdjacentNodes{} ); }
+    //! Return this node out nodes (ie destination nodes of out edges), see getInNodes().
+    inline auto     getOutNodes() const noexcept( storesAdjacentNodes ) -> decltype(auto) { return outNodes( AdjacentNodes{} ); }
 
     inline auto     getInDegree() const noexcept -> unsigned int { return static_cast<int>( _inEdges.size() ); }
     inline auto     getOutDegree() const noexcept -> unsigned int { return static_cast<int>( _outEdges.size() ); }
 private:
     WeakEdges       _inEdges;
     WeakEdges       _outEdges;
-    WeakNodes       _inNodes;
-    WeakNodes       _outNodes;
+
+    using AdjacentNodes = typename Config::AdjacentNodes;
+    static constexpr bool storesAdjacentNodes = std::is_same< AdjacentNodes, StoredAdjacentNodes >::value;
+
+    inline auto     inNodes( StoredAdjacentNodes ) const noexcept -> const WeakNodes& { return this->_inNodes; }
+    inline auto     outNodes( StoredAdjacentNodes ) const noexcept -> const WeakNodes& { return this->_outNodes; }
+    inline auto     inNodes( DerivedAdjacentNodes ) const -> WeakNodes {
+        return adjacentNodes( _inEdges, []( const auto& edge ) -> const WeakNode& { return edge.getSrc(); } );
+    }
+    inline auto     outNodes( DerivedAdjacentNodes ) const -> WeakNodes {
+        return adjacentNodes( _outEdges, []( const auto& edge ) -> const WeakNode& { return edge.getDst(); } );
+    }
+    //! Collect \c edges endpoints (\c endpoint return either an edge source or destination).
+    template < class Endpoint >
+    auto            adjacentNodes( const WeakEdges& edges, Endpoint endpoint ) const -> WeakNodes {
+        WeakNodes nodes;
+        for ( const auto& weakEdge : edges ) {
+            const auto edge = weakEdge.lock();
+            if ( edge && !endpoint( *edge ).expired() )
+                Config::template insert< WeakNodes >::into( nodes, endpoint( *edge ) );
+        }
+        return nodes;
+    }
+
+    inline auto     addInNode( const WeakNode& node, StoredAdjacentNodes ) -> void { Config::template insert< WeakNodes >::into( this->_inNodes, node ); }
+    inline auto     addOutNode( const WeakNode& node, StoredAdjacentNodes ) -> void { Config::template insert< WeakNodes >::into( this->_outNodes, node ); }
+    inline auto     removeInNode( const WeakNode& node, StoredAdjacentNodes ) -> void { Config::template remove< WeakNodes >::from( this->_inNodes, node ); }
+    inline auto     removeOutNode( const WeakNode& node, StoredAdjacentNodes ) -> void { Config::template remove< WeakNodes >::from( this->_outNodes, node ); }
+    inline auto     addInNode( const WeakNode&, DerivedAdjacentNodes ) noexcept -> void { }
+    inline auto     addOutNode( const WeakNode&, DerivedAdjacentNodes ) noexcept -> void { }
+    inline auto     removeInNode( const WeakNode&, DerivedAdjacentNodes ) noexcept -> void { }
+    inline auto     removeOutNode( const WeakNode&, DerivedAdjacentNodes ) noexcept -> void { }
+    inline auto     clearAdjacentNodes( StoredAdjacentNodes ) noexcept -> void { this->_inNodes.clear(); this->_outNodes.clear(); }
+    inline auto     clearAdjacentNodes( DerivedAdjacentNodes ) noexcept -> void { }
+
+public:
+    /*! \brief Out edges indexed by their destination owner pointer (destination node, or destination edge for restricted hyper edges).
+     *
+     * Index is maintained by addOutEdge()/removeOutEdge() and used by GenGraph::findEdge(), hasEdge() and getEdgeCount()
+     * for O(1) expected lookups, parallel edges are stored as multiple entries with the same key.
+     */
+    using OutEdgesIndex = typename Config::template AdjacencyIndex< const void*, WeakEdge >;
+    inline auto     getOutEdgesIndex() const noexcept -> const OutEdgesIndex& { return _outEdgesIndex; }
+private:
+    friend GenEdge<Config>;     // GenEdge re-index itself when its destination change
+    //! Move out edge \c edge indexed with \c previousKey to its current key (nothing is done if it is not indexed with \c previousKey).
+    auto            reindexOutEdge( const typename Config::Edge* edge, const void* previousKey ) noexcept -> void;
+    OutEdgesIndex   _outEdgesIndex;
     //@}
     //-------------------------------------------------------------------------
 
@@ -472,7 +772,10 @@ public:
     inline auto getGroup( ) noexcept -> WeakGroup& { return _group; }
     inline auto getGroup( ) const noexcept -> const WeakGroup& { return _group; }
 private:
+    friend GenGroup<Config>;    // GenGroup need access to _groupIndex
     WeakGroup   _group;
+    //! Node position in its group nodes container (only maintained with gtpo::UnorderedRemoval).
+    std::size_t _groupIndex{ 0 };
     //@}
     //-------------------------------------------------------------------------
 
@@ -509,6 +812,8 @@ public:
     using WeakNode          = std::weak_ptr< typename Config::Node >;
     using SharedNode        = std::shared_ptr< typename Config::Node >;
     using WeakNodes         = typename Config::template NodeContainer< WeakNode >;
+    //! Fast search container keyed by node owner pointer.
+    using NodesSearch       = typename Config::template SearchContainer< const typename Config::Node* >;
 
     using WeakEdge          = std::weak_ptr< typename Config::Edge >;
     using WeakEdgesSearch   = typename Config::template SearchContainer< WeakEdge >;
@@ -546,17 +851,34 @@ public:
      * \note \c weakNode getGroup() will return this if insertion succeed.
      */
     auto        insertNode( WeakNode weakNode ) noexcept( false ) -> void;
+    /*! \brief Insert all nodes in \c weakNodes range in this group.
+     *
+     * Equivalent to calling insertNode() for every node, but group containers and adjacent edge set are
+     * reserved once and group modification is notified once for the whole range. Expired nodes and nodes
+     * already registered in this group are ignored.
+     */
+    template < class WeakNodesRange >
+    auto        insertNodes( const WeakNodesRange& weakNodes ) noexcept( false ) -> void;
     auto        removeNode( const WeakNode& weakNode ) noexcept( false ) -> void;
 
     //! Return group's nodes.
     inline auto getNodes() noexcept -> const WeakNodes& { return _nodes; }
 
-    //! Return true if group contains \c node.
+    //! Return true if group contains \c node, O(1).
     auto        hasNode( const WeakNode& node ) const noexcept -> bool;
+    //! Return true if group contains \c node, O(1) without any weak_ptr locking.
+    inline auto hasNode( const typename Config::Node* node ) const noexcept -> bool {
+        return node != nullptr && _nodesSearch.find( node ) != _nodesSearch.cend();
+    }
     //! Return group registered node count.
     inline auto getNodeCount( ) const noexcept -> int { return static_cast< int >( _nodes.size() ); }
 private:
+    auto        insertInNodes( const SharedNode& node ) noexcept( false ) -> void;
+    auto        removeFromNodes( const SharedNode& node, OrderedRemoval ) noexcept( false ) -> void;
+    auto        removeFromNodes( const SharedNode& node, UnorderedRemoval ) noexcept( false ) -> void;
+
     WeakNodes   _nodes;
+    NodesSearch _nodesSearch;
     //@}
     //-------------------------------------------------------------------------
 
@@ -566,12 +888,19 @@ public:
     inline auto     getEdges() noexcept -> WeakEdgesSearch& { return _edges; }
     inline auto     getEdges() const noexcept -> const WeakEdgesSearch& { return _edges; }
 
-    inline auto     getAdjacentEdges() noexcept -> WeakEdgesSearch& { return _adjacentEdges; }
-    inline auto     getAdjacentEdges() const noexcept -> const WeakEdgesSearch& { return _adjacentEdges; }
+    /*! \brief Edges with at least one endpoint in this group, keyed by edge owner pointer.
+     *
+     * Every adjacent edge is counted once per endpoint inside the group (maintained by gtpo::GroupAdjacentEdgesBehaviour
+     * and gtpo::GraphGroupAjacentEdgesBehaviour), an edge is no longer adjacent once its last endpoint leave the group.
+     */
+    using AdjacentEdges     = gtpo::CountedSet< typename Config::Edge >;
+
+    inline auto     getAdjacentEdges() noexcept -> AdjacentEdges& { return _adjacentEdges; }
+    inline auto     getAdjacentEdges() const noexcept -> const AdjacentEdges& { return _adjacentEdges; }
 
 protected:
     WeakEdgesSearch _edges;
-    WeakEdgesSearch _adjacentEdges;
+    AdjacentEdges   _adjacentEdges;
     //@}
     //-------------------------------------------------------------------------
 
@@ -596,18 +925,21 @@ public:
  * \note See http://en.cppreference.com/w/cpp/language/dependent_name for
  *       typename X::template T c++11 syntax and using Nodes = typename Config::template NodeContainer< Node* >;
  *
+ * \note This is the gtpo::SharedStorage graph, gtpo::DenseStorage graph is defined in gtpoDenseGraph.h.
  */
-template < class Config = DefaultConfig >
+template < class Config, class Storage >
 class GenGraph : public Config::GraphBase,
                  public gtpo::Behaviourable< gtpo::GraphBehaviour< Config >,
                                              typename Config::GraphBehaviours >
 {
+    static_assert( std::is_same< Storage, SharedStorage >::value, "gtpo::GenGraph<>: Error: unsupported Config::Storage policy." );
+
     /*! \name Graph Management *///--------------------------------------------
     //@{
 public:
     using Configuration = Config;
 
-    using Graph     = GenGraph<Config>;
+    using Graph     = GenGraph< Config, Storage >;
 
     using Node              = typename Config::Node;
     using SharedNode        = std::shared_ptr< typename Config::Node >;
@@ -616,15 +948,21 @@ public:
     using SharedNodes       = typename Config::template NodeContainer< SharedNode >;
     using WeakNodes         = typename Config::template NodeContainer< WeakNode >;
     using WeakNodesSearch   = typename Config::template SearchContainer< WeakNode >;
+    //! Fast search container keyed by node owner pointer (no weak_ptr locking when hashing).
+    using NodesSearch       = typename Config::template SearchContainer< const typename Config::Node* >;
 
     using WeakEdge          = std::weak_ptr< typename Config::Edge >;
     using WeakEdges         = typename Config::template EdgeContainer< WeakEdge >;
     using SharedEdges       = typename Config::template EdgeContainer< SharedEdge >;
     using WeakEdgesSearch   = typename Config::template SearchContainer< WeakEdge >;
+    //! Fast search container keyed by edge owner pointer.
+    using EdgesSearch       = typename Config::template SearchContainer< const typename Config::Edge* >;
 
     using SharedGroup   = std::shared_ptr< typename Config::Group >;
     using WeakGroup     = std::weak_ptr< typename Config::Group >;
     using SharedGroups  = typename Config::template NodeContainer< SharedGroup >;
+    //! Fast search container keyed by group owner pointer.
+    using GroupsSearch  = typename Config::template SearchContainer< const typename Config::Group* >;
 
     //! User friendly shortcut to this concrete graph behaviour.
     using Behaviour = GraphBehaviour< Config >;
@@ -654,6 +992,14 @@ public:
      * changes when clearing the graph, disable all behaviours before calling clear().
      */
     void    clear() noexcept;
+
+    /*! \brief Return a counter incremented each time nodes, edges or groups are removed from graph (or graph is cleared).
+     *
+     * Let resumable algorithms detect that primitives they reference might have been destroyed between two calls.
+     */
+    inline auto getRemovalCount() const noexcept -> std::size_t { return _removalCount; }
+private:
+    std::size_t     _removalCount{ 0 };
 public:
     /*! \brief Any already inserted node could be added as a control node to prevent it destruction when clear() is called.
      *
@@ -673,6 +1019,33 @@ protected:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Graph Primitive Allocation *///----------------------------------
+    //@{
+private:
+    //! Allocate a new primitive of type \c T (dispatched on Config::Allocation).
+    template < class T >
+    auto    makePrimitive( std::shared_ptr< MemoryPool >&, HeapAllocation ) -> std::shared_ptr< T > {
+        return std::make_shared< T >();
+    }
+    template < class T >
+    auto    makePrimitive( std::shared_ptr< MemoryPool >& pool, PoolAllocation ) -> std::shared_ptr< T > {
+        if ( !pool )
+            pool = std::make_shared< MemoryPool >();
+        return std::allocate_shared< T >( PoolAllocator< T >{ pool } );
+    }
+    //! Release pools memory if all their primitives have been destroyed.
+    auto    trimPools() noexcept -> void {
+        for ( auto pool : { _nodesPool.get(), _edgesPool.get(), _groupsPool.get() } )
+            if ( pool != nullptr )
+                pool->trim();
+    }
+
+    std::shared_ptr< MemoryPool >   _nodesPool;
+    std::shared_ptr< MemoryPool >   _edgesPool;
+    std::shared_ptr< MemoryPool >   _groupsPool;
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Graph Node Management *///---------------------------------------
     //@{
 public:
@@ -728,13 +1101,38 @@ public:
      */
     auto    insertNode( SharedNode node ) noexcept( false ) -> WeakNode;
 
+    /*! \brief Insert a range of nodes created outside of GTpo into the graph.
+     *
+     * Nodes are appended to graph node container in one call (Config::append_range<> must be defined for
+     * Config::NodeContainer), and behaviours are notified once for the whole range (see beginBatch()).
+     * \code
+     *   std::vector< stpo::Graph::SharedNode > nodes;
+     *   for ( int n = 0; n < 1000; ++n )
+     *       nodes.emplace_back( std::make_shared< stpo::Node >() );
+     *   graph.insertNodes( nodes );
+     * \endcode
+     * \throw gtpo::bad_topology_error if a node is nullptr (graph is left unmodified).
+     */
+    template < class SharedNodesRange >
+    auto    insertNodes( const SharedNodesRange& nodes ) noexcept( false ) -> void;
+
     /*! \brief Remove node \c node from graph.
      *
-     * Complexity depend on Config::NodeContainer.
+     * Complexity depend on Config::NodeContainer and Config::Removal policy: O(node count) with
+     * gtpo::OrderedRemoval, O(node degree) with gtpo::UnorderedRemoval.
      * \throw gtpo::bad_topology_error if node can't be removed (or node is not valid).
      */
     auto    removeNode( WeakNode weakNode ) noexcept( false ) -> void;
 
+    /*! \brief Remove all nodes in \c nodes (and all their in/out edges) with a single compaction pass on graph containers.
+     *
+     * \c nodes could be any iterable range of WeakNode, expired nodes or nodes not registered in this graph are ignored.
+     * Complexity is O(node count + edge count + removed nodes degree) whatever the Config::Removal policy is.
+     * \throw gtpo::bad_topology_error if removed nodes topology is inconsistent.
+     */
+    template < class WeakNodesRange >
+    auto    removeNodes( const WeakNodesRange& nodes ) noexcept( false ) -> void;
+
     //! Return the number of nodes actually registered in graph.
     auto    getNodeCount( ) const -> Size { return _nodes.size(); }
     //! Return the number of root nodes (actually registered in graph)ie nodes with a zero in degree).
@@ -755,11 +1153,16 @@ public:
      *
      * \return true if \c node is a root node, false otherwise.
      * \throw gtpo::bad_topology_error if there is a graph cohenrency problem (ie node is in the root node cache but has a zero in degree).
+     * Complexity is O(1).
      */
     auto    isRootNode( WeakNode node ) const noexcept( false ) -> bool;
 
-    //! Use fast search container to find if a given \c node is part of this graph.
+    //! Use fast search container to find if a given \c node is part of this graph, O(1).
     auto    contains( WeakNode node ) const noexcept -> bool;
+    //! Use fast search container to find if a given \c node is part of this graph, O(1) without any weak_ptr locking.
+    inline auto contains( const Node* node ) const noexcept -> bool {
+        return node != nullptr && _nodesSearch.find( node ) != _nodesSearch.cend();
+    }
 
     //! Graph main nodes container.
     inline auto     getNodes() const -> const SharedNodes& { return _nodes; }
@@ -774,9 +1177,15 @@ public:
     inline auto     cend() const -> typename SharedNodes::const_iterator { return _nodes.cend(); }
 
 private:
+    //! Register \c node (already stored at \c index in main nodes container) in search containers, snapshots and behaviours.
+    auto    registerNode( const SharedNode& node, std::size_t index ) noexcept( false ) -> WeakNode;
+    //! Remove \c node from main nodes container (dispatched on Config::Removal).
+    auto    removeFromNodes( const SharedNode& node, OrderedRemoval ) noexcept( false ) -> void;
+    auto    removeFromNodes( const SharedNode& node, UnorderedRemoval ) noexcept( false ) -> void;
+
     SharedNodes         _nodes;
-    WeakNodes           _rootNodes;
-    WeakNodesSearch     _nodesSearch;
+    NodesSearch         _rootNodes;
+    NodesSearch         _nodesSearch;
     //@}
     //-------------------------------------------------------------------------
 
@@ -820,12 +1229,21 @@ public:
      */
     auto        insertEdge( SharedEdge edge ) noexcept( false ) -> WeakEdge;
 
+    /*! \brief Insert a range of directed edges created outside of GTpo into the graph.
+     *
+     * Edges are appended to graph edge container in one call (Config::append_range<> must be defined for
+     * Config::EdgeContainer), and behaviours are notified once for the whole range.
+     * \throw gtpo::bad_topology_error if an edge is nullptr or has an expired source or destination (graph is left unmodified).
+     */
+    template < class SharedEdgesRange >
+    auto        insertEdges( const SharedEdgesRange& edges ) noexcept( false ) -> void;
+
     /*! \brief Remove first directed edge found between \c source and \c destination node.
      *
      * If the current GenGraph<> Config::EdgeContainer and Config::NodeContainer allow parrallel edges support, the first
      * edge found between \c source and \c destination will be removed.
      *
-     * Complexity is O(edge count) at worst.
+     * Complexity is O(1) expected (source out edges index lookup).
      * \throw a gtpo::bad_topology_error if suppression fails (either \c source or \c destination or edge does not exists).
      */
     auto        removeEdge( WeakNode source, WeakNode destination ) noexcept( false ) -> void;
@@ -835,21 +1253,41 @@ public:
      * If the current GenGraph<> Config::EdgeContainer and Config::NodeContainer allow parrallel edges support, the first
      * edge found between \c source and \c destination will be removed.
      *
-     * Worst case complexity is O(edge count).
+     * Complexity is O(number of edges between \c source and \c destination).
      * \throw a gtpo::bad_topology_error if suppression fails (either \c source or \c destination or edge does not exists).
      */
     auto        removeAllEdges( WeakNode source, WeakNode destination ) noexcept( false ) -> void;
 
     /*! \brief Remove directed edge \c edge.
      *
-     * Worst case complexity is O(edge count).
+     * Worst case complexity is O(edge count) with gtpo::OrderedRemoval, O(source out degree + destination in degree)
+     * with gtpo::UnorderedRemoval.
      * \throw a gtpo::bad_topology_error if suppression fails (\c edge does not exists).
      */
     auto        removeEdge( WeakEdge edge ) noexcept( false ) -> void;
 
+    /*! \brief Remove all edges in \c edges (and their in hyper edges) with a single compaction pass on graph edges container.
+     *
+     * \c edges could be any iterable range of WeakEdge, expired edges or edges not registered in this graph are ignored.
+     * \throw a gtpo::bad_topology_error if an edge source or destination is expired.
+     */
+    template < class WeakEdgesRange >
+    auto        removeEdges( const WeakEdgesRange& edges ) noexcept( false ) -> void;
+private:
+    //! Register \c edge (already stored at \c index in main edges container) in search containers, adjacency, snapshots and behaviours.
+    auto        registerEdge( const SharedEdge& edge, std::size_t index ) noexcept( false ) -> WeakEdge;
+    //! Throw a gtpo::bad_topology_error if \c edge could not be inserted.
+    static auto checkInsertedEdge( const SharedEdge& edge ) noexcept( false ) -> void;
+    //! Notify edge removal and remove \c edge from its source, destination and hyper destination adjacency.
+    auto        unlinkEdge( const SharedEdge& edge ) noexcept( false ) -> void;
+    //! Remove \c edge from main edges container (dispatched on Config::Removal).
+    auto        removeFromEdges( const SharedEdge& edge, OrderedRemoval ) noexcept( false ) -> void;
+    auto        removeFromEdges( const SharedEdge& edge, UnorderedRemoval ) noexcept( false ) -> void;
+public:
+
     /*! \brief Look for the first directed edge between \c source and \c destination and return it.
      *
-     * Worst case complexity is O(edge count).
+     * Complexity is O(1) expected (source out edges index lookup).
      * \return A shared reference on edge, en empty shared reference otherwise (result == false).
      * \throw noexcept.
      */
@@ -857,13 +1295,13 @@ public:
     /*! \brief Test if a directed edge exists between nodes \c source and \c destination.
      *
      * This method only test a 1 degree relationship (ie a direct edge between \c source
-     * and \c destination). Worst case complexity is O(edge count).
+     * and \c destination). Complexity is O(1) expected (source out edges index lookup).
      * \throw noexcept.
      */
     auto        hasEdge( WeakNode source, WeakNode destination ) const noexcept -> bool;
     /*! \brief Look for the first directed restricted hyper edge between \c source node and \c destination edge and return it.
      *
-     * Worst case complexity is O(edge count).
+     * Complexity is O(1) expected (source out edges index lookup).
      * \return A shared reference on edge, en empty shared reference otherwise (result == false).
      * \throw noexcept.
      */
@@ -871,7 +1309,7 @@ public:
     /*! \brief Test if a directed restricted hyper edge exists between nodes \c source and \c destination.
      *
      * This method only test a 1 degree relationship (ie a direct edge between \c source
-     * and \c destination). Worst case complexity is O(edge count).
+     * and \c destination). Complexity is O(1) expected (source out edges index lookup).
      * \throw noexcept.
      */
     auto        hasEdge( WeakNode source, WeakEdge destination ) const noexcept -> bool;
@@ -884,19 +1322,23 @@ public:
      * parrallel edge support, otherwise, getEdgeCount() will always return 1 or 0.
      *
      * This method only test a 1 degree relationship (ie a direct edge between \c source
-     * and \c destination). Worst case complexity is O(edge count).
+     * and \c destination). Complexity is O(1) expected (source out edges index lookup).
      * \throw no GTpo exception (might throw a std::bad_weak_ptr).
      */
     auto        getEdgeCount( WeakNode source, WeakNode destination ) const noexcept( false ) -> unsigned int;
 
-    //! Use fast search container to find if a given \c edge is part of this graph.
+    //! Use fast search container to find if a given \c edge is part of this graph, O(1).
     auto        contains( WeakEdge edge ) const noexcept -> bool;
+    //! Use fast search container to find if a given \c edge is part of this graph, O(1) without any weak_ptr locking.
+    inline auto contains( const typename Config::Edge* edge ) const noexcept -> bool {
+        return edge != nullptr && _edgesSearch.find( edge ) != _edgesSearch.cend();
+    }
 
     //! Graph main edges container.
     inline auto getEdges() const noexcept -> const SharedEdges& { return _edges; }
 private:
     SharedEdges     _edges;
-    WeakEdgesSearch _edgesSearch;
+    EdgesSearch     _edgesSearch;
     //@}
     //-------------------------------------------------------------------------
 
@@ -937,8 +1379,12 @@ public:
      */
     auto        removeGroup( WeakGroup group ) noexcept( false ) -> void;
 
-    //! Return true if a given group \c group is registered in the graph.
+    //! Return true if a given group \c group is registered in the graph, O(1).
     auto        hasGroup( const WeakGroup& group ) const -> bool;
+    //! Return true if a given group \c group is registered in the graph, O(1) without any weak_ptr locking.
+    inline auto hasGroup( const typename Config::Group* group ) const noexcept -> bool {
+        return group != nullptr && _groupsSearch.find( group ) != _groupsSearch.cend();
+    }
 
     //! Return the number of edges currently existing in graph.
     inline auto getGroupCount( ) const noexcept -> int { return static_cast<int>( _groups.size() ); }
@@ -947,6 +1393,105 @@ public:
     inline auto getGroups() const noexcept -> const SharedGroups& { return _groups; }
 private:
     SharedGroups  _groups;
+    GroupsSearch  _groupsSearch;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Batch Management *///--------------------------------------
+    //@{
+public:
+    /*! \brief Open a mutation batch, node and edge insertion behaviour notifications are deferred until endBatch().
+     *
+     * Inside a batch, insertNode(), createEdge() and insertEdge() do not notify behaviours, inserted
+     * primitives are collected and notified at once with GraphBehaviour::nodesInserted() and
+     * GraphBehaviour::edgesInserted() when the outermost batch is closed. Root nodes maintenance is
+     * deferred too: isRootNode() might report destination nodes as root nodes, and getRootNodeCount() count
+     * them, until endBatch().
+     *
+     * Batches could be nested, only the outermost endBatch() flush pending notifications. Removals are
+     * not deferred and notified immediately, except for primitives inserted in the current batch: a primitive
+     * inserted and removed in the same batch is notified neither for its insertion nor for its removal.
+     *
+     * \code
+     * gtpo::GenGraph<> g;
+     * {
+     *   gtpo::GenGraph<>::BatchScope batch{ g };
+     *   auto n1 = g.createNode();
+     *   auto n2 = g.createNode();
+     *   g.createEdge( n1, n2 );
+     * }    // Behaviours notified here
+     * \endcode
+     */
+    inline auto beginBatch() noexcept -> void { ++_batchDepth; }
+
+    /*! \brief Close a batch opened with beginBatch(), flush pending notifications when the outermost batch is closed.
+     *
+     * \throw gtpo::bad_topology_error if no batch is actually opened.
+     */
+    auto        endBatch() noexcept( false ) -> void;
+
+    //! Return true if a batch is actually opened with beginBatch().
+    inline auto isInBatch() const noexcept -> bool { return _batchDepth > 0; }
+
+    //! RAII helper calling beginBatch() on construction and endBatch() on destruction.
+    class BatchScope
+    {
+    public:
+        explicit BatchScope( GenGraph& graph ) noexcept : _graph( graph ) { _graph.beginBatch(); }
+        ~BatchScope() noexcept( false ) { _graph.endBatch(); }
+        BatchScope( const BatchScope& ) = delete;
+        BatchScope& operator=( const BatchScope& ) = delete;
+    private:
+        GenGraph&   _graph;
+    };
+private:
+    //! Remove pending root candidates that actually have an in edge from another node.
+    auto        flushBatchRootNodes() noexcept -> void;
+
+    int                     _batchDepth{ 0 };
+    std::vector< WeakNode > _batchNodes;
+    std::vector< WeakEdge > _batchEdges;
+    std::vector< WeakNode > _batchRootNodes;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Snapshots *///--------------------------------------------
+    //@{
+public:
+    using Snapshot  = gtpo::GraphSnapshot< Config >;
+
+    /*! \brief Return an immutable versioned snapshot of graph topology and core node/edge properties.
+     *
+     * First call enable snapshot change tracking and is O(N+E), following calls only rewrite primitives
+     * inserted, removed or modified since the previous snapshot: O(changes). Returned snapshot share its
+     * storage with the live graph, it could be traversed from a worker thread while graph is modified (see
+     * gtpo::GraphSnapshot).
+     *
+     * Node and edge properties changes are recorded when notified with notifyNodeModified() and
+     * notifyEdgeModified() (setting properties directly trough Config accessors is not recorded).
+     */
+    auto        snapshot() noexcept( false ) -> Snapshot;
+
+    //! Stop recording changes for snapshots, already published snapshots are still valid.
+    inline auto releaseSnapshots() noexcept -> void { _snapshots.reset(); }
+
+    //! Return \c node slot in snapshots, or Snapshot::invalidIndex if snapshots are not enabled.
+    inline auto getSnapshotIndex( const typename Config::Node* node ) const noexcept -> typename Snapshot::Index {
+        return node != nullptr && _snapshots ? node->_snapshotSlot : Snapshot::invalidIndex;
+    }
+    //! Return \c edge slot in snapshots, or Snapshot::invalidIndex if snapshots are not enabled or \c edge is an hyper edge.
+    inline auto getSnapshotIndex( const typename Config::Edge* edge ) const noexcept -> typename Snapshot::Index {
+        return edge != nullptr && _snapshots ? edge->_snapshotSlot : Snapshot::invalidIndex;
+    }
+
+    //! Notify behaviours that \c node has been modified and record modification for next snapshot.
+    template < class N >
+    auto        notifyNodeModified( N& node ) noexcept -> void;
+    //! Notify behaviours that \c edge has been modified and record modification for next snapshot.
+    template < class E >
+    auto        notifyEdgeModified( E& edge ) noexcept -> void;
+private:
+    std::unique_ptr< SnapshotTracker< Config > >   _snapshots;
     //@}
     //-------------------------------------------------------------------------
 };
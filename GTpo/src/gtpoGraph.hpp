@@ -32,7 +32,35 @@
 
 namespace gtpo { // ::gtpo
 
+/* GenEdge Source / Destination Management *///--------------------------------
+template < class Config >
+auto GenEdge< Config >::setDst( WeakNode dst ) noexcept -> void
+{
+    const void* previousKey = getOutEdgeKey();
+    _dst = dst;
+    reindexOutEdge( previousKey );
+}
+
+template < class Config >
+auto GenEdge< Config >::reindexOutEdge( const void* previousKey ) noexcept -> void
+{
+    if ( getOutEdgeKey() == previousKey )
+        return;
+    auto source = _src.lock();
+    if ( source != nullptr )
+        source->reindexOutEdge( static_cast< const typename Config::Edge* >( this ), previousKey );
+}
+//-----------------------------------------------------------------------------
+
 /* GenEdge Restricted Hyper Edge Management *///-------------------------------
+template < class Config >
+auto GenEdge< Config >::setHDst( WeakEdge hDst ) noexcept -> void
+{
+    const void* previousKey = getOutEdgeKey();
+    _hDst = hDst;
+    reindexOutEdge( previousKey );
+}
+
 template < class Config >
 auto GenEdge< Config >::addInHEdge( WeakEdge inHEdge ) -> void
 {
@@ -42,9 +70,10 @@ auto GenEdge< Config >::addInHEdge( WeakEdge inHEdge ) -> void
     if ( inHEdgePtr != nullptr ) {
         if ( inHEdgePtr->getHDst().expired() )
             inHEdgePtr->setHDst( this->shared_from_this() );
-        Config::template insert< WeakEdges >::into( _inHEdges, inHEdge );
+        auto& hData = getHEdgeData();
+        Config::template insert< WeakEdges >::into( hData.inHEdges, inHEdge );
         if ( !inHEdgePtr->getSrc().expired() )
-            Config::template insert< WeakNodes >::into( _inHNodes, inHEdgePtr->getSrc() );
+            Config::template insert< WeakNodes >::into( hData.inHNodes, inHEdgePtr->getSrc() );
     }
 }
 
@@ -56,22 +85,24 @@ auto GenEdge< Config >::removeInHEdge( WeakEdge inHEdge ) -> void
     SharedEdge inHEdgePtr{ inHEdge.lock() };
     if ( inHEdgePtr != nullptr ) {
         inHEdgePtr->setHDst( SharedEdge{} );
-        Config::template remove< WeakEdges >::from( _inHEdges, inHEdge );
-        Config::template remove< WeakNodes >::from( _inHNodes, inHEdgePtr->getSrc() );
+        if ( !_hData )      // No in hyper edges, nothing to remove
+            return;
+        Config::template remove< WeakEdges >::from( _hData->inHEdges, inHEdge );
+        Config::template remove< WeakNodes >::from( _hData->inHNodes, inHEdgePtr->getSrc() );
     }
 }
 //-----------------------------------------------------------------------------
 
 /* Graph Node Management *///--------------------------------------------------
-template < class Config >
-GenGraph< Config >::~GenGraph()
+template < class Config, class Storage >
+GenGraph< Config, Storage >::~GenGraph()
 {
     clear();
     _controlNodes.clear();
 }
 
-template < class Config >
-void    GenGraph< Config >::clear() noexcept
+template < class Config, class Storage >
+void    GenGraph< Config, Storage >::clear() noexcept
 {
     // Note 20160104: First edges, then nodes (it helps maintaining topology if
     // womething went wrong during destruction
@@ -81,15 +112,23 @@ void    GenGraph< Config >::clear() noexcept
     _edges.clear();
     for ( auto& node: _nodes )   // Do not maintain topology during node deletion
         node->_graph = nullptr;
-    _rootNodes.clear();         // Remove weak_ptr containers first
+    _rootNodes.clear();         // Remove search containers first
     _nodesSearch.clear();
     _nodes.clear();
 
     // Clearing groups and behaviours
     for ( auto& group: _groups )
         group->_graph = nullptr;
+    _groupsSearch.clear();
     _groups.clear();
+    ++_removalCount;
+    _batchNodes.clear();        // Pending batch notifications are discarded
+    _batchEdges.clear();
+    _batchRootNodes.clear();
+    if ( _snapshots )
+        _snapshots->clear();
     BehaviourableBase::clear();
+    trimPools();                // Release pooled memory at once when no primitive is referenced anymore
 
     for ( auto& node: _controlNodes )    // Reinsert control nodes
         insertNode( node );
@@ -97,50 +136,85 @@ void    GenGraph< Config >::clear() noexcept
 //-----------------------------------------------------------------------------
 
 /* Graph Node Management *///--------------------------------------------------
-template < class Config >
-auto GenGraph< Config >::createNode( ) -> WeakNode
+template < class Config, class Storage >
+auto GenGraph< Config, Storage >::createNode( ) -> WeakNode
 {
     WeakNode weakNode;
     try {
-        auto node = std::make_shared< typename Config::Node >();
+        auto node = makePrimitive< typename Config::Node >( _nodesPool, typename Config::Allocation{} );
         weakNode = insertNode( node );
     } catch (...) { gtpo::assert_throw( false, "GenGraph<>::createNode(): Error: can't insert node in graph." ); }
     return weakNode;
 }
 
-template < class Config >
-auto    GenGraph< Config >::createNode( const std::string& className ) noexcept( false ) -> WeakNode
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::createNode( const std::string& className ) noexcept( false ) -> WeakNode
 {
     if ( className == "gtpo::Node" )
         return createNode();
     return WeakNode{};
 }
 
-template < class Config >
-auto    GenGraph< Config >::insertNode( SharedNode node ) -> WeakNode
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::insertNode( SharedNode node ) -> WeakNode
 {
     assert_throw( node != nullptr, "gtpo::GenGraph<>::insertNode(): Error: Trying to insert a nullptr node in graph." );
-    WeakNode weakNode;
     try {
-        weakNode = node;
         node->setGraph( this );
         Config::template insert< SharedNodes >::into( _nodes, node );
-        Config::template insert< WeakNodesSearch >::into( _nodesSearch, weakNode );
-        Config::template insert< WeakNodes >::into( _rootNodes, weakNode );
-        BehaviourableBase::notifyNodeInserted( weakNode );
+    } catch (...) { gtpo::assert_throw( false, "gtpo::GenGraph<>::insertNode(): Error: can't insert node in graph." ); }
+    return registerNode( node, static_cast< std::size_t >( _nodes.size() - 1 ) );
+}
+
+template < class Config, class Storage >
+template < class SharedNodesRange >
+auto    GenGraph< Config, Storage >::insertNodes( const SharedNodesRange& nodes ) -> void
+{
+    for ( const auto& node : nodes )
+        assert_throw( node != nullptr, "gtpo::GenGraph<>::insertNodes(): Error: Trying to insert a nullptr node in graph." );
+    BatchScope batch{ *this };      // Notify behaviours once for the whole range
+    auto index = static_cast< std::size_t >( _nodes.size() );
+    try {
+        Config::template append_range< SharedNodes >::into( _nodes, nodes );
+    } catch (...) { gtpo::assert_throw( false, "gtpo::GenGraph<>::insertNodes(): Error: can't insert nodes in graph." ); }
+    for ( const auto& node : nodes ) {
+        node->setGraph( this );
+        registerNode( node, index++ );
+    }
+}
+
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::registerNode( const SharedNode& node, std::size_t index ) -> WeakNode
+{
+    WeakNode weakNode;
+    try {
+        weakNode = node;
+        node->_graphIndex = index;
+        Config::template insert< NodesSearch >::into( _nodesSearch, node.get() );
+        Config::template insert< NodesSearch >::into( _rootNodes, node.get() );
+        if ( _snapshots )
+            _snapshots->insertNode( node.get() );
+        node->_batchPending = isInBatch();
+        if ( isInBatch() )
+            _batchNodes.push_back( weakNode );
+        else
+            BehaviourableBase::notifyNodeInserted( weakNode );
     } catch (...) { gtpo::assert_throw( false, "gtpo::GenGraph<>::insertNode(): Error: can't insert node in graph." ); }
     return weakNode;
 }
 
-template < class Config >
-auto    GenGraph< Config >::removeNode( WeakNode weakNode ) -> void
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::removeNode( WeakNode weakNode ) -> void
 {
     gtpo::assert_throw( !weakNode.expired(), "gtpo::GenGraph<>::removeNode(): Error: trying to remove an expired node." );
     SharedNode node = weakNode.lock();
     if ( !node )
         gtpo::assert_throw( false, "gtpo::GenGraph<>::removeNode(): Error: node is expired." );
+    ++_removalCount;
 
-    BehaviourableBase::notifyNodeRemoved( weakNode );
+    if ( !node->_batchPending )     // Behaviours have not been notified of a node inserted in current batch
+        BehaviourableBase::notifyNodeRemoved( weakNode );
+    node->_batchPending = false;
 
     // Removing all orphant edges pointing to node.
     WeakEdges nodeInEdges; std::copy( node->getInEdges().cbegin(),
@@ -160,46 +234,107 @@ auto    GenGraph< Config >::removeNode( WeakNode weakNode ) -> void
         removeEdge( outEdge );
 
     // Remove node from main graph containers (it will generate node destruction)
-    Config::template remove<WeakNodesSearch>::from( _nodesSearch, weakNode );
-    Config::template remove<WeakNodes>::from( _rootNodes, weakNode );
+    if ( _snapshots )
+        _snapshots->removeNode( node.get() );
+    Config::template remove<NodesSearch>::from( _nodesSearch, node.get() );
+    Config::template remove<NodesSearch>::from( _rootNodes, node.get() );
     node->setGraph( nullptr );
+    removeFromNodes( node, typename Config::Removal{} );
+}
+
+template < class Config, class Storage >
+template < class WeakNodesRange >
+auto    GenGraph< Config, Storage >::removeNodes( const WeakNodesRange& nodes ) -> void
+{
+    NodesSearch removedNodes;
+    std::vector< SharedNode > sharedNodes;
+    for ( const auto& weakNode : nodes ) {
+        SharedNode node = weakNode.lock();
+        if ( node == nullptr ||
+             node->getGraph() != this ||
+             removedNodes.find( node.get() ) != removedNodes.end() )
+            continue;
+        Config::template insert< NodesSearch >::into( removedNodes, node.get() );
+        sharedNodes.emplace_back( std::move( node ) );
+    }
+    if ( sharedNodes.empty() )
+        return;
+    ++_removalCount;
+
+    // Remove all removed nodes in/out edges at once
+    std::vector< WeakEdge > nodesEdges;
+    for ( auto& node : sharedNodes ) {
+        WeakNode weakNode{ node };
+        if ( !node->_batchPending )
+            BehaviourableBase::notifyNodeRemoved( weakNode );
+        node->_batchPending = false;
+        std::copy( node->getInEdges().cbegin(), node->getInEdges().cend(), std::back_inserter( nodesEdges ) );
+        std::copy( node->getOutEdges().cbegin(), node->getOutEdges().cend(), std::back_inserter( nodesEdges ) );
+    }
+    removeEdges( nodesEdges );
+
+    for ( auto& node : sharedNodes ) {
+        if ( _snapshots )
+            _snapshots->removeNode( node.get() );
+        Config::template remove<NodesSearch>::from( _nodesSearch, node.get() );
+        Config::template remove<NodesSearch>::from( _rootNodes, node.get() );
+        node->setGraph( nullptr );
+    }
+    Config::template remove_if< SharedNodes >::from( _nodes, [&removedNodes]( const SharedNode& node ) {
+        return removedNodes.find( node.get() ) != removedNodes.end();
+    } );
+    std::size_t n = 0;      // Reindex remaining nodes after compaction
+    for ( auto& node : _nodes )
+        node->_graphIndex = n++;
+}
+
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::removeFromNodes( const SharedNode& node, OrderedRemoval ) -> void
+{
     Config::template remove<SharedNodes>::from( _nodes, node );
 }
 
-template < class Config >
-auto    GenGraph< Config >::installRootNode( WeakNode node ) -> void
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::removeFromNodes( const SharedNode& node, UnorderedRemoval ) -> void
+{
+    const auto position = node->_graphIndex;
+    gtpo::assert_throw( position < static_cast< std::size_t >( _nodes.size() ) &&
+                        _nodes[ position ] == node, "gtpo::GenGraph<>::removeNode(): Error: node graph index is invalid." );
+    Config::template swap_and_pop< SharedNodes >::from( _nodes, position );
+    if ( position < static_cast< std::size_t >( _nodes.size() ) )
+        _nodes[ position ]->_graphIndex = position;     // Last node has been moved at removed node position
+}
+
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::installRootNode( WeakNode node ) -> void
 {
     assert_throw( !node.expired(), "gtpo::GenGraph<>::setRootNode(): Error: node is expired." );
     SharedNode sharedNode = node.lock();
     assert_throw( sharedNode->getInDegree() == 0, "gtpo::GenGraph<>::setRootNode(): Error: trying to set a node with non 0 in degree as a root node." );
 
-    Config::template insert<WeakNodes>::into( _rootNodes, node );
+    Config::template insert<NodesSearch>::into( _rootNodes, sharedNode.get() );
 }
 
-template < class Config >
-auto    GenGraph< Config >::isRootNode( WeakNode node ) const -> bool
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::isRootNode( WeakNode node ) const -> bool
 {
     assert_throw( !node.expired(), "gtpo::GenGraph<>::isRootNode(): Error: node is expired." );
     SharedNode sharedNode = node.lock();
     if ( sharedNode->getInDegree() != 0 )   // Fast exit when node in degree != 0, it can't be a root node
         return false;
-    return gtpo::find_weak_ptr( _rootNodes, node );
+    return _rootNodes.find( sharedNode.get() ) != _rootNodes.cend();
 }
 
-template < class Config >
-auto    GenGraph< Config >::contains( WeakNode node ) const noexcept -> bool
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::contains( WeakNode node ) const noexcept -> bool
 {
-    if ( node.expired() )   // Fast exit.
-        return false;
-    auto nodeIter = std::find_if( _nodesSearch.cbegin(), _nodesSearch.cend(),
-                                            [=](const WeakNode& n ) { return ( compare_weak_ptr<>( node, n ) ); } );
-    return nodeIter != _nodesSearch.cend();
+    return contains( node.lock().get() );     // Expired node lock to nullptr
 }
 //-----------------------------------------------------------------------------
 
 /* Graph Edge Management *///--------------------------------------------------
-template < class Config >
-auto    GenGraph< Config >::createEdge( WeakNode source, WeakNode destination ) -> WeakEdge
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::createEdge( WeakNode source, WeakNode destination ) -> WeakEdge
 {
     auto sourcePtr = source.lock();
     auto destinationPtr = destination.lock();
@@ -207,27 +342,37 @@ auto    GenGraph< Config >::createEdge( WeakNode source, WeakNode destination )
          destinationPtr == nullptr )
         throw gtpo::bad_topology_error( "gtpo::GenGraph<>::createEdge(Node,Node): Insertion of edge failed, either source or destination nodes are expired." );
 
-    auto edge = std::make_shared< typename Config::Edge >();
+    auto edge = makePrimitive< typename Config::Edge >( _edgesPool, typename Config::Allocation{} );
     edge->setGraph( this );
     Config::template insert< SharedEdges >::into( _edges, edge );
-    Config::template insert< WeakEdgesSearch >::into( _edgesSearch, edge );
+    edge->_graphIndex = static_cast< std::size_t >( _edges.size() - 1 );
+    Config::template insert< EdgesSearch >::into( _edgesSearch, edge.get() );
     edge->setSrc( source );
     edge->setDst( destination );
     try {
         sourcePtr->addOutEdge( edge );
         destinationPtr->addInEdge( edge );
-        if ( sourcePtr.get() != destinationPtr.get() ) // If edge define is a trivial circuit, do not remove destination from root nodes
-            Config::template remove<WeakNodes>::from( _rootNodes, destination );    // Otherwise destination is no longer a root node
+        if ( _snapshots )
+            _snapshots->insertEdge( edge.get() );
         auto weakEdge = WeakEdge{edge};
-        BehaviourableBase::notifyEdgeInserted( weakEdge );
+        edge->_batchPending = isInBatch();
+        if ( isInBatch() ) {
+            if ( sourcePtr.get() != destinationPtr.get() )
+                _batchRootNodes.push_back( destination );   // Root nodes are updated in endBatch()
+            _batchEdges.push_back( weakEdge );
+        } else {
+            if ( sourcePtr.get() != destinationPtr.get() ) // If edge define is a trivial circuit, do not remove destination from root nodes
+                Config::template remove<NodesSearch>::from( _rootNodes, destinationPtr.get() );    // Otherwise destination is no longer a root node
+            BehaviourableBase::notifyEdgeInserted( weakEdge );
+        }
     } catch ( ... ) {
         throw gtpo::bad_topology_error( "gtpo::GenGraph<>::createEdge(Node,Node): Insertion of edge failed, source or destination nodes topology can't be modified." );
     }
     return edge;
 }
 
-template < class Config >
-auto    GenGraph< Config >::createEdge( WeakNode source, WeakEdge destination ) -> WeakEdge
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::createEdge( WeakNode source, WeakEdge destination ) -> WeakEdge
 {
     auto sourcePtr = source.lock();
     auto destinationPtr = destination.lock();
@@ -235,10 +380,11 @@ auto    GenGraph< Config >::createEdge( WeakNode source, WeakEdge destination )
          !destinationPtr )
         throw gtpo::bad_topology_error( "gtpo::GenGraph<>::createEdge(Node,Edge): Insertion of edge failed, either source node and/or destination edge is expired." );
 
-    auto edge = std::make_shared< typename Config::Edge >();
+    auto edge = makePrimitive< typename Config::Edge >( _edgesPool, typename Config::Allocation{} );
     edge->setGraph( this );
     Config::template insert< SharedEdges >::into( _edges, edge );
-    Config::template insert< WeakEdgesSearch >::into( _edgesSearch, edge );
+    edge->_graphIndex = static_cast< std::size_t >( _edges.size() - 1 );
+    Config::template insert< EdgesSearch >::into( _edgesSearch, edge.get() );
     edge->setSrc( source );
     std::cerr << "destination.get()=" << destinationPtr.get() << std::endl;
     edge->setHDst( destination );
@@ -248,198 +394,308 @@ auto    GenGraph< Config >::createEdge( WeakNode source, WeakEdge destination )
         destinationPtr->addInHEdge( edge );
         // Note: hEdge does not modify root nodes.
         auto weakEdge = WeakEdge{edge};
-        BehaviourableBase::notifyEdgeInserted( weakEdge );
+        edge->_batchPending = isInBatch();
+        if ( isInBatch() )
+            _batchEdges.push_back( weakEdge );
+        else
+            BehaviourableBase::notifyEdgeInserted( weakEdge );
     } catch ( ... ) {
         throw gtpo::bad_topology_error( "gtpo::GenGraph<>::createEdge(Node,Edge): Insertion of edge failed, source or destination nodes topology can't be modified." );
     }
     return edge;
 }
 
-template < class Config >
-typename GenGraph< Config >::WeakEdge    GenGraph< Config >::createEdge( const std::string& className, WeakNode src, WeakNode dst ) noexcept( false )
+template < class Config, class Storage >
+typename GenGraph< Config, Storage >::WeakEdge    GenGraph< Config, Storage >::createEdge( const std::string& className, WeakNode src, WeakNode dst ) noexcept( false )
 {
     return ( className == "gtpo::Edge" ) ? createEdge( src, dst ) : WeakEdge{};
 }
 
-template < class Config >
-typename GenGraph< Config >::WeakEdge    GenGraph< Config >::createEdge( const std::string& className, WeakNode src, WeakEdge dst ) noexcept( false )
+template < class Config, class Storage >
+typename GenGraph< Config, Storage >::WeakEdge    GenGraph< Config, Storage >::createEdge( const std::string& className, WeakNode src, WeakEdge dst ) noexcept( false )
 {
     return ( className == "gtpo::Edge" ) ? createEdge( src, dst ) : WeakEdge{};
 }
 
-template < class Config >
-auto    GenGraph< Config >::insertEdge( SharedEdge edge ) -> WeakEdge
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::insertEdge( SharedEdge edge ) -> WeakEdge
+{
+    checkInsertedEdge( edge );
+    edge->setGraph( this );
+    Config::template insert<SharedEdges>::into( _edges, edge );
+    return registerEdge( edge, static_cast< std::size_t >( _edges.size() - 1 ) );
+}
+
+template < class Config, class Storage >
+template < class SharedEdgesRange >
+auto    GenGraph< Config, Storage >::insertEdges( const SharedEdgesRange& edges ) -> void
+{
+    for ( const auto& edge : edges )
+        checkInsertedEdge( edge );
+    BatchScope batch{ *this };      // Notify behaviours and update root nodes once for the whole range
+    auto index = static_cast< std::size_t >( _edges.size() );
+    Config::template append_range< SharedEdges >::into( _edges, edges );
+    for ( const auto& edge : edges ) {
+        edge->setGraph( this );
+        registerEdge( edge, index++ );
+    }
+}
+
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::checkInsertedEdge( const SharedEdge& edge ) -> void
 {
     assert_throw( edge != nullptr );
-    auto source{ edge->getSrc().lock() };
-    if ( source == nullptr ||
+    if ( edge->getSrc().expired() ||
          ( edge->getDst().expired() && edge->getHDst().expired() ) )
         throw gtpo::bad_topology_error( "gtpo::GenGraph<>::insertEdge(): Error: Either source and/or destination nodes are expired." );
-    edge->setGraph( this );
-    Config::template insert<SharedEdges>::into( _edges, edge );
-    Config::template insert< WeakEdgesSearch >::into( _edgesSearch, edge );
+}
+
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::registerEdge( const SharedEdge& edge, std::size_t index ) -> WeakEdge
+{
+    auto source{ edge->getSrc().lock() };
+    edge->_graphIndex = index;
+    Config::template insert< EdgesSearch >::into( _edgesSearch, edge.get() );
     try {
         source->addOutEdge( edge );
         auto destination{ edge->getDst().lock() };
         if ( destination != nullptr ) {
             destination->addInEdge( edge );
-            if ( source.get() != destination.get() ) // If edge define is a trivial circuit, do not remove destination from root nodes
-                Config::template remove<WeakNodes>::from( _rootNodes, destination );    // Otherwise destination is no longer a root node
+            if ( source.get() != destination.get() ) { // If edge define is a trivial circuit, do not remove destination from root nodes
+                if ( isInBatch() )
+                    _batchRootNodes.push_back( destination );   // Root nodes are updated in endBatch()
+                else
+                    Config::template remove<NodesSearch>::from( _rootNodes, destination.get() );    // Otherwise destination is no longer a root node
+            }
         } else {
             auto hDestination{ edge->getHDst().lock() };
             if ( hDestination != nullptr )
                 hDestination->addInHEdge( edge );
         }
+        if ( _snapshots )
+            _snapshots->insertEdge( edge.get() );   // Hyper edges are ignored
         auto weakEdge{WeakEdge{edge}};
-        BehaviourableBase::notifyEdgeInserted( weakEdge );
+        edge->_batchPending = isInBatch();
+        if ( isInBatch() )
+            _batchEdges.push_back( weakEdge );
+        else
+            BehaviourableBase::notifyEdgeInserted( weakEdge );
     } catch ( ... ) {
         throw gtpo::bad_topology_error( "gtpo::GenGraph<>::createEdge(): Insertion of edge failed, source or destination nodes topology can't be modified." );
     }
     return edge;
 }
 
-template < class Config >
-void    GenGraph< Config >::removeEdge( WeakNode source, WeakNode destination )
+template < class Config, class Storage >
+void    GenGraph< Config, Storage >::removeEdge( WeakNode source, WeakNode destination )
 {
     if ( source.expired() ||
          destination.expired() )
         throw gtpo::bad_topology_error( "gtpo::GenGraph<>::removeEdge(): Topology error." );
 
     // Find the edge associed with source / destination
-    if ( _edges.size() == 0 )
-        return; // Fast exit
-    auto edgeIter = std::find_if( _edges.begin(), _edges.end(),
-                                 [=](const SharedEdge& e ){
-                                    return ( compare_weak_ptr<>( e->getSrc(), source ) &&
-                                             compare_weak_ptr<>( e->getDst(), destination ) );
-                                    }
-                                 ); // std::find_if
-    if ( edgeIter != _edges.end() )
-        removeEdge( *edgeIter );
+    WeakEdge edge = findEdge( source, destination );
+    if ( !edge.expired() )
+        removeEdge( edge );
 }
 
-template < class Config >
-void    GenGraph< Config >::removeAllEdges( WeakNode source, WeakNode destination )
+template < class Config, class Storage >
+void    GenGraph< Config, Storage >::removeAllEdges( WeakNode source, WeakNode destination )
 {
     if ( source.expired() ||
          destination.expired() )
         throw gtpo::bad_topology_error( "gtpo::GenGraph<>::removeEdge(): Topology error." );
 
-    while ( getEdgeCount( source, destination ) > 0 )
-        removeEdge( source, destination );
+    auto sourcePtr = source.lock();
+    auto destinationPtr = destination.lock();
+    if ( !sourcePtr || !destinationPtr )
+        throw gtpo::bad_topology_error( "gtpo::GenGraph<>::removeEdge(): Topology error." );
+    WeakEdges edges;    // Collect edges first, edge removal modify source out edges index
+    const auto& index = sourcePtr->getOutEdgesIndex();
+    auto indexed = index.equal_range( static_cast< const void* >( destinationPtr.get() ) );
+    for ( auto indexIter = indexed.first; indexIter != indexed.second; ++indexIter )
+        Config::template insert< WeakEdges >::into( edges, indexIter->second );
+    for ( auto& edge : edges )
+        removeEdge( edge );
 }
 
-template < class Config >
-void    GenGraph< Config >::removeEdge( WeakEdge edge )
+template < class Config, class Storage >
+void    GenGraph< Config, Storage >::removeEdge( WeakEdge edge )
 {
     SharedEdge edgePtr = edge.lock();
     if ( edgePtr == nullptr )
         throw gtpo::bad_topology_error( "gtpo::GenGraph<>::removeEdge(): Error: Edge to be removed is already expired." );
+    unlinkEdge( edgePtr );
+
+    // If there is in hyper edges, remove them since their destination edge is beeing destroyed
+    if ( edgePtr->getInHDegree() > 0 ) {
+        std::vector< WeakEdge > inHEdges;   // Make a deep copy of in hyper edges, they are modified by removeEdge()
+        std::copy( edgePtr->getInHEdges().cbegin(), edgePtr->getInHEdges().cend(), std::back_inserter( inHEdges ) );
+        for ( auto& inHEdge : inHEdges )
+            removeEdge( inHEdge );
+    }
+    edgePtr->setGraph( nullptr );
+    removeFromEdges( edgePtr, typename Config::Removal{} );
+    Config::template remove<EdgesSearch>::from( _edgesSearch, edgePtr.get() );
+}
+
+template < class Config, class Storage >
+template < class WeakEdgesRange >
+auto    GenGraph< Config, Storage >::removeEdges( const WeakEdgesRange& edges ) -> void
+{
+    EdgesSearch removedEdges;
+    std::vector< SharedEdge > sharedEdges;
+    auto collectEdge = [&]( const WeakEdge& weakEdge ) {
+        SharedEdge edge = weakEdge.lock();
+        if ( edge != nullptr &&
+             edge->getGraph() == this &&
+             removedEdges.find( edge.get() ) == removedEdges.end() ) {
+            Config::template insert< EdgesSearch >::into( removedEdges, edge.get() );
+            sharedEdges.emplace_back( std::move( edge ) );
+        }
+    };
+    for ( const auto& weakEdge : edges )
+        collectEdge( weakEdge );
+    for ( std::size_t e = 0; e < sharedEdges.size(); ++e ) {    // In hyper edges are removed with their destination edge
+        if ( sharedEdges[ e ]->getInHDegree() == 0 )
+            continue;
+        const auto& inHEdges = sharedEdges[ e ]->getInHEdges();
+        for ( auto inHEdge = inHEdges.cbegin(); inHEdge != inHEdges.cend(); ++inHEdge )
+            collectEdge( *inHEdge );
+    }
+    if ( sharedEdges.empty() )
+        return;
+
+    for ( auto& edge : sharedEdges ) {
+        unlinkEdge( edge );
+        Config::template remove<EdgesSearch>::from( _edgesSearch, edge.get() );
+        edge->setGraph( nullptr );
+    }
+    Config::template remove_if< SharedEdges >::from( _edges, [&removedEdges]( const SharedEdge& edge ) {
+        return removedEdges.find( edge.get() ) != removedEdges.end();
+    } );
+    std::size_t e = 0;      // Reindex remaining edges after compaction
+    for ( auto& edge : _edges )
+        edge->_graphIndex = e++;
+}
+
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::unlinkEdge( const SharedEdge& edgePtr ) -> void
+{
     auto source = edgePtr->getSrc().lock();
     auto destination = edgePtr->getDst().lock();
     auto hDestination = edgePtr->getHDst().lock();
     if ( source == nullptr ||           // Expecting a non null source and either a destination or an hyper destination
          ( destination == nullptr && hDestination == nullptr ) )
         throw gtpo::bad_topology_error( "gtpo::GenGraph<>::removeEdge(): Error: Edge source or destination are expired." );
-    BehaviourableBase::notifyEdgeRemoved( edge );
+    ++_removalCount;
+    WeakEdge edge{ edgePtr };
+    if ( !edgePtr->_batchPending )  // Behaviours have not been notified of an edge inserted in current batch
+        BehaviourableBase::notifyEdgeRemoved( edge );
+    edgePtr->_batchPending = false;
+    if ( _snapshots )
+        _snapshots->removeEdge( edgePtr.get() );
     source->removeOutEdge( edge );
     if ( destination )      // Remove edge from destination in edges
         destination->removeInEdge( edge );
     if ( hDestination )     // Remove edge from hyper destination in hyper edges
         hDestination->removeInHEdge( edge );
+}
 
-    // If there is in hyper edges, remove them since their destination edge is beeing destroyed
-    if ( edgePtr->getInHDegree() > 0 ) {
-        auto& inHEdges{ edgePtr->getInHEdges() };    // Make a deep copy of in hyper edges
-        for ( auto& inHEdge : inHEdges )
-            removeEdge( inHEdge );
-    }
-    edgePtr->setGraph( nullptr );
-    Config::template remove<SharedEdges>::from( _edges, edgePtr );
-    Config::template remove<WeakEdgesSearch>::from( _edgesSearch, edge );
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::removeFromEdges( const SharedEdge& edge, OrderedRemoval ) -> void
+{
+    Config::template remove<SharedEdges>::from( _edges, edge );
 }
 
-template < class Config >
-auto    GenGraph< Config >::findEdge( WeakNode source, WeakNode destination ) const noexcept -> WeakEdge
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::removeFromEdges( const SharedEdge& edge, UnorderedRemoval ) -> void
 {
-    // Find the edge associed with source / destination
-    auto edgeIter = std::find_if( _edges.begin(), _edges.end(),
-                                    [=](const SharedEdge& e ) noexcept {
-                                        return ( compare_weak_ptr<>( e->getSrc(), source ) &&
-                                                 compare_weak_ptr<>( e->getDst(), destination ) );
-                                    } );
-    return ( edgeIter != _edges.end() ? *edgeIter : WeakEdge{} );   // std::shared_ptr::operator* is noexcept
+    const auto position = edge->_graphIndex;
+    gtpo::assert_throw( position < static_cast< std::size_t >( _edges.size() ) &&
+                        _edges[ position ] == edge, "gtpo::GenGraph<>::removeEdge(): Error: edge graph index is invalid." );
+    Config::template swap_and_pop< SharedEdges >::from( _edges, position );
+    if ( position < static_cast< std::size_t >( _edges.size() ) )
+        _edges[ position ]->_graphIndex = position;     // Last edge has been moved at removed edge position
 }
 
-template < class Config >
-auto    GenGraph< Config >::hasEdge( WeakNode source, WeakNode destination ) const noexcept -> bool
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::findEdge( WeakNode source, WeakNode destination ) const noexcept -> WeakEdge
+{
+    // Find the edge associed with source / destination in source out edges index
+    auto sourcePtr = source.lock();
+    auto destinationPtr = destination.lock();
+    if ( !sourcePtr || !destinationPtr )
+        return WeakEdge{};
+    const auto& index = sourcePtr->getOutEdgesIndex();
+    auto indexIter = index.find( static_cast< const void* >( destinationPtr.get() ) );
+    return ( indexIter != index.cend() ? indexIter->second : WeakEdge{} );
+}
+
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::hasEdge( WeakNode source, WeakNode destination ) const noexcept -> bool
 {
     return ( findEdge( source, destination).use_count() != 0 );
 }
 
-template < class Config >
-auto    GenGraph< Config >::findEdge( WeakNode source, WeakEdge destination ) const noexcept -> WeakEdge
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::findEdge( WeakNode source, WeakEdge destination ) const noexcept -> WeakEdge
 {
-    // Find the edge associed with source / destination
-    auto edgeIter = std::find_if( _edges.begin(), _edges.end(),
-                                    [=](const SharedEdge& e ) noexcept {
-                                        return ( compare_weak_ptr<>( e->getSrc(), source ) &&
-                                                 compare_weak_ptr<>( e->getHDst(), destination ) );
-                                    } );
-    return ( edgeIter != _edges.end() ? *edgeIter : WeakEdge{} );   // std::shared_ptr::operator* is noexcept
+    // Find the hyper edge associed with source / destination edge in source out edges index
+    auto sourcePtr = source.lock();
+    auto destinationPtr = destination.lock();
+    if ( !sourcePtr || !destinationPtr )
+        return WeakEdge{};
+    const auto& index = sourcePtr->getOutEdgesIndex();
+    auto indexIter = index.find( static_cast< const void* >( destinationPtr.get() ) );
+    return ( indexIter != index.cend() ? indexIter->second : WeakEdge{} );
 }
 
-template < class Config >
-auto    GenGraph< Config >::hasEdge( WeakNode source, WeakEdge destination ) const noexcept -> bool
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::hasEdge( WeakNode source, WeakEdge destination ) const noexcept -> bool
 {
     return ( findEdge( source, destination ).use_count() != 0 );
 }
 
-template < class Config >
-auto    GenGraph< Config >::getEdgeCount( WeakNode source, WeakNode destination ) const -> unsigned int
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::getEdgeCount( WeakNode source, WeakNode destination ) const -> unsigned int
 {
-    unsigned int edgeCount = 0;
-    std::for_each( _edges.begin(), _edges.end(), [&](const SharedEdge& e ) {
-                                                        if ( compare_weak_ptr<>( e->getSrc(), source ) &&
-                                                             compare_weak_ptr<>( e->getDst(), destination ) )
-                                                            ++edgeCount;
-                                                    } );
-    return edgeCount;
+    auto sourcePtr = source.lock();
+    auto destinationPtr = destination.lock();
+    if ( !sourcePtr || !destinationPtr )
+        return 0;
+    return static_cast< unsigned int >( sourcePtr->getOutEdgesIndex().count( static_cast< const void* >( destinationPtr.get() ) ) );
 }
 
-template < class Config >
-auto    GenGraph< Config >::contains( WeakEdge edge ) const noexcept -> bool
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::contains( WeakEdge edge ) const noexcept -> bool
 {
-    if ( edge.expired() )   // Fast exit.
-        return false;
-    auto edgeIter = std::find_if( _edgesSearch.cbegin(), _edgesSearch.cend(),
-                                            [=](const WeakEdge& n ) { return ( compare_weak_ptr<>( edge, n ) ); } );
-    return edgeIter != _edgesSearch.cend();
+    return contains( edge.lock().get() );     // Expired edge lock to nullptr
 }
 //-----------------------------------------------------------------------------
 
 /* Graph Group Management *///-------------------------------------------------
-template < class Config >
-auto GenGraph< Config >::createGroup( ) -> WeakGroup
+template < class Config, class Storage >
+auto GenGraph< Config, Storage >::createGroup( ) -> WeakGroup
 {
     WeakGroup weakGroup;
     try {
-        auto group = std::make_shared< typename Config::Group >();
+        auto group = makePrimitive< typename Config::Group >( _groupsPool, typename Config::Allocation{} );
         weakGroup = insertGroup( group );
     } catch (...) { gtpo::assert_throw( false, "gtpo::GenGraph<>::createGroup(): Error: can't insert group in graph." ); }
     return weakGroup;
 }
 
-template < class Config >
-typename GenGraph< Config >::WeakGroup   GenGraph< Config >::createGroup( const std::string& className ) noexcept( false )
+template < class Config, class Storage >
+typename GenGraph< Config, Storage >::WeakGroup   GenGraph< Config, Storage >::createGroup( const std::string& className ) noexcept( false )
 {
     if ( className == "gtpo::Group" )
         return createGroup();
     return WeakGroup{};
 }
 
-template < class Config >
-auto    GenGraph< Config >::insertGroup( SharedGroup group ) noexcept( false ) -> WeakGroup
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::insertGroup( SharedGroup group ) noexcept( false ) -> WeakGroup
 {
     assert_throw( group != nullptr, "gtpo::GenGraph<>::insertGroup(): Error: trying to insert a nullptr SharedGroup" );
     WeakGroup weakGroup;
@@ -447,33 +703,122 @@ auto    GenGraph< Config >::insertGroup( SharedGroup group ) noexcept( false ) -
         weakGroup = group;
         group->setGraph( this );
         Config::template insert<SharedGroups>::into( _groups, group );
+        Config::template insert<GroupsSearch>::into( _groupsSearch, group.get() );
         this->notifyGroupInserted( weakGroup );
     } catch (...) { throw gtpo::bad_topology_error( "gtpo::GenGraph<>::insertGroup(): Insertion of group failed" ); }
     return weakGroup;
 }
 
-template < class Config >
-auto    GenGraph< Config >::removeGroup( WeakGroup weakGroup ) noexcept( false ) -> void
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::removeGroup( WeakGroup weakGroup ) noexcept( false ) -> void
 {
     gtpo::assert_throw( !weakGroup.expired(), "gtpo::GenGraph<>::removeGroup(): Error: trying to remove an expired group." );
     SharedGroup group = weakGroup.lock();
     if ( !group )
         gtpo::assert_throw( false, "GenGraph<>::removeGroup(): Error: trying to remove and expired group." );
+    ++_removalCount;
 
     // Remove group (it will be automatically deallocated)
     this->notifyGroupRemoved( weakGroup );
     group->setGraph( nullptr );
+    Config::template remove<GroupsSearch>::from( _groupsSearch, group.get() );
     Config::template remove<SharedGroups>::from( _groups, group );
 }
 
-template < class Config >
-auto    GenGraph< Config >::hasGroup( const WeakGroup& group ) const -> bool
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::hasGroup( const WeakGroup& group ) const -> bool
+{
+    return hasGroup( group.lock().get() );    // Expired group lock to nullptr
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Batch Management *///-------------------------------------------------
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::endBatch() noexcept( false ) -> void
 {
-    if ( group.expired() )
+    assert_throw( _batchDepth > 0, "gtpo::GenGraph<>::endBatch(): Error: endBatch() called without a matching beginBatch()." );
+    if ( --_batchDepth > 0 )
+        return;
+    flushBatchRootNodes();
+
+    // Primitives removed (or moved to another graph) during the batch are not notified, reinserted ones only once
+    const auto isStale = [this]( const auto& weak ) {
+        const auto primitive = weak.lock();
+        if ( primitive == nullptr || primitive->getGraph() != this || !primitive->_batchPending )
+            return true;
+        primitive->_batchPending = false;
         return false;
-    auto groupIter = std::find_if( _groups.begin(), _groups.end(),
-                                        [=](const WeakGroup& graphGroup  ){ return ( compare_weak_ptr<>( group, graphGroup ) ); } );
-    return groupIter != _groups.end();
+    };
+    _batchNodes.erase( std::remove_if( _batchNodes.begin(), _batchNodes.end(), isStale ), _batchNodes.end() );
+    _batchEdges.erase( std::remove_if( _batchEdges.begin(), _batchEdges.end(), isStale ), _batchEdges.end() );
+
+    // Swap pending notifications out: a behaviour might open a new batch while being notified
+    std::vector< WeakNode > nodes;
+    std::vector< WeakEdge > edges;
+    nodes.swap( _batchNodes );
+    edges.swap( _batchEdges );
+    if ( !nodes.empty() )
+        BehaviourableBase::notifyNodesInserted( nodes );
+    if ( !edges.empty() )
+        BehaviourableBase::notifyEdgesInserted( edges );
+}
+
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::flushBatchRootNodes() noexcept -> void
+{
+    for ( const auto& candidate : _batchRootNodes ) {
+        const auto node = candidate.lock();
+        if ( node == nullptr || node->getGraph() != this )
+            continue;
+        for ( const auto& inEdge : node->getInEdges() ) {   // Trivial circuits do not remove a node from root nodes
+            const auto edge = inEdge.lock();
+            if ( edge != nullptr &&
+                 edge->getSrc().lock().get() != node.get() ) {
+                Config::template remove<NodesSearch>::from( _rootNodes, node.get() );
+                break;
+            }
+        }
+    }
+    _batchRootNodes.clear();
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Snapshots *///-------------------------------------------------------
+template < class Config, class Storage >
+auto    GenGraph< Config, Storage >::snapshot() -> Snapshot
+{
+    if ( !_snapshots ) {    // Enable change tracking, register all actual primitives
+        _snapshots = std::make_unique< SnapshotTracker< Config > >();
+        for ( auto& node : _nodes )
+            _snapshots->insertNode( node.get() );
+        for ( auto& edge : _edges )
+            _snapshots->insertEdge( edge.get() );
+    }
+    return _snapshots->snapshot();
+}
+
+template < class Config, class Storage >
+template < class N >
+auto    GenGraph< Config, Storage >::notifyNodeModified( N& node ) noexcept -> void
+{
+    if ( _snapshots ) {
+        auto nodePtr = node.lock();
+        if ( nodePtr )
+            _snapshots->modifyNode( nodePtr.get() );
+    }
+    BehaviourableBase::notifyNodeModified( node );
+}
+
+template < class Config, class Storage >
+template < class E >
+auto    GenGraph< Config, Storage >::notifyEdgeModified( E& edge ) noexcept -> void
+{
+    if ( _snapshots ) {
+        auto edgePtr = edge.lock();
+        if ( edgePtr )
+            _snapshots->modifyEdge( edgePtr.get() );
+    }
+    BehaviourableBase::notifyEdgeModified( edge );
 }
 //-----------------------------------------------------------------------------
 
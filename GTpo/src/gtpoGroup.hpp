@@ -39,11 +39,13 @@ auto GenGroup< Config >::insertNode( WeakNode weakNode ) -> void
     gtpo::assert_throw( !weakNode.expired(), "gtpo::GenGroup<>::removeNode(): Error: trying to insert an expired node in group." );
     SharedNode node = weakNode.lock();
     gtpo::assert_throw( node != nullptr, "gtpo::GenGroup<>::removeNode(): Error: trying to insert an expired node in group." );
+    if ( hasNode( node.get() ) )    // Node adjacent edges are already counted in this group
+        return;
     try {
         SharedGroup group{ this->shared_from_this() };
         WeakGroup weakGroup{ group };
         node->setGroup( weakGroup );
-        Config::template insert<WeakNodes>::into( _nodes, node );
+        insertInNodes( node );
 
         this->notifyGroupModified( weakGroup );        // Notification
         this->notifyNodeInserted( weakNode );
@@ -51,6 +53,39 @@ auto GenGroup< Config >::insertNode( WeakNode weakNode ) -> void
     } catch (...) { gtpo::assert_throw( false, "gtpo::GenGroup<>::insertNode(): Error: can't insert node in group." ); }
 }
 
+template < class Config >
+template < class WeakNodesRange >
+auto GenGroup< Config >::insertNodes( const WeakNodesRange& weakNodes ) -> void
+{
+    std::vector< SharedNode > nodes;
+    std::size_t nodesDegree{ 0 };
+    for ( const auto& weakNode : weakNodes ) {
+        SharedNode node = weakNode.lock();
+        if ( node == nullptr ||
+             hasNode( node.get() ) )
+            continue;
+        nodesDegree += node->getInDegree() + node->getOutDegree();
+        nodes.emplace_back( std::move( node ) );
+    }
+    if ( nodes.empty() )
+        return;
+    try {
+        SharedGroup group{ this->shared_from_this() };
+        WeakGroup weakGroup{ group };
+        _adjacentEdges.reserve( _adjacentEdges.size() + nodesDegree );
+        for ( auto& node : nodes ) {
+            if ( hasNode( node.get() ) )     // Range might contains the same node more than once
+                continue;
+            node->setGroup( weakGroup );
+            insertInNodes( node );
+            WeakNode weakNode{ node };
+            this->notifyNodeInserted( weakNode );   // Notification
+        }
+        this->notifyGroupModified( weakGroup );
+        getGraph()->notifyGroupModified( weakGroup );
+    } catch (...) { gtpo::assert_throw( false, "gtpo::GenGroup<>::insertNodes(): Error: can't insert nodes in group." ); }
+}
+
 template < class Config >
 auto GenGroup< Config >::removeNode( const WeakNode& weakNode ) -> void
 {
@@ -66,20 +101,42 @@ auto GenGroup< Config >::removeNode( const WeakNode& weakNode ) -> void
 
     WeakGroup emptyGroup{};
     node->setGroup( emptyGroup );
+    Config::template remove<NodesSearch>::from( _nodesSearch, node.get() );
+    removeFromNodes( node, typename Config::Removal{} );
+}
+
+template < class Config >
+auto GenGroup< Config >::insertInNodes( const SharedNode& node ) -> void
+{
+    Config::template insert<WeakNodes>::into( _nodes, node );
+    Config::template insert<NodesSearch>::into( _nodesSearch, node.get() );
+    node->_groupIndex = static_cast< std::size_t >( _nodes.size() - 1 );
+}
+
+template < class Config >
+auto GenGroup< Config >::removeFromNodes( const SharedNode& node, OrderedRemoval ) -> void
+{
     Config::template remove<WeakNodes>::from( _nodes, node );
 }
 
+template < class Config >
+auto GenGroup< Config >::removeFromNodes( const SharedNode& node, UnorderedRemoval ) -> void
+{
+    const auto position = node->_groupIndex;
+    gtpo::assert_throw( position < static_cast< std::size_t >( _nodes.size() ) &&
+                        _nodes[ position ].lock() == node, "gtpo::GenGroup<>::removeNode(): Error: node group index is invalid." );
+    Config::template swap_and_pop< WeakNodes >::from( _nodes, position );
+    if ( position < static_cast< std::size_t >( _nodes.size() ) ) {
+        auto moved = _nodes[ position ].lock();     // Last node has been moved at removed node position
+        if ( moved )
+            moved->_groupIndex = position;
+    }
+}
+
 template < class Config >
 auto GenGroup< Config >::hasNode( const WeakNode& node ) const noexcept -> bool
 {
-    if ( node.expired() )
-        return false;
-    SharedNode groupNode = node.lock();
-    if ( groupNode == nullptr )
-        return false;
-    auto groupNodeIter = std::find_if( _nodes.begin(), _nodes.end(),
-                                        [=](const WeakNode& groupNode ){ return ( compare_weak_ptr<>( node, groupNode ) ); } );
-    return groupNodeIter != _nodes.end();
+    return hasNode( node.lock().get() );      // Expired node lock to nullptr
 }
 //-----------------------------------------------------------------------------
 
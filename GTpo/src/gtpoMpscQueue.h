@@ -0,0 +1,238 @@
+/*
+    The MIT License (MIT)
+
+    Copyright (c) 2016 Benoit AUTHEMAN
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	gtpoMpscQueue.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+
+#ifndef gtpoMpscQueue_h
+#define gtpoMpscQueue_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint64_t std::intptr_t
+#include <atomic>
+#include <chrono>
+#include <memory>           // std::unique_ptr
+#include <thread>           // std::this_thread::yield
+#include <type_traits>      // std::enable_if
+#include <utility>          // std::move
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Bounded lock-free multiple producers single consumer queue.
+ *
+ * Ring buffer with a sequence number per cell (D. Vyukov bounded queue): producers reserve a cell with a
+ * single CAS on the enqueue position, the consumer never write to a shared position. Capacity is rounded
+ * up to a power of two and never grow, a full queue reject new elements: it is up to producers to retry
+ * later (backpressure) or to drop elements.
+ *
+ * Queue maintain monotonic counters for pushed, rejected and popped elements, they could be read from any
+ * thread. tryPop() and popMany() must be called from a single consumer thread.
+ *
+ * \code
+ *   gtpo::MpscQueue< Command > queue{ 4096 };
+ *   // Producers (any thread)
+ *   if ( !queue.tryPush( Command{ ... } ) )
+ *       ;  // Queue is full, retry later or drop command
+ *   // Consumer (one thread)
+ *   queue.popMany( []( Command&& c ) { apply( c ); }, 1024 );
+ * \endcode
+ */
+template < class T >
+class MpscQueue
+{
+public:
+    using value_type    = T;
+    using size_type     = std::size_t;
+    using Counter       = std::uint64_t;
+
+    explicit MpscQueue( size_type capacity = 1024 ) :
+        _mask{ roundCapacity( capacity ) - 1 },
+        _cells{ new Cell[ _mask + 1 ] }
+    {
+        for ( size_type c = 0; c <= _mask; ++c )
+            _cells[ c ].sequence.store( c, std::memory_order_relaxed );
+    }
+    ~MpscQueue() = default;
+    MpscQueue( const MpscQueue& ) = delete;
+    MpscQueue& operator=( const MpscQueue& ) = delete;
+
+public:
+    //! Maximum number of elements that could be waiting in queue (a power of two).
+    inline auto getCapacity() const noexcept -> size_type { return _mask + 1; }
+    //! Approximate number of waiting elements (exact when producers and consumer are idle).
+    inline auto getSize() const noexcept -> size_type {
+        const size_type enqueue = _enqueuePos.load( std::memory_order_acquire );
+        const size_type dequeue = _dequeuePos.load( std::memory_order_acquire );
+        return enqueue > dequeue ? enqueue - dequeue : 0;
+    }
+    inline auto isEmpty() const noexcept -> bool { return getSize() == 0; }
+
+    //! Number of elements successfully pushed since queue creation.
+    inline auto getPushedCount() const noexcept -> Counter { return _pushed.load( std::memory_order_relaxed ); }
+    //! Number of elements rejected since queue creation because queue was full.
+    inline auto getRejectedCount() const noexcept -> Counter { return _rejected.load( std::memory_order_relaxed ); }
+    //! Number of elements popped by consumer since queue creation.
+    inline auto getPoppedCount() const noexcept -> Counter { return _popped.load( std::memory_order_relaxed ); }
+
+public:
+    /*! \brief Push \c value in queue from any thread, never block.
+     *
+     * \return false if queue is full (\c value is left untouched and rejected counter incremented).
+     */
+    auto    tryPush( T&& value ) -> bool {
+        Cell* cell = reserve();
+        if ( cell == nullptr ) {
+            _rejected.fetch_add( 1, std::memory_order_relaxed );
+            return false;
+        }
+        cell->value = std::move( value );
+        publish( cell );
+        return true;
+    }
+    auto    tryPush( const T& value ) -> bool { T copy{ value }; return tryPush( std::move( copy ) ); }
+
+    /*! \brief Push \c value in queue, yielding while queue is full for at most \c timeout.
+     *
+     * \return false if queue was still full after \c timeout (rejected counter is incremented once).
+     */
+    template < class Rep, class Period >
+    auto    push( T&& value, std::chrono::duration< Rep, Period > timeout ) -> bool {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        Cell* cell = reserve();
+        while ( cell == nullptr ) {
+            if ( std::chrono::steady_clock::now() >= deadline ) {
+                _rejected.fetch_add( 1, std::memory_order_relaxed );
+                return false;
+            }
+            std::this_thread::yield();
+            cell = reserve();
+        }
+        cell->value = std::move( value );
+        publish( cell );
+        return true;
+    }
+
+    //! Pop oldest element in \c value, return false if queue is empty (consumer thread only).
+    auto    tryPop( T& value ) -> bool {
+        const size_type pos = _dequeuePos.load( std::memory_order_relaxed );
+        Cell& cell = _cells[ pos & _mask ];
+        if ( cell.sequence.load( std::memory_order_acquire ) != pos + 1 )
+            return false;       // Empty, or oldest cell is reserved but not yet published
+        value = std::move( cell.value );
+        cell.value = T{};       // Release resources held by value before the cell is reused
+        cell.sequence.store( pos + _mask + 1, std::memory_order_release );
+        _dequeuePos.store( pos + 1, std::memory_order_release );
+        _popped.fetch_add( 1, std::memory_order_relaxed );
+        return true;
+    }
+
+    /*! \brief Pop at most \c maxCount elements, calling \c consumer( T&& ) for each of them (consumer thread only).
+     *
+     * Popping stops as soon as \c consumer return false (when \c consumer return a value convertible
+     * to bool), allowing the caller to enforce a time budget.
+     * \return the number of popped elements.
+     */
+    template < class Consumer >
+    auto    popMany( Consumer consumer, size_type maxCount = ~size_type{ 0 } ) -> size_type {
+        size_type count = 0;
+        T value{};
+        while ( count < maxCount && tryPop( value ) ) {
+            ++count;
+            if ( !invoke( consumer, std::move( value ) ) )
+                break;
+        }
+        return count;
+    }
+
+private:
+    struct Cell {
+        std::atomic< size_type >    sequence;
+        T                           value{};
+    };
+
+    static auto roundCapacity( size_type capacity ) noexcept -> size_type {
+        size_type rounded = 2;
+        while ( rounded < capacity )
+            rounded <<= 1;
+        return rounded;
+    }
+
+    //! Reserve a cell for writing, return nullptr if queue is full.
+    auto    reserve() noexcept -> Cell* {
+        size_type pos = _enqueuePos.load( std::memory_order_relaxed );
+        for ( ;; ) {
+            Cell& cell = _cells[ pos & _mask ];
+            const size_type sequence = cell.sequence.load( std::memory_order_acquire );
+            const auto diff = static_cast< std::intptr_t >( sequence ) - static_cast< std::intptr_t >( pos );
+            if ( diff == 0 ) {
+                if ( _enqueuePos.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                    return &cell;
+            } else if ( diff < 0 )
+                return nullptr;     // Cell still hold an element from previous lap: queue is full
+            else
+                pos = _enqueuePos.load( std::memory_order_relaxed );
+        }
+    }
+
+    inline auto publish( Cell* cell ) noexcept -> void {
+        const size_type pos = cell->sequence.load( std::memory_order_relaxed );
+        cell->sequence.store( pos + 1, std::memory_order_release );
+        _pushed.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    template < class Consumer >
+    static auto invoke( Consumer& consumer, T&& value ) -> typename std::enable_if< std::is_void< decltype( consumer( std::move( value ) ) ) >::value, bool >::type {
+        consumer( std::move( value ) );
+        return true;
+    }
+    template < class Consumer >
+    static auto invoke( Consumer& consumer, T&& value ) -> typename std::enable_if< !std::is_void< decltype( consumer( std::move( value ) ) ) >::value, bool >::type {
+        return static_cast< bool >( consumer( std::move( value ) ) );
+    }
+
+    const size_type             _mask;
+    std::unique_ptr< Cell[] >   _cells;
+
+    // Producers and consumer positions are kept on distinct cache lines to avoid false sharing (padding is
+    // used instead of alignas() since over-aligned types could not be heap allocated reliably in C++14)
+    static constexpr size_type cacheLine = 64;
+    char                        _pad0[ cacheLine ];
+    std::atomic< size_type >    _enqueuePos{ 0 };
+    std::atomic< Counter >      _pushed{ 0 };
+    std::atomic< Counter >      _rejected{ 0 };
+    char                        _pad1[ cacheLine ];
+    std::atomic< size_type >    _dequeuePos{ 0 };
+    std::atomic< Counter >      _popped{ 0 };
+    char                        _pad2[ cacheLine ];
+};
+
+} // ::gtpo
+
+#endif // gtpoMpscQueue_h
@@ -44,8 +44,9 @@ auto GenNode< Config >::addOutEdge( WeakEdge outEdgePtr ) -> void
         if ( !outEdgeSrc || outEdgeSrc != node )  // Out edge source should point to target node
             outEdge->setSrc( node );
         Config::template insert< WeakEdges >::into( _outEdges, outEdgePtr );
+        _outEdgesIndex.emplace( outEdge->getOutEdgeKey(), outEdgePtr );
         if ( !outEdge->getDst().expired() ) {
-            Config::template insert< WeakNodes >::into( _outNodes, outEdge->getDst() );
+            addOutNode( outEdge->getDst(), AdjacentNodes{} );
             notifyOutNodeInserted( outEdge->getDst() );
         }
     }
@@ -63,7 +64,7 @@ auto GenNode< Config >::addInEdge( WeakEdge inEdgePtr ) -> void
             inEdge->setDst( node );
         Config::template insert< WeakEdges >::into( _inEdges, inEdgePtr );
         if ( !inEdge->getSrc().expired() ) {
-            Config::template insert< WeakNodes >::into( _inNodes, inEdge->getSrc() );
+            addInNode( inEdge->getSrc(), AdjacentNodes{} );
             notifyInNodeInserted( inEdge->getSrc() );
         }
     }
@@ -84,7 +85,15 @@ auto GenNode< Config >::removeOutEdge( const WeakEdge outEdge ) -> void
         notifyOutNodeRemoved( outEdgePtr->getDst() );
     }
     Config::template remove< WeakEdges >::from( _outEdges, outEdge );
-    Config::template remove< WeakNodes >::from( _outNodes, outEdgePtr->getDst() );
+    removeOutNode( outEdgePtr->getDst(), AdjacentNodes{} );
+    auto indexed = _outEdgesIndex.equal_range( outEdgePtr->getOutEdgeKey() );
+    auto indexIter = std::find_if( indexed.first, indexed.second,
+                                   [&]( const typename OutEdgesIndex::value_type& e ) { return compare_weak_ptr<>( e.second, outEdge ); } );
+    if ( indexIter == indexed.second )  // Edge destination weak pointer modified directly with getDst(), fall back to a linear search
+        indexIter = std::find_if( _outEdgesIndex.begin(), _outEdgesIndex.end(),
+                                  [&]( const typename OutEdgesIndex::value_type& e ) { return compare_weak_ptr<>( e.second, outEdge ); } );
+    if ( indexIter != _outEdgesIndex.end() )
+        _outEdgesIndex.erase( indexIter );
     if ( getInDegree() == 0 ) {
         Graph* graph{ getGraph() };
         if ( graph != nullptr )
@@ -92,6 +101,19 @@ auto GenNode< Config >::removeOutEdge( const WeakEdge outEdge ) -> void
     }
 }
 
+template < class Config >
+auto GenNode< Config >::reindexOutEdge( const typename Config::Edge* edge, const void* previousKey ) noexcept -> void
+{
+    auto indexed = _outEdgesIndex.equal_range( previousKey );
+    auto indexIter = std::find_if( indexed.first, indexed.second,
+                                   [edge]( const typename OutEdgesIndex::value_type& e ) { return e.second.lock().get() == edge; } );
+    if ( indexIter == indexed.second )  // Edge has not been inserted in this node out edges yet
+        return;
+    WeakEdge outEdge = indexIter->second;
+    _outEdgesIndex.erase( indexIter );
+    _outEdgesIndex.emplace( edge->getOutEdgeKey(), outEdge );
+}
+
 template < class Config >
 auto GenNode< Config >::removeInEdge( const WeakEdge inEdge ) -> void
 {
@@ -106,7 +128,7 @@ auto GenNode< Config >::removeInEdge( const WeakEdge inEdge ) -> void
     gtpo::assert_throw( inEdgeSrcPtr != nullptr, "gtpo::GenNode<>::removeInEdge(): Error: In edge source is expired." );
     notifyInNodeAboutToBeRemoved( inEdgePtr->getSrc() );
     Config::template remove< WeakEdges >::from( _inEdges, inEdge );
-    Config::template remove< WeakNodes >::from( _inNodes, inEdgePtr->getSrc() );
+    removeInNode( inEdgePtr->getSrc(), AdjacentNodes{} );
     if ( getInDegree() == 0 ) {
         Graph* graph{ getGraph() };
         if ( graph != nullptr )
@@ -120,36 +142,36 @@ auto GenNode< Config >::removeInEdge( const WeakEdge inEdge ) -> void
 template < class Config >
 auto    GenNode< Config >::notifyInNodeInserted( WeakNode& inNode ) noexcept -> void
 {
-    BehaviourableBase::notifyBehaviours( &gtpo::NodeBehaviour<Config>::inNodeInserted, inNode );
-    this->sNotifyBehaviours( [&](auto& behaviour) { behaviour.inNodeInserted( inNode ); } );
+    BehaviourableBase::template notifyBehaviours< BehaviourEvent::InNodeInserted >( &gtpo::NodeBehaviour<Config>::inNodeInserted, inNode );
+    this->template sNotifyBehaviours< BehaviourEvent::InNodeInserted >( [&](auto& behaviour) noexcept { behaviour.inNodeInserted( inNode ); } );
 }
 
 template < class Config >
 auto    GenNode< Config >::notifyInNodeAboutToBeRemoved( WeakNode& inNode ) noexcept -> void
 {
-    BehaviourableBase::notifyBehaviours( &gtpo::NodeBehaviour<Config>::inNodeAboutToBeRemoved, inNode );
-    this->sNotifyBehaviours( [&](auto& behaviour) { behaviour.inNodeAboutToBeRemoved( inNode ); } );
+    BehaviourableBase::template notifyBehaviours< BehaviourEvent::InNodeAboutToBeRemoved >( &gtpo::NodeBehaviour<Config>::inNodeAboutToBeRemoved, inNode );
+    this->template sNotifyBehaviours< BehaviourEvent::InNodeAboutToBeRemoved >( [&](auto& behaviour) noexcept { behaviour.inNodeAboutToBeRemoved( inNode ); } );
 }
 
 template < class Config >
 auto    GenNode< Config >::notifyInNodeRemoved() noexcept -> void
 {
-    BehaviourableBase::notifyBehaviours0( &gtpo::NodeBehaviour<Config>::inNodeRemoved );
-    this->sNotifyBehaviours( [&](auto& behaviour) { behaviour.inNodeRemoved(); } );
+    BehaviourableBase::template notifyBehaviours0< BehaviourEvent::InNodeRemoved >( &gtpo::NodeBehaviour<Config>::inNodeRemoved );
+    this->template sNotifyBehaviours< BehaviourEvent::InNodeRemoved >( [&](auto& behaviour) noexcept { behaviour.inNodeRemoved(); } );
 }
 
 template < class Config >
 auto    GenNode< Config >::notifyOutNodeInserted( WeakNode& outNode ) noexcept -> void
 {
-    BehaviourableBase::notifyBehaviours( &gtpo::NodeBehaviour<Config>::outNodeInserted, outNode );
-    this->sNotifyBehaviours( [&](auto& behaviour) { behaviour.outNodeInserted( outNode ); } );
+    BehaviourableBase::template notifyBehaviours< BehaviourEvent::OutNodeInserted >( &gtpo::NodeBehaviour<Config>::outNodeInserted, outNode );
+    this->template sNotifyBehaviours< BehaviourEvent::OutNodeInserted >( [&](auto& behaviour) noexcept { behaviour.outNodeInserted( outNode ); } );
 }
 
 template < class Config >
 auto    GenNode< Config >::notifyOutNodeRemoved( WeakNode& outNode ) noexcept -> void
 {
-    BehaviourableBase::notifyBehaviours( &gtpo::NodeBehaviour<Config>::outNodeRemoved, outNode );
-    this->sNotifyBehaviours( [&](auto& behaviour) { behaviour.outNodeRemoved( outNode ); } );
+    BehaviourableBase::template notifyBehaviours< BehaviourEvent::OutNodeRemoved >( &gtpo::NodeBehaviour<Config>::outNodeRemoved, outNode );
+    this->template sNotifyBehaviours< BehaviourEvent::OutNodeRemoved >( [&](auto& behaviour) noexcept { behaviour.outNodeRemoved( outNode ); } );
 }
 //-----------------------------------------------------------------------------
 
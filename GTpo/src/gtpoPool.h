@@ -0,0 +1,185 @@
+/*
+    The MIT License (MIT)
+
+    Copyright (c) 2016 Benoit AUTHEMAN
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	gtpoPool.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef gtpoPool_h
+#define gtpoPool_h
+
+// STD headers
+#include <cstddef>          // std::size_t std::max_align_t
+#include <vector>
+#include <memory>           // std::shared_ptr std::unique_ptr
+#include <mutex>
+#include <new>              // ::operator new
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Fixed size blocks free list memory pool allocating blocks in large contiguous chunks.
+ *
+ * Pool block size is fixed by the first allocation, subsequent requests of a different size are
+ * rejected (allocate() return nullptr) and should be served by the caller from the global heap.
+ * Blocks carved from a chunk are returned in address order, primitives created in sequence are thus
+ * stored contiguously.
+ *
+ * Allocation and deallocation are protected by a mutex: a primitive might be released from a thread
+ * that does not own its graph (for example when the last std::weak_ptr on it is reset from a worker thread).
+ */
+class MemoryPool
+{
+public:
+    explicit MemoryPool( std::size_t blocksPerChunk = 1024 ) noexcept :
+        _blocksPerChunk{ blocksPerChunk > 0 ? blocksPerChunk : 1 } { }
+    ~MemoryPool() noexcept = default;
+    MemoryPool( const MemoryPool& ) = delete;
+    MemoryPool& operator=( const MemoryPool& ) = delete;
+
+    /*! \brief Allocate a block of \c size bytes, return nullptr if request can't be served by this pool.
+     *
+     * \throw std::bad_alloc if a new chunk can't be allocated.
+     */
+    auto    allocate( std::size_t size, std::size_t alignment ) -> void* {
+        std::lock_guard< std::mutex > lock{ _mutex };
+        if ( _blockSize == 0 &&
+             alignment <= alignof( std::max_align_t ) )
+            _blockSize = roundSize( size );
+        if ( !accepts( size, alignment ) )
+            return nullptr;
+        if ( _free == nullptr )
+            allocateChunk();
+        FreeBlock* block = _free;
+        _free = block->next;
+        ++_usedCount;
+        return block;
+    }
+
+    //! Return \c block (previously allocated with allocate()) to the pool free list.
+    auto    deallocate( void* block ) noexcept -> void {
+        if ( block == nullptr )
+            return;
+        std::lock_guard< std::mutex > lock{ _mutex };
+        FreeBlock* freeBlock = static_cast< FreeBlock* >( block );
+        freeBlock->next = _free;
+        _free = freeBlock;
+        --_usedCount;
+    }
+
+    //! Return true if a request of \c size bytes with \c alignment is served by this pool.
+    inline auto accepts( std::size_t size, std::size_t alignment ) const noexcept -> bool {
+        return _blockSize != 0 && roundSize( size ) == _blockSize && alignment <= alignof( std::max_align_t );
+    }
+
+    /*! \brief Release all chunks to the global heap at once if no block is actually in use.
+     *
+     * \return true if memory has been released.
+     */
+    auto    trim() noexcept -> bool {
+        std::lock_guard< std::mutex > lock{ _mutex };
+        if ( _usedCount != 0 )
+            return false;
+        _free = nullptr;
+        _chunks.clear();
+        return true;
+    }
+
+    inline auto getBlockSize() const noexcept -> std::size_t { return _blockSize; }
+    inline auto getUsedCount() const noexcept -> std::size_t { return _usedCount; }
+    inline auto getChunkCount() const noexcept -> std::size_t { return _chunks.size(); }
+
+private:
+    struct FreeBlock { FreeBlock* next; };
+
+    static inline auto roundSize( std::size_t size ) noexcept -> std::size_t {
+        constexpr std::size_t align = alignof( std::max_align_t );
+        size = size < sizeof( FreeBlock ) ? sizeof( FreeBlock ) : size;
+        return ( size + align - 1 ) / align * align;
+    }
+
+    auto    allocateChunk() -> void {
+        std::unique_ptr< unsigned char[] > chunk{ new unsigned char[ _blockSize * _blocksPerChunk ] };
+        for ( std::size_t b = _blocksPerChunk; b > 0; --b ) {     // Push in reverse order to allocate in address order
+            FreeBlock* block = reinterpret_cast< FreeBlock* >( chunk.get() + ( b - 1 ) * _blockSize );
+            block->next = _free;
+            _free = block;
+        }
+        _chunks.emplace_back( std::move( chunk ) );
+    }
+
+    std::mutex          _mutex;
+    std::size_t         _blocksPerChunk{ 1024 };
+    std::size_t         _blockSize{ 0 };
+    std::size_t         _usedCount{ 0 };
+    FreeBlock*          _free{ nullptr };
+    std::vector< std::unique_ptr< unsigned char[] > >   _chunks;
+};
+
+/*! \brief Standard allocator serving single object allocations from a shared gtpo::MemoryPool.
+ *
+ * Intended for std::allocate_shared(): the shared_ptr control block keep a copy of the allocator, and
+ * thus a reference on the pool, pool memory is released only once the last primitive (and the last
+ * std::weak_ptr on it) is destroyed, even if the pool owner has already been destroyed.
+ */
+template < class T >
+class PoolAllocator
+{
+public:
+    using value_type = T;
+
+    explicit PoolAllocator( std::shared_ptr< MemoryPool > pool ) noexcept : _pool{ std::move( pool ) } { }
+    template < class U >
+    PoolAllocator( const PoolAllocator< U >& other ) noexcept : _pool{ other.getPool() } { }
+
+    auto    allocate( std::size_t n ) -> T* {
+        if ( n == 1 ) {
+            void* block = _pool->allocate( sizeof( T ), alignof( T ) );
+            if ( block != nullptr )
+                return static_cast< T* >( block );
+        }
+        return static_cast< T* >( ::operator new( n * sizeof( T ) ) );
+    }
+    auto    deallocate( T* p, std::size_t n ) noexcept -> void {
+        if ( n == 1 && _pool->accepts( sizeof( T ), alignof( T ) ) )
+            _pool->deallocate( p );
+        else
+            ::operator delete( p );
+    }
+
+    inline auto getPool() const noexcept -> const std::shared_ptr< MemoryPool >& { return _pool; }
+private:
+    std::shared_ptr< MemoryPool >   _pool;
+};
+
+template < class T, class U >
+inline bool operator==( const PoolAllocator< T >& a, const PoolAllocator< U >& b ) noexcept { return a.getPool() == b.getPool(); }
+template < class T, class U >
+inline bool operator!=( const PoolAllocator< T >& a, const PoolAllocator< U >& b ) noexcept { return a.getPool() != b.getPool(); }
+
+} // ::gtpo
+
+#endif // gtpoPool_h
@@ -40,6 +40,7 @@
 // STD headers
 #include <deque>
 #include <iostream>
+#include <atomic>
 
 namespace gtpo { // ::gtpo
 
@@ -126,6 +127,7 @@ public:
     virtual void    reset() {
         _subProgressQueue.clear( );
         _subProgress.clear();
+        _canceled = false;
         notifyModified();
     }
 
@@ -293,6 +295,25 @@ protected:
     std::string _label  = "";
     //@}
     //-------------------------------------------------------------------------
+
+    /*! \name Cancellation Management *///-------------------------------------
+    //@{
+public:
+    /*! \brief Request cancellation of the monitored task, could be called from any thread.
+     *
+     * Cancellation is cooperative: long tasks poll isCanceled() (or isCanceled() of their super progress)
+     * and return early with a partial result, reset() clear a pending cancellation request.
+     */
+    void            cancel() noexcept { _canceled = true; }
+
+    //! Return true if cancel() has been called on this notifier or on one of its super progress notifiers.
+    bool            isCanceled() const noexcept {
+        return _canceled || ( _superProgress != nullptr && _superProgress->isCanceled() );
+    }
+private:
+    std::atomic< bool > _canceled{ false };
+    //@}
+    //-------------------------------------------------------------------------
 };
 
 
@@ -39,6 +39,7 @@
 // STD headers
 #include <fstream>
 #include <unordered_map>    // ObjectIdMap
+#include <memory>           // std::weak_ptr
 
 #ifdef GTPO_HAS_PROTOBUF
 
@@ -222,6 +223,51 @@ public:
                                  Graph& graph,
                                  gtpo::IProgressNotifier& progress ) -> void;
 
+    //! Position of a resumable in serialization, see serializeInSome().
+    struct InCursor {
+        int     group{ 0 };
+        int     node{ 0 };
+        int     edge{ 0 };
+
+        //! Id to object map of this serialization, used instead of getIdObjectMap() so that another load can't modify it between calls.
+        IdObjectMap     idObjectMap;
+        //! Primitives created by this serialization, keyed by their address in \c idObjectMap (used to detect primitives removed between calls).
+        std::unordered_map< const void*, std::weak_ptr< void > >  primitives;
+        //! Graph removal count when expired primitives have last been pruned from \c idObjectMap, see gtpo::GenGraph::getRemovalCount().
+        std::size_t     removalCount{ 0 };
+
+        //! Return true when all \c pbGraph groups, nodes and edges have been serialized in.
+        auto    isDone( const gtpo::pb::Graph& pbGraph ) const noexcept -> bool {
+            return group >= pbGraph.groups_size() && node >= pbGraph.nodes_size() && edge >= pbGraph.edges_size();
+        }
+        //! Return in serialization progress between 0. and 1.
+        auto    getProgress( const gtpo::pb::Graph& pbGraph ) const noexcept -> double {
+            const int count = pbGraph.groups_size() + pbGraph.nodes_size() + pbGraph.edges_size();
+            return count > 0 ? static_cast< double >( group + node + edge ) / count : 1.;
+        }
+    };
+
+    /*! \brief Resumable in serialization: serialize at most \c maxCount primitives from \c pbGraph starting at \c cursor.
+     *
+     * Used to split a long serialization over multiple calls (for example one call per frame in a GUI thread), \c pbGraph
+     * must stay alive and unmodified between calls. Unlike serializeIn(), behaviours are notified for every primitive
+     * (there is no batch scope spanning multiple calls).
+     *
+     * Ids are resolved with \c cursor own id map (serializer getIdObjectMap() is not used), \c graph might be modified
+     * between calls: ids of primitives that have been removed from \c graph are forgotten, primitives referencing them
+     * are serialized in as if the id was unknown.
+     * \code
+     *   gtpo::ProtoSerializer<>::InCursor cursor;
+     *   while ( !serializer.serializeInSome( pbGraph, graph, cursor, 1000 ) )
+     *       ; // Do something else between calls...
+     * \endcode
+     * \return true when \c pbGraph has been completely serialized in.
+     */
+    auto            serializeInSome( const gtpo::pb::Graph& pbGraph,
+                                     Graph& graph,
+                                     InCursor& cursor,
+                                     int maxCount ) -> bool;
+
     /*! Serialize Protocol Buffer gtpo.pb.GTpoNode \c pbNode to GTpo node \c weakNode.
      *
      * \throw noexcept
@@ -236,6 +282,16 @@ public:
      */
     static void     serializeGTpoGroupIn( const gtpo::pb::Group& pbGroup, WeakGroup& weakGroup, IdObjectMap& idObjectMap );
 
+protected:
+    //! Serialize in group \c anyGroup with the first registered group in functor that accept it, return an expired group on failure.
+    auto            serializeGroupIn( const google::protobuf::Any& anyGroup, Graph& graph, IdObjectMap& idObjectMap ) -> WeakGroup;
+    //! \copydoc serializeGroupIn()
+    auto            serializeNodeIn( const google::protobuf::Any& anyNode, Graph& graph, IdObjectMap& idObjectMap ) -> WeakNode;
+    //! \copydoc serializeGroupIn()
+    auto            serializeEdgeIn( const google::protobuf::Any& anyEdge, Graph& graph, IdObjectMap& idObjectMap ) -> WeakEdge;
+    //! Erase \c cursor id map entries referencing a primitive that has been destroyed since it was serialized in.
+    static auto     pruneExpired( InCursor& cursor ) noexcept -> void;
+
 public:
     //! Serialize a Protocol Buffer "Any" node to a given graph, return true if serialization succeed.
     using   NodeInFunctor = std::function<WeakNode( const google::protobuf::Any&, Graph&, IdObjectMap& idObjectMap )>;
@@ -431,6 +431,7 @@ auto    ProtoSerializer< GraphConfig >::serializeIn( const gtpo::pb::Graph& pbGr
                                                      Graph& graph,
                                                      gtpo::IProgressNotifier& progress ) -> void
 {
+    typename Graph::BatchScope batch{ graph };    // Notify behaviours once all nodes and edges are loaded
     progress.reserveSubProgress( 3 );
     gtpo::IProgressNotifier& nodesProgress = progress.takeSubProgress();
     nodesProgress.beginProgress( "Loading nodes" );
@@ -443,66 +444,18 @@ auto    ProtoSerializer< GraphConfig >::serializeIn( const gtpo::pb::Graph& pbGr
     int serializedGroupCout = 0;
     gtpo::IProgressNotifier& groupsProgress = progress.takeSubProgress();
     groupsProgress.beginProgress( "Loading groups" );
-    for ( const google::protobuf::Any& anyGroup : pbGraph.groups() ) {    // Serializing groups in
-        bool groupSerialized = false;
-        for ( auto& groupInFunctor : _groupInFunctors ) {
-            WeakGroup serializedGroup;
-            if ( groupInFunctor )
-                serializedGroup = groupInFunctor( anyGroup, graph, idObjectMap );
-            if ( !serializedGroup.expired() ) {
-                groupSerialized = true;
-                ++serializedGroupCout;
-                break;
-            }
-        }
-        if ( !groupSerialized ) {
-            std::cerr << "gtpo::ProtoSerializer::serializeIn(): Warning: A Protocol Buffer group has not been serialized in successfuly." << std::endl;
-            std::cerr << "\tProtocol Buffer Error:" << anyGroup.type_url() << std::endl;
-        }
-    }
+    for ( const google::protobuf::Any& anyGroup : pbGraph.groups() )     // Serializing groups in
+        serializedGroupCout += serializeGroupIn( anyGroup, graph, idObjectMap ).expired() ? 0 : 1;
     groupsProgress.endProgress();
-    try {
-        for ( const google::protobuf::Any& anyNode : pbGraph.nodes() ) {    // Serializing nodes in
-            WeakNode node;
-            for ( auto& nodeInFunctor : _nodeInFunctors ) {
-                if ( nodeInFunctor ) {
-                    node = nodeInFunctor( anyNode, graph, idObjectMap );
-                    if ( !node.expired() ) {
-                        ++serializedNodeCout;
-                        break;
-                    }
-                }
-            }
-            if ( !node.lock() ) {
-                std::cerr << "gtpo::ProtoSerializer::serializeIn(): Warning: A Protocol Buffer node has not been serialized in successfuly." << std::endl;
-                std::cerr << "\tProtocol Buffer Error:" << anyNode.type_url() << std::endl;
-            }
-        }
-    } catch ( const std::exception& e ) { std::cerr << "gtpo::ProtoSerializer::serializeIn(): Error while serializing in a node:" << e.what() << std::endl; }
-      catch ( ... ) { std::cerr << "gtpo::ProtoSerializer::serializeIn(): Unknown error while serializing in a node:" << std::endl;  }
+    for ( const google::protobuf::Any& anyNode : pbGraph.nodes() )       // Serializing nodes in
+        serializedNodeCout += serializeNodeIn( anyNode, graph, idObjectMap ).expired() ? 0 : 1;
     nodesProgress.endProgress();
 
     if ( idObjectMap.size() > 0 ) {   // No need to start edge serialization if node id map is empty...
         gtpo::IProgressNotifier& edgesProgress = progress.takeSubProgress();
         edgesProgress.beginProgress( "Loading edges" );
-        for ( const google::protobuf::Any& anyEdge : pbGraph.edges() ) {    // Serializing edges in
-            bool edgeSerialized = false;
-            WeakEdge edge{};
-            for ( auto& edgeInFunctor : _edgeInFunctors ) {
-                if ( edgeInFunctor ) {
-                    edge = edgeInFunctor( anyEdge, graph, idObjectMap );
-                    if ( !edge.expired() ) {
-                        edgeSerialized = true;
-                        ++serializedEdgeCout;
-                        break;
-                    }
-                }
-            }
-            if ( !edgeSerialized ) {
-                std::cerr << "gtpo::ProtoSerializer::serializeIn(): Warning: A Protocol Buffer edge has not been serialized in successfuly." << std::endl;
-                std::cerr << "\tProtocol Buffer Error:" << anyEdge.type_url() << std::endl;
-            }
-        }
+        for ( const google::protobuf::Any& anyEdge : pbGraph.edges() )   // Serializing edges in
+            serializedEdgeCout += serializeEdgeIn( anyEdge, graph, idObjectMap ).expired() ? 0 : 1;
         edgesProgress.endProgress();
     }
 
@@ -515,6 +468,106 @@ auto    ProtoSerializer< GraphConfig >::serializeIn( const gtpo::pb::Graph& pbGr
     progress.endProgress();
 }
 
+template < class GraphConfig >
+auto    ProtoSerializer< GraphConfig >::serializeInSome( const gtpo::pb::Graph& pbGraph,
+                                                         Graph& graph,
+                                                         InCursor& cursor,
+                                                         int maxCount ) -> bool
+{
+    IdObjectMap& idObjectMap = cursor.idObjectMap;
+    // Primitives might have been removed by user or by behaviours since last primitive: forget their ids before they are dereferenced
+    const auto checkRemovals = [&cursor, &graph]() {
+        if ( cursor.removalCount != graph.getRemovalCount() ) {
+            pruneExpired( cursor );
+            cursor.removalCount = graph.getRemovalCount();
+        }
+    };
+    const auto record = [&cursor]( const auto& weakPrimitive ) {
+        const auto primitive = weakPrimitive.lock();
+        if ( primitive )
+            cursor.primitives[ primitive.get() ] = primitive;
+    };
+    // Groups first, then nodes, then edges (edges reference nodes, nodes reference groups)
+    for ( ; maxCount > 0 && cursor.group < pbGraph.groups_size(); ++cursor.group, --maxCount ) {
+        checkRemovals();
+        record( serializeGroupIn( pbGraph.groups( cursor.group ), graph, idObjectMap ) );
+    }
+    for ( ; maxCount > 0 && cursor.node < pbGraph.nodes_size(); ++cursor.node, --maxCount ) {
+        checkRemovals();
+        record( serializeNodeIn( pbGraph.nodes( cursor.node ), graph, idObjectMap ) );
+    }
+    for ( ; maxCount > 0 && cursor.edge < pbGraph.edges_size(); ++cursor.edge, --maxCount ) {
+        checkRemovals();
+        record( serializeEdgeIn( pbGraph.edges( cursor.edge ), graph, idObjectMap ) );
+    }
+    checkRemovals();    // Let caller resolve ids in cursor id map once serialization is done
+    return cursor.isDone( pbGraph );
+}
+
+template < class GraphConfig >
+auto    ProtoSerializer< GraphConfig >::pruneExpired( InCursor& cursor ) noexcept -> void
+{
+    for ( auto idObject = cursor.idObjectMap.begin(); idObject != cursor.idObjectMap.end(); ) {
+        const auto primitive = cursor.primitives.find( idObject->second );
+        if ( primitive != cursor.primitives.end() &&
+             primitive->second.expired() ) {
+            cursor.primitives.erase( primitive );
+            idObject = cursor.idObjectMap.erase( idObject );
+        } else
+            ++idObject;
+    }
+}
+
+template < class GraphConfig >
+auto    ProtoSerializer< GraphConfig >::serializeGroupIn( const google::protobuf::Any& anyGroup, Graph& graph, IdObjectMap& idObjectMap ) -> WeakGroup
+{
+    for ( auto& groupInFunctor : _groupInFunctors ) {
+        WeakGroup serializedGroup;
+        if ( groupInFunctor )
+            serializedGroup = groupInFunctor( anyGroup, graph, idObjectMap );
+        if ( !serializedGroup.expired() )
+            return serializedGroup;
+    }
+    std::cerr << "gtpo::ProtoSerializer::serializeIn(): Warning: A Protocol Buffer group has not been serialized in successfuly." << std::endl;
+    std::cerr << "\tProtocol Buffer Error:" << anyGroup.type_url() << std::endl;
+    return WeakGroup{};
+}
+
+template < class GraphConfig >
+auto    ProtoSerializer< GraphConfig >::serializeNodeIn( const google::protobuf::Any& anyNode, Graph& graph, IdObjectMap& idObjectMap ) -> WeakNode
+{
+    try {
+        for ( auto& nodeInFunctor : _nodeInFunctors ) {
+            WeakNode serializedNode;
+            if ( nodeInFunctor )
+                serializedNode = nodeInFunctor( anyNode, graph, idObjectMap );
+            if ( !serializedNode.expired() )
+                return serializedNode;
+        }
+    } catch ( const std::exception& e ) { std::cerr << "gtpo::ProtoSerializer::serializeIn(): Error while serializing in a node:" << e.what() << std::endl; return WeakNode{}; }
+      catch ( ... ) { std::cerr << "gtpo::ProtoSerializer::serializeIn(): Unknown error while serializing in a node:" << std::endl; return WeakNode{}; }
+    std::cerr << "gtpo::ProtoSerializer::serializeIn(): Warning: A Protocol Buffer node has not been serialized in successfuly." << std::endl;
+    std::cerr << "\tProtocol Buffer Error:" << anyNode.type_url() << std::endl;
+    return WeakNode{};
+}
+
+template < class GraphConfig >
+auto    ProtoSerializer< GraphConfig >::serializeEdgeIn( const google::protobuf::Any& anyEdge, Graph& graph, IdObjectMap& idObjectMap ) -> WeakEdge
+{
+    if ( idObjectMap.size() == 0 )      // No need to serialize edges if node id map is empty...
+        return WeakEdge{};
+    for ( auto& edgeInFunctor : _edgeInFunctors ) {
+        WeakEdge serializedEdge;
+        if ( edgeInFunctor )
+            serializedEdge = edgeInFunctor( anyEdge, graph, idObjectMap );
+        if ( !serializedEdge.expired() )
+            return serializedEdge;
+    }
+    std::cerr << "gtpo::ProtoSerializer::serializeIn(): Warning: A Protocol Buffer edge has not been serialized in successfuly." << std::endl;
+    std::cerr << "\tProtocol Buffer Error:" << anyEdge.type_url() << std::endl;
+    return WeakEdge{};
+}
+
 template < class GraphConfig >
 void    ProtoSerializer< GraphConfig >::serializeGTpoNodeIn( const gtpo::pb::Node& pbNode,
                                                              WeakNode& weakNode,
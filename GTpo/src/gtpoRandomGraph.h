@@ -32,6 +32,8 @@
 #include <random>
 #include <cstdlib>
 #include <sstream>
+#include <vector>
+#include <algorithm>        // std::max
 
 // GTPO headers
 #include "./gtpoUtils.h"
@@ -63,23 +65,26 @@ public:
             return;
 
         std::vector< typename Graph::WeakNode > nodes;
-        for ( int n = 0; n < config.nodeCount; ++n ) {
-            auto node = graph.createNode( config.nodeClassName );
-            if ( !node.expired() )
-                nodes.push_back( node );
-        }
-        if ( nodes.size() < 2 )
-            return;
         std::random_device rd;
         std::mt19937 gen( 200 );
-        std::uniform_int_distribution< int > outNodeDist( config.outNodeRng.first, config.outNodeRng.second );
-        std::uniform_int_distribution< int > nodeIndexDist( 0, (int)nodes.size()-1 );
-        for ( auto source: nodes ) {
-            int outNodeCount = outNodeDist( gen );
-            for ( int outNode = 0; outNode < outNodeCount; ++outNode ) {
-                auto destination = nodes[ nodeIndexDist( gen ) ];
-                if ( !gtpo::compare_weak_ptr( source, destination ) )
-                graph.createEdge( config.edgeClassName, source, destination );
+        {
+            typename Graph::BatchScope batch{ graph };    // Notify behaviours once topology has been generated
+            for ( int n = 0; n < config.nodeCount; ++n ) {
+                auto node = graph.createNode( config.nodeClassName );
+                if ( !node.expired() )
+                    nodes.push_back( node );
+            }
+            if ( nodes.size() < 2 )
+                return;
+            std::uniform_int_distribution< int > outNodeDist( config.outNodeRng.first, config.outNodeRng.second );
+            std::uniform_int_distribution< int > nodeIndexDist( 0, (int)nodes.size()-1 );
+            for ( auto source: nodes ) {
+                int outNodeCount = outNodeDist( gen );
+                for ( int outNode = 0; outNode < outNodeCount; ++outNode ) {
+                    auto destination = nodes[ nodeIndexDist( gen ) ];
+                    if ( !gtpo::compare_weak_ptr( source, destination ) )
+                    graph.createEdge( config.edgeClassName, source, destination );
+                }
             }
         }
 
@@ -101,6 +106,92 @@ public:
             }
         }
     }
+
+    /*! \brief Resumable random graph generator, generate a graph similar to generate() in multiple steps.
+     *
+     * Nodes are created first (with their random label and geometry), then edges, source node by source node.
+     * Used to spread a long generation over multiple frames in a GUI thread:
+     * \code
+     *   RandomGraph::Generator< stpo::Graph > generator{ graph, config };
+     *   while ( !generator.step( 100 ) )
+     *       std::cout << generator.getProgress() << std::endl;
+     * \endcode
+     * \note \c graph must outlive generator, behaviours are notified for every created primitive.
+     */
+    template < class Graph >
+    class Generator
+    {
+    public:
+        Generator( Graph& graph, const RandomConfig& config ) :
+            _graph( graph ), _config( config ), _gen( 200 ),
+            _outNodeDist( config.outNodeRng.first, config.outNodeRng.second ),
+            _xDist( config.xRng.first, config.xRng.second ), _yDist( config.yRng.first, config.yRng.second ),
+            _widthDist( config.widthRng.first, config.widthRng.second ), _heightDist( config.heightRng.first, config.heightRng.second )
+        {
+            if ( _config.isValid() )
+                _nodes.reserve( static_cast< std::size_t >( std::max( 0, _config.nodeCount ) ) );
+        }
+        Generator( const Generator& ) = delete;
+
+        //! Generate at most \c maxCount nodes or source nodes out edges, return true when generation is complete.
+        auto    step( int maxCount ) -> bool {
+            if ( !_config.isValid() )
+                return true;
+            for ( ; maxCount > 0 && _createdNodes < _config.nodeCount; --maxCount )
+                createNode();
+            if ( _createdNodes < _config.nodeCount )
+                return false;
+            if ( _nodes.size() < 2 )
+                return true;
+            std::uniform_int_distribution< int > nodeIndexDist( 0, static_cast< int >( _nodes.size() ) - 1 );
+            for ( ; maxCount > 0 && _source < _nodes.size(); --maxCount, ++_source ) {
+                const int outNodeCount = _outNodeDist( _gen );
+                for ( int outNode = 0; outNode < outNodeCount; ++outNode ) {
+                    auto destination = _nodes[ static_cast< std::size_t >( nodeIndexDist( _gen ) ) ];
+                    if ( !gtpo::compare_weak_ptr( _nodes[ _source ], destination ) )
+                        _graph.createEdge( _config.edgeClassName, _nodes[ _source ], destination );
+                }
+            }
+            return isDone();
+        }
+
+        auto    isDone() const noexcept -> bool {
+            return !_config.isValid() ||
+                   ( _createdNodes >= _config.nodeCount && ( _nodes.size() < 2 || _source >= _nodes.size() ) );
+        }
+        //! Return generation progress between 0. and 1. (node creation and edge creation are weighted equally).
+        auto    getProgress() const noexcept -> double {
+            if ( isDone() )
+                return 1.;
+            const double nodeCount = static_cast< double >( _config.nodeCount );
+            return ( static_cast< double >( _createdNodes ) + static_cast< double >( _source ) ) / ( 2. * nodeCount );
+        }
+
+    private:
+        auto    createNode() -> void {
+            ++_createdNodes;
+            auto weakNode = _graph.createNode( _config.nodeClassName );
+            typename Graph::SharedNode node = weakNode.lock();
+            if ( !node )
+                return;
+            std::ostringstream ostr; ostr << _nodes.size();
+            Graph::Configuration::setLabel( node.get(), std::string( "Node #" ) + ostr.str() );
+            Graph::Configuration::setX( node.get(), _xDist( _gen ) );
+            Graph::Configuration::setNodeY( node.get(), _yDist( _gen ) );
+            Graph::Configuration::setWidth( node.get(), _widthDist( _gen ) );
+            Graph::Configuration::setHeight( node.get(), _heightDist( _gen ) );
+            _nodes.push_back( weakNode );
+        }
+
+        Graph&                                      _graph;
+        const RandomConfig                          _config;
+        std::mt19937                                _gen;
+        std::uniform_int_distribution< int >        _outNodeDist;
+        std::uniform_real_distribution< double >    _xDist, _yDist, _widthDist, _heightDist;
+        std::vector< typename Graph::WeakNode >     _nodes;
+        int                                         _createdNodes = 0;
+        std::size_t                                 _source = 0;
+    };
 };
 
 #endif // gtpoRandomGraph_h
@@ -0,0 +1,239 @@
+/*
+    The MIT License (MIT)
+
+    Copyright (c) 2016 Benoit AUTHEMAN
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	gtpoSlotMap.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef gtpoSlotMap_h
+#define gtpoSlotMap_h
+
+// STD headers
+#include <cstdint>
+#include <cstddef>          // std::size_t
+#include <vector>
+#include <functional>       // std::hash
+#include <utility>          // std::move
+
+// GTpo headers
+#include "./gtpoUtils.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Stable 32 bits generational handle on an item stored in a gtpo::SlotMap.
+ *
+ * A handle pack a 24 bits slot index and an 8 bits generation counter: a handle on a removed
+ * item is detected as stale even if its slot has been reused by another item. Handles are
+ * cheap to copy, hash and compare, they are the dense storage equivalent of GTpo std::weak_ptr.
+ *
+ * \note \c T is only used as a tag to prevent mixing node, edge and group handles.
+ */
+template < class T >
+class Handle
+{
+public:
+    using Value = std::uint32_t;
+
+    static constexpr Value  indexBits   = 24;
+    static constexpr Value  indexMask   = ( Value{1} << indexBits ) - 1;
+    static constexpr Value  maxIndex    = indexMask - 1;     // indexMask is reserved for the null handle
+    static constexpr Value  generationMask = 0xFF;
+    static constexpr Value  nullValue   = ~Value{0};
+
+    Handle() noexcept = default;
+    Handle( Value index, Value generation ) noexcept :
+        _value{ ( ( generation & generationMask ) << indexBits ) | ( index & indexMask ) } { }
+
+    //! Return the raw 32 bits handle value.
+    inline auto     getValue() const noexcept -> Value { return _value; }
+    inline auto     getIndex() const noexcept -> Value { return _value & indexMask; }
+    inline auto     getGeneration() const noexcept -> Value { return _value >> indexBits; }
+
+    //! Return true if this handle is the null handle (a non null handle might still be stale, check it with SlotMap::contains()).
+    inline auto     isNull() const noexcept -> bool { return _value == nullValue; }
+    inline explicit operator bool() const noexcept { return !isNull(); }
+
+    inline bool     operator==( const Handle& other ) const noexcept { return _value == other._value; }
+    inline bool     operator!=( const Handle& other ) const noexcept { return _value != other._value; }
+    inline bool     operator<( const Handle& other ) const noexcept { return _value < other._value; }
+private:
+    Value           _value{ nullValue };
+};
+
+/*! \brief Generational slot map storing items contiguously and giving out stable gtpo::Handle on them.
+ *
+ * Items are stored in a dense std::vector (iteration is contiguous), an indirection table map handle
+ * slot indices to dense positions. Insertion, lookup and removal are O(1): removal move the last dense
+ * item in the removed item position.
+ *
+ * Slots are recycled through a free list, a slot whose generation counter would wrap is retired
+ * so that a stale handle can never alias a newer item.
+ *
+ * \note Item pointers returned by get() are invalidated by any insertion or removal, keep handles instead.
+ */
+template < class T >
+class SlotMap
+{
+public:
+    using Handle        = gtpo::Handle< T >;
+    using Items         = std::vector< T >;
+    using Size          = typename Items::size_type;
+    using iterator      = typename Items::iterator;
+    using const_iterator = typename Items::const_iterator;
+
+    SlotMap() = default;
+    ~SlotMap() = default;
+    SlotMap( const SlotMap& ) = delete;
+    SlotMap& operator=( const SlotMap& ) = delete;
+
+    /*! \brief Construct a new item in place and return a stable handle on it.
+     *
+     * \throw gtpo::bad_topology_error if the handle index space is exhausted.
+     */
+    template < class... Args >
+    auto    emplace( Args&&... args ) noexcept( false ) -> Handle {
+        typename Handle::Value slotIndex{ 0 };
+        if ( !_freeSlots.empty() ) {
+            slotIndex = _freeSlots.back();
+            _freeSlots.pop_back();
+        } else {
+            assert_throw( _slots.size() <= Handle::maxIndex, "gtpo::SlotMap<>::emplace(): Error: handle index space exhausted." );
+            slotIndex = static_cast< typename Handle::Value >( _slots.size() );
+            _slots.emplace_back( );
+        }
+        _items.emplace_back( std::forward<Args>( args )... );
+        _itemSlots.push_back( slotIndex );
+        Slot& slot = _slots[ slotIndex ];
+        slot.position = static_cast< typename Handle::Value >( _items.size() - 1 );
+        return Handle{ slotIndex, slot.generation };
+    }
+
+    /*! \brief Remove item referenced by \c handle, all existing handles on this item become stale.
+     *
+     * \return false if \c handle was already stale.
+     */
+    auto    erase( Handle handle ) noexcept -> bool {
+        if ( !contains( handle ) )
+            return false;
+        Slot& slot = _slots[ handle.getIndex() ];
+        const auto position = slot.position;
+        const auto last = static_cast< typename Handle::Value >( _items.size() - 1 );
+        if ( position != last ) {       // Move the last item in the hole
+            _items[ position ] = std::move( _items[ last ] );
+            _itemSlots[ position ] = _itemSlots[ last ];
+            _slots[ _itemSlots[ position ] ].position = position;
+        }
+        _items.pop_back();
+        _itemSlots.pop_back();
+        slot.position = Slot::free;
+        if ( slot.generation < Handle::generationMask ) {   // Otherwise slot is retired
+            ++slot.generation;
+            _freeSlots.push_back( handle.getIndex() );
+        }
+        return true;
+    }
+
+    //! Return true if \c handle reference an item actually stored in this map.
+    inline auto contains( Handle handle ) const noexcept -> bool {
+        if ( handle.isNull() || handle.getIndex() >= _slots.size() )
+            return false;
+        const Slot& slot = _slots[ handle.getIndex() ];
+        return slot.position != Slot::free && slot.generation == handle.getGeneration();
+    }
+
+    //! Return a pointer on item referenced by \c handle, or nullptr if \c handle is stale.
+    inline auto get( Handle handle ) noexcept -> T* {
+        return contains( handle ) ? &_items[ _slots[ handle.getIndex() ].position ] : nullptr;
+    }
+    inline auto get( Handle handle ) const noexcept -> const T* {
+        return contains( handle ) ? &_items[ _slots[ handle.getIndex() ].position ] : nullptr;
+    }
+
+    //! Return the handle of item stored at dense position \c position (0 <= position < size()).
+    inline auto getHandle( Size position ) const noexcept -> Handle {
+        const auto slotIndex = _itemSlots[ position ];
+        return Handle{ slotIndex, _slots[ slotIndex ].generation };
+    }
+
+    //! Return dense position of item referenced by \c handle (handle must be valid).
+    inline auto getPosition( Handle handle ) const noexcept -> Size { return _slots[ handle.getIndex() ].position; }
+
+    inline auto size() const noexcept -> Size { return _items.size(); }
+    inline auto empty() const noexcept -> bool { return _items.empty(); }
+    inline auto reserve( Size capacity ) -> void { _items.reserve( capacity ); _itemSlots.reserve( capacity ); _slots.reserve( capacity ); }
+
+    //! Remove all items, all existing handles become stale.
+    auto    clear() noexcept -> void {
+        _items.clear();
+        _itemSlots.clear();
+        _freeSlots.clear();
+        for ( typename Handle::Value s = 0; s < _slots.size(); ++s ) {
+            Slot& slot = _slots[ s ];
+            if ( slot.position != Slot::free && slot.generation < Handle::generationMask )
+                ++slot.generation;
+            slot.position = Slot::free;
+            if ( slot.generation < Handle::generationMask )
+                _freeSlots.push_back( s );
+        }
+    }
+
+    inline auto begin() noexcept -> iterator { return _items.begin(); }
+    inline auto end() noexcept -> iterator { return _items.end(); }
+    inline auto begin() const noexcept -> const_iterator { return _items.begin(); }
+    inline auto end() const noexcept -> const_iterator { return _items.end(); }
+    inline auto cbegin() const noexcept -> const_iterator { return _items.cbegin(); }
+    inline auto cend() const noexcept -> const_iterator { return _items.cend(); }
+
+private:
+    struct Slot {
+        static constexpr typename Handle::Value free = ~typename Handle::Value{0};
+        typename Handle::Value  position{ free };
+        typename Handle::Value  generation{ 0 };
+    };
+    std::vector< Slot >                     _slots;
+    std::vector< typename Handle::Value >   _freeSlots;
+    Items                                   _items;
+    std::vector< typename Handle::Value >   _itemSlots;
+};
+
+} // ::gtpo
+
+namespace std
+{
+    //! Specialization of std::hash for gtpo::Handle (hash is the raw handle value).
+    template< typename T >
+    struct hash< gtpo::Handle< T > >
+    {
+        typedef gtpo::Handle< T > argument_type;
+        typedef std::size_t result_type;
+        result_type operator()( argument_type const& key ) const noexcept {
+            return static_cast< result_type >( key.getValue() );
+        }
+    };
+}
+
+#endif // gtpoSlotMap_h
@@ -0,0 +1,213 @@
+/*
+    The MIT License (MIT)
+
+    Copyright (c) 2016 Benoit AUTHEMAN
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	gtpoSmallVector.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef gtpoSmallVector_h
+#define gtpoSmallVector_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <algorithm>        // std::move
+#include <memory>           // std::uninitialized_copy
+#include <new>              // ::operator new
+#include <type_traits>      // std::aligned_storage
+#include <utility>          // std::forward std::move_if_noexcept
+#include <initializer_list>
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Vector storing up to \c N elements inline, larger sizes spill to the heap.
+ *
+ * Used for node adjacency with gtpo::InlineAdjacency: most nodes have a low degree, their in/out edges
+ * are stored in the node without any heap allocation. SmallVector provide the subset of the std::vector
+ * interface used by GTpo (contiguous iterators, push_back/emplace_back, erase, pop_back, clear).
+ *
+ * \note Unlike std::vector, moving a SmallVector with inline elements move elements one by one, iterators
+ * and references on elements are invalidated by a move.
+ */
+template < class T, std::size_t N >
+class SmallVector
+{
+    static_assert( N > 0, "gtpo::SmallVector<>: Inline capacity must be at least 1." );
+public:
+    using value_type        = T;
+    using size_type         = std::size_t;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = T&;
+    using const_reference   = const T&;
+    using pointer           = T*;
+    using const_pointer     = const T*;
+    using iterator          = T*;
+    using const_iterator    = const T*;
+
+    SmallVector() noexcept : _data{ inlineData() } { }
+    SmallVector( std::initializer_list< T > values ) : SmallVector{} {
+        reserve( values.size() );
+        for ( const auto& value : values )
+            emplace_back( value );
+    }
+    SmallVector( const SmallVector& other ) : SmallVector{} {
+        reserve( other.size() );
+        std::uninitialized_copy( other.begin(), other.end(), _data );
+        _size = other._size;
+    }
+    SmallVector( SmallVector&& other ) noexcept( std::is_nothrow_move_constructible< T >::value ) : SmallVector{} {
+        moveFrom( other );
+    }
+    ~SmallVector() noexcept {
+        clear();
+        releaseHeap();
+    }
+    SmallVector& operator=( const SmallVector& other ) {
+        if ( this != &other ) {
+            clear();
+            reserve( other.size() );
+            std::uninitialized_copy( other.begin(), other.end(), _data );
+            _size = other._size;
+        }
+        return *this;
+    }
+    SmallVector& operator=( SmallVector&& other ) noexcept( std::is_nothrow_move_constructible< T >::value ) {
+        if ( this != &other ) {
+            clear();
+            releaseHeap();
+            moveFrom( other );
+        }
+        return *this;
+    }
+
+public:
+    inline auto begin() noexcept -> iterator { return _data; }
+    inline auto end() noexcept -> iterator { return _data + _size; }
+    inline auto begin() const noexcept -> const_iterator { return _data; }
+    inline auto end() const noexcept -> const_iterator { return _data + _size; }
+    inline auto cbegin() const noexcept -> const_iterator { return _data; }
+    inline auto cend() const noexcept -> const_iterator { return _data + _size; }
+
+    inline auto size() const noexcept -> size_type { return _size; }
+    inline auto empty() const noexcept -> bool { return _size == 0; }
+    inline auto capacity() const noexcept -> size_type { return _capacity; }
+    //! Return true if elements are actually stored inline (ie no heap allocation).
+    inline auto isInline() const noexcept -> bool { return _data == inlineData(); }
+
+    inline auto data() noexcept -> pointer { return _data; }
+    inline auto data() const noexcept -> const_pointer { return _data; }
+    inline auto operator[]( size_type i ) noexcept -> reference { return _data[ i ]; }
+    inline auto operator[]( size_type i ) const noexcept -> const_reference { return _data[ i ]; }
+    inline auto front() noexcept -> reference { return _data[ 0 ]; }
+    inline auto front() const noexcept -> const_reference { return _data[ 0 ]; }
+    inline auto back() noexcept -> reference { return _data[ _size - 1 ]; }
+    inline auto back() const noexcept -> const_reference { return _data[ _size - 1 ]; }
+
+public:
+    auto    reserve( size_type capacity ) -> void {
+        if ( capacity <= _capacity )
+            return;
+        T* data = static_cast< T* >( ::operator new( capacity * sizeof( T ) ) );
+        for ( size_type i = 0; i < _size; ++i ) {
+            ::new ( static_cast< void* >( data + i ) ) T( std::move_if_noexcept( _data[ i ] ) );
+            _data[ i ].~T();
+        }
+        releaseHeap();
+        _data = data;
+        _capacity = capacity;
+    }
+
+    template < class... Args >
+    auto    emplace_back( Args&&... args ) -> reference {
+        if ( _size == _capacity )
+            reserve( _capacity * 2 );
+        ::new ( static_cast< void* >( _data + _size ) ) T( std::forward< Args >( args )... );
+        return _data[ _size++ ];
+    }
+    inline auto push_back( const T& value ) -> void { emplace_back( value ); }
+    inline auto push_back( T&& value ) -> void { emplace_back( std::move( value ) ); }
+
+    inline auto pop_back() noexcept -> void { _data[ --_size ].~T(); }
+
+    //! Erase elements in [first, last), return an iterator on the element following the last removed element.
+    auto    erase( const_iterator first, const_iterator last ) -> iterator {
+        iterator dst = _data + ( first - _data );
+        if ( first == last )
+            return dst;
+        iterator src = _data + ( last - _data );
+        iterator e = end();
+        iterator out = std::move( src, e, dst );
+        for ( iterator i = out; i != e; ++i )
+            i->~T();
+        _size -= static_cast< size_type >( last - first );
+        return dst;
+    }
+    inline auto erase( const_iterator position ) -> iterator { return erase( position, position + 1 ); }
+
+    //! Destroy all elements, heap storage (if any) is kept for reuse.
+    auto    clear() noexcept -> void {
+        for ( size_type i = 0; i < _size; ++i )
+            _data[ i ].~T();
+        _size = 0;
+    }
+
+private:
+    inline auto inlineData() noexcept -> T* { return reinterpret_cast< T* >( &_inline ); }
+    inline auto inlineData() const noexcept -> const T* { return reinterpret_cast< const T* >( &_inline ); }
+
+    auto    releaseHeap() noexcept -> void {
+        if ( !isInline() )
+            ::operator delete( _data );
+        _data = inlineData();
+        _capacity = N;
+    }
+
+    //! Steal \c other heap storage or move its inline elements, \c this must be empty and inline.
+    auto    moveFrom( SmallVector& other ) -> void {
+        if ( other.isInline() ) {
+            for ( size_type i = 0; i < other._size; ++i )
+                ::new ( static_cast< void* >( _data + i ) ) T( std::move( other._data[ i ] ) );
+            _size = other._size;
+            other.clear();
+        } else {
+            _data = other._data;
+            _size = other._size;
+            _capacity = other._capacity;
+            other._data = other.inlineData();
+            other._size = 0;
+            other._capacity = N;
+        }
+    }
+
+    T*          _data;
+    size_type   _size{ 0 };
+    size_type   _capacity{ N };
+    typename std::aligned_storage< sizeof( T ) * N, alignof( T ) >::type    _inline;
+};
+
+} // ::gtpo
+
+#endif // gtpoSmallVector_h
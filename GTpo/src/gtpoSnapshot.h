@@ -0,0 +1,415 @@
+/*
+    The MIT License (MIT)
+
+    Copyright (c) 2016 Benoit AUTHEMAN
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	gtpoSnapshot.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef gtpoSnapshot_h
+#define gtpoSnapshot_h
+
+// STD headers
+#include <cstdint>
+#include <cstddef>          // std::size_t
+#include <array>
+#include <atomic>           // std::atomic_thread_fence
+#include <limits>
+#include <memory>           // std::shared_ptr
+#include <string>
+#include <vector>
+
+// GTpo headers
+#include "./gtpoUtils.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Persistent (copy-on-write) vector sharing its storage with its copies.
+ *
+ * Elements are stored in fixed size chunks, chunks are referenced from pages, pages from a root table. Copying
+ * a PersistentVector is O(1): the copy share the whole tree. Modifying an element with modify() clone the
+ * root table, page and chunk on its path when they are shared with another copy (O(size / elementsPerPage)
+ * for the root, O(chunk size) for the page and chunk), unshared nodes are modified in place.
+ *
+ * Copies could be read concurrently from other threads while the original is modified: a shared node is
+ * never modified in place. Only one thread may modify a given PersistentVector.
+ */
+template < class T >
+class PersistentVector
+{
+public:
+    static constexpr std::size_t    chunkBits   = 4;
+    static constexpr std::size_t    pageBits    = 6;
+    static constexpr std::size_t    chunkSize   = std::size_t{ 1 } << chunkBits;
+    static constexpr std::size_t    pageSize    = std::size_t{ 1 } << pageBits;
+    //! Number of elements referenced by a page.
+    static constexpr std::size_t    elementsPerPage = chunkSize * pageSize;
+
+    PersistentVector() : _root{ std::make_shared< Root >() } { }
+    ~PersistentVector() = default;
+    PersistentVector( const PersistentVector& ) = default;
+    PersistentVector& operator=( const PersistentVector& ) = default;
+    PersistentVector( PersistentVector&& ) = default;
+    PersistentVector& operator=( PersistentVector&& ) = default;
+
+public:
+    inline auto size() const noexcept -> std::size_t { return _size; }
+    inline auto empty() const noexcept -> bool { return _size == 0; }
+
+    //! Return element \c i, O(1) (\c i must be less than size()).
+    inline auto operator[]( std::size_t i ) const noexcept -> const T& {
+        const auto& page = ( *_root )[ i >> ( chunkBits + pageBits ) ];
+        const auto& chunk = ( *page )[ ( i >> chunkBits ) & ( pageSize - 1 ) ];
+        return ( *chunk )[ i & ( chunkSize - 1 ) ];
+    }
+
+    //! Return a modifiable reference on element \c i, shared storage on \c i path is cloned first.
+    auto    modify( std::size_t i ) -> T& {
+        auto& root = unshare( _root );
+        auto& page = unshare( root[ i >> ( chunkBits + pageBits ) ] );
+        auto& chunk = unshare( page[ ( i >> chunkBits ) & ( pageSize - 1 ) ] );
+        return chunk[ i & ( chunkSize - 1 ) ];
+    }
+
+    //! Grow vector to \c size default constructed elements (vector never shrink, use clear()).
+    auto    grow( std::size_t size ) -> void {
+        if ( size <= _size )
+            return;
+        const std::size_t chunkCount = ( size + chunkSize - 1 ) >> chunkBits;
+        std::size_t allocated = ( _size + chunkSize - 1 ) >> chunkBits;
+        if ( chunkCount > allocated ) {
+            auto& root = unshare( _root );
+            for ( ; allocated < chunkCount; ++allocated ) {
+                const std::size_t p = allocated >> pageBits;
+                if ( p >= root.size() )
+                    root.emplace_back( std::make_shared< Page >() );
+                unshare( root[ p ] )[ allocated & ( pageSize - 1 ) ] = std::make_shared< Chunk >();
+            }
+        }
+        _size = size;
+    }
+
+    //! Release reference on actual storage, copies are not modified.
+    auto    clear() -> void {
+        _root = std::make_shared< Root >();
+        _size = 0;
+    }
+
+private:
+    using Chunk = std::array< T, chunkSize >;
+    using Page  = std::array< std::shared_ptr< Chunk >, pageSize >;
+    using Root  = std::vector< std::shared_ptr< Page > >;
+
+    //! Clone \c node content if it is shared with another vector, return a modifiable reference on it.
+    template < class N >
+    static auto unshare( std::shared_ptr< N >& node ) -> N& {
+        if ( node.use_count() != 1 )
+            node = std::make_shared< N >( *node );
+        else    // Synchronize with a copy released from another thread before modifying node in place
+            std::atomic_thread_fence( std::memory_order_acquire );
+        return *node;
+    }
+
+    std::shared_ptr< Root > _root;
+    std::size_t             _size{ 0 };
+};
+
+template < class Config >
+class SnapshotTracker;
+
+/*! \brief Immutable versioned snapshot of a graph topology and core node/edge properties.
+ *
+ * Snapshots are created with gtpo::GenGraph::snapshot(). Nodes and edges are identified by stable slots:
+ * a primitive keep its slot from the snapshot where it appears to the snapshot where it is removed, a free
+ * slot might then be reused. Iterate 0..getNodeSlotCount() and skip slots where hasNode() is false to visit
+ * all nodes (same for edges). Only node to node edges are recorded, hyper edges are not part of a snapshot.
+ *
+ * A snapshot is a cheap value type: it share its storage with the live graph and with other snapshots
+ * (copying it is O(1)), it does not reference its source graph and could be moved to a worker thread
+ * and traversed while the graph is still modified on its owner thread.
+ *
+ * \code
+ * auto snapshot = graph.snapshot();     // On the graph thread
+ * std::thread{ [snapshot]() {
+ *     for ( auto n = 0u; n < snapshot.getNodeSlotCount(); ++n )
+ *         if ( snapshot.hasNode( n ) )
+ *             std::cout << snapshot.getNode( n ).label << std::endl;
+ * } }.detach();
+ * \endcode
+ */
+template < class Config >
+class GraphSnapshot
+{
+    friend SnapshotTracker< Config >;
+public:
+    using Index     = std::uint32_t;
+    using Indices   = std::vector< Index >;
+
+    //! Slot value for primitives not in snapshot.
+    static constexpr Index  invalidIndex = std::numeric_limits< Index >::max();
+
+    struct NodeRecord {
+        bool            valid{ false };
+        std::string     label;
+        double          x{ 0. };
+        double          y{ 0. };
+        double          width{ 0. };
+        double          height{ 0. };
+        //! In edges slots.
+        Indices         inEdges;
+        //! Out edges slots.
+        Indices         outEdges;
+    };
+
+    struct EdgeRecord {
+        bool            valid{ false };
+        //! Source node slot.
+        Index           src{ invalidIndex };
+        //! Destination node slot.
+        Index           dst{ invalidIndex };
+        double          weight{ 0. };
+    };
+
+    GraphSnapshot() = default;
+    ~GraphSnapshot() = default;
+    GraphSnapshot( const GraphSnapshot& ) = default;
+    GraphSnapshot& operator=( const GraphSnapshot& ) = default;
+    GraphSnapshot( GraphSnapshot&& ) = default;
+    GraphSnapshot& operator=( GraphSnapshot&& ) = default;
+
+public:
+    //! Snapshot version, two snapshots of the same graph with the same version have the same content (0 for an empty default snapshot).
+    inline auto getVersion() const noexcept -> std::uint64_t { return _version; }
+
+    inline auto getNodeCount() const noexcept -> Index { return _nodeCount; }
+    inline auto getEdgeCount() const noexcept -> Index { return _edgeCount; }
+    inline auto getNodeSlotCount() const noexcept -> Index { return static_cast< Index >( _nodes.size() ); }
+    inline auto getEdgeSlotCount() const noexcept -> Index { return static_cast< Index >( _edges.size() ); }
+
+    //! Return true if node slot \c node is used in this snapshot.
+    inline auto hasNode( Index node ) const noexcept -> bool { return node < getNodeSlotCount() && _nodes[ node ].valid; }
+    //! Return true if edge slot \c edge is used in this snapshot.
+    inline auto hasEdge( Index edge ) const noexcept -> bool { return edge < getEdgeSlotCount() && _edges[ edge ].valid; }
+
+    //! Return node in slot \c node (\c node must be less than getNodeSlotCount()).
+    inline auto getNode( Index node ) const noexcept -> const NodeRecord& { return _nodes[ node ]; }
+    //! Return edge in slot \c edge (\c edge must be less than getEdgeSlotCount()).
+    inline auto getEdge( Index edge ) const noexcept -> const EdgeRecord& { return _edges[ edge ]; }
+
+private:
+    std::uint64_t                       _version{ 0 };
+    Index                               _nodeCount{ 0 };
+    Index                               _edgeCount{ 0 };
+    PersistentVector< NodeRecord >      _nodes;
+    PersistentVector< EdgeRecord >      _edges;
+};
+
+template < class Config >
+constexpr typename GraphSnapshot< Config >::Index   GraphSnapshot< Config >::invalidIndex;
+
+/*! \brief Record graph changes between two snapshots (internally used by gtpo::GenGraph).
+ *
+ * Tracker own the live version of snapshot storage: graph primitives are assigned a slot when they are
+ * inserted, insertion, removal and modification mark their slot dirty. snapshot() rewrite dirty slots
+ * records only, its cost is O(changes since last snapshot).
+ */
+template < class Config >
+class SnapshotTracker
+{
+public:
+    using Snapshot  = GraphSnapshot< Config >;
+    using Index     = typename Snapshot::Index;
+    using Node      = typename Config::Node;
+    using Edge      = typename Config::Edge;
+
+    SnapshotTracker() = default;
+    ~SnapshotTracker() = default;
+    SnapshotTracker( const SnapshotTracker& ) = delete;
+    SnapshotTracker& operator=( const SnapshotTracker& ) = delete;
+
+public:
+    //! Register \c node in a free slot.
+    auto    insertNode( Node* node ) noexcept( false ) -> void {
+        node->_snapshotSlot = acquire( _nodePtrs, _freeNodes, node, "gtpo::SnapshotTracker<>::insertNode(): Error: too many nodes." );
+        touch( _dirtyNodes, _dirtyNodesFlags, node->_snapshotSlot );
+    }
+    //! Release \c node slot (\c node in/out edges must have been removed first).
+    auto    removeNode( Node* node ) noexcept( false ) -> void {
+        const Index slot = node->_snapshotSlot;
+        if ( slot == Snapshot::invalidIndex )
+            return;
+        touch( _dirtyNodes, _dirtyNodesFlags, slot );
+        release( _nodePtrs, _freeNodes, slot );
+        node->_snapshotSlot = Snapshot::invalidIndex;
+    }
+    auto    modifyNode( const Node* node ) noexcept( false ) -> void {
+        if ( node->_snapshotSlot != Snapshot::invalidIndex )
+            touch( _dirtyNodes, _dirtyNodesFlags, node->_snapshotSlot );
+    }
+
+    //! Register \c edge in a free slot, hyper edges are ignored.
+    auto    insertEdge( Edge* edge ) noexcept( false ) -> void {
+        auto src = edge->getSrc().lock();
+        auto dst = edge->getDst().lock();
+        if ( !src || !dst )
+            return;
+        edge->_snapshotSlot = acquire( _edgePtrs, _freeEdges, edge, "gtpo::SnapshotTracker<>::insertEdge(): Error: too many edges." );
+        touch( _dirtyEdges, _dirtyEdgesFlags, edge->_snapshotSlot );
+        modifyNode( src.get() );        // Source and destination adjacency are modified
+        modifyNode( dst.get() );
+    }
+    auto    removeEdge( Edge* edge ) noexcept( false ) -> void {
+        const Index slot = edge->_snapshotSlot;
+        if ( slot == Snapshot::invalidIndex )
+            return;
+        auto src = edge->getSrc().lock();
+        if ( src )
+            modifyNode( src.get() );
+        auto dst = edge->getDst().lock();
+        if ( dst )
+            modifyNode( dst.get() );
+        touch( _dirtyEdges, _dirtyEdgesFlags, slot );
+        release( _edgePtrs, _freeEdges, slot );
+        edge->_snapshotSlot = Snapshot::invalidIndex;
+    }
+    auto    modifyEdge( const Edge* edge ) noexcept( false ) -> void {
+        if ( edge->_snapshotSlot != Snapshot::invalidIndex )
+            touch( _dirtyEdges, _dirtyEdgesFlags, edge->_snapshotSlot );
+    }
+
+    /*! \brief Publish a snapshot with all changes recorded since last snapshot, O(changes).
+     *
+     * Actual snapshot is returned with its version unchanged if nothing has been modified.
+     */
+    auto    snapshot() noexcept( false ) -> Snapshot {
+        if ( !_dirtyNodes.empty() ||
+             !_dirtyEdges.empty() ) {
+            _live._nodes.grow( _nodePtrs.size() );
+            _live._edges.grow( _edgePtrs.size() );
+            for ( const auto slot : _dirtyEdges ) {     // Edges first, nodes adjacency refer to edges slots
+                writeEdge( _live._edges.modify( slot ), _edgePtrs[ slot ] );
+                _dirtyEdgesFlags[ slot ] = false;
+            }
+            for ( const auto slot : _dirtyNodes ) {
+                writeNode( _live._nodes.modify( slot ), _nodePtrs[ slot ] );
+                _dirtyNodesFlags[ slot ] = false;
+            }
+            _dirtyEdges.clear();
+            _dirtyNodes.clear();
+            _live._nodeCount = static_cast< Index >( _nodePtrs.size() - _freeNodes.size() );
+            _live._edgeCount = static_cast< Index >( _edgePtrs.size() - _freeEdges.size() );
+            ++_live._version;
+        }
+        return _live;
+    }
+
+    //! Release all slots (graph has been cleared), next snapshot is empty, previous snapshots are not modified.
+    auto    clear() noexcept( false ) -> void {
+        const auto version = _live._version;
+        _live = Snapshot{};
+        _live._version = version + 1;
+        _nodePtrs.clear(); _freeNodes.clear(); _dirtyNodes.clear(); _dirtyNodesFlags.clear();
+        _edgePtrs.clear(); _freeEdges.clear(); _dirtyEdges.clear(); _dirtyEdgesFlags.clear();
+    }
+
+private:
+    template < class P >
+    static auto acquire( std::vector< P* >& ptrs, std::vector< Index >& freeSlots, P* ptr, const char* error ) -> Index {
+        if ( !freeSlots.empty() ) {
+            const Index slot = freeSlots.back();
+            freeSlots.pop_back();
+            ptrs[ slot ] = ptr;
+            return slot;
+        }
+        assert_throw( ptrs.size() < static_cast< std::size_t >( Snapshot::invalidIndex ), error );
+        ptrs.push_back( ptr );
+        return static_cast< Index >( ptrs.size() - 1 );
+    }
+    template < class P >
+    static auto release( std::vector< P* >& ptrs, std::vector< Index >& freeSlots, Index slot ) -> void {
+        ptrs[ slot ] = nullptr;
+        freeSlots.push_back( slot );
+    }
+    static auto touch( std::vector< Index >& dirty, std::vector< bool >& flags, Index slot ) -> void {
+        if ( slot >= flags.size() )
+            flags.resize( slot + 1, false );
+        if ( !flags[ slot ] ) {
+            flags[ slot ] = true;
+            dirty.push_back( slot );
+        }
+    }
+
+    static auto writeNode( typename Snapshot::NodeRecord& record, const Node* node ) -> void {
+        if ( node == nullptr ) {
+            record = typename Snapshot::NodeRecord{};
+            return;
+        }
+        record.valid = true;
+        record.label = Config::getLabel( node );
+        record.x = Config::getX( node );
+        record.y = Config::getY( node );
+        record.width = Config::getWidth( node );
+        record.height = Config::getHeight( node );
+        writeAdjacency( record.inEdges, node->getInEdges() );
+        writeAdjacency( record.outEdges, node->getOutEdges() );
+    }
+    template < class WeakEdges >
+    static auto writeAdjacency( typename Snapshot::Indices& slots, const WeakEdges& edges ) -> void {
+        slots.clear();
+        for ( const auto& weakEdge : edges ) {
+            const auto edge = weakEdge.lock();
+            if ( edge && edge->_snapshotSlot != Snapshot::invalidIndex )
+                slots.push_back( edge->_snapshotSlot );
+        }
+    }
+    static auto writeEdge( typename Snapshot::EdgeRecord& record, const Edge* edge ) -> void {
+        if ( edge == nullptr ) {
+            record = typename Snapshot::EdgeRecord{};
+            return;
+        }
+        const auto src = edge->getSrc().lock();
+        const auto dst = edge->getDst().lock();
+        record.valid = true;
+        record.src = src ? src->_snapshotSlot : Snapshot::invalidIndex;
+        record.dst = dst ? dst->_snapshotSlot : Snapshot::invalidIndex;
+        record.weight = Config::getWeight( edge );
+    }
+
+private:
+    Snapshot                _live;
+    std::vector< Node* >    _nodePtrs;
+    std::vector< Index >    _freeNodes;
+    std::vector< Index >    _dirtyNodes;
+    std::vector< bool >     _dirtyNodesFlags;
+    std::vector< Edge* >    _edgePtrs;
+    std::vector< Index >    _freeEdges;
+    std::vector< Index >    _dirtyEdges;
+    std::vector< bool >     _dirtyEdgesFlags;
+};
+
+} // ::gtpo
+
+#endif // gtpoSnapshot_h
@@ -0,0 +1,257 @@
+/*
+    The MIT License (MIT)
+
+    Copyright (c) 2016 Benoit AUTHEMAN
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	gtpoSpatialGrid.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef gtpoSpatialGrid_h
+#define gtpoSpatialGrid_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::int64_t
+#include <cmath>            // std::floor
+#include <algorithm>        // std::max std::min std::find
+#include <functional>       // std::hash
+#include <vector>
+#include <unordered_map>
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Uniform grid spatial index of axis aligned bounding boxes identified by a \c Key.
+ *
+ * Used to find primitives intersecting a view rectangle without iterating all graph primitives: boxes are
+ * referenced in every grid cell they overlap, a query only visit cells overlapping the query rectangle (or
+ * non empty cells when they are fewer). Boxes overlapping more than getMaxCellSpan() cells (ie very long
+ * edges) are kept in an oversized list tested on every query instead of being referenced in many cells.
+ *
+ * Insertion, update and removal are O(cells overlapped by the box) expected, an update that does not change
+ * the box cell range is O(1). \c Key must be hashable and comparable (usually a primitive raw pointer).
+ */
+template < class Key, class Hash = std::hash< Key > >
+class SpatialGrid
+{
+public:
+    using size_type = std::size_t;
+
+    explicit SpatialGrid( double cellSize = 256., size_type maxCellSpan = 64 ) noexcept :
+        _cellSize{ cellSize > 0. ? cellSize : 256. },
+        _maxCellSpan{ maxCellSpan > 0 ? maxCellSpan : 1 } { }
+    ~SpatialGrid() = default;
+    SpatialGrid( const SpatialGrid& ) = default;
+    SpatialGrid& operator=( const SpatialGrid& ) = default;
+    SpatialGrid( SpatialGrid&& ) = default;
+    SpatialGrid& operator=( SpatialGrid&& ) = default;
+
+public:
+    inline auto getCellSize() const noexcept -> double { return _cellSize; }
+    inline auto getMaxCellSpan() const noexcept -> size_type { return _maxCellSpan; }
+    inline auto size() const noexcept -> size_type { return _entries.size(); }
+    inline auto empty() const noexcept -> bool { return _entries.empty(); }
+    inline auto contains( const Key& key ) const noexcept -> bool { return _entries.find( key ) != _entries.cend(); }
+
+    /*! \brief Get \c key box in \c x, \c y, \c width and \c height.
+     *
+     * \return false if \c key is not indexed (output arguments are then unchanged).
+     */
+    auto    getBox( const Key& key, double& x, double& y, double& width, double& height ) const noexcept -> bool {
+        const auto entry = _entries.find( key );
+        if ( entry == _entries.cend() )
+            return false;
+        x = entry->second.box.left;
+        y = entry->second.box.top;
+        width = entry->second.box.right - entry->second.box.left;
+        height = entry->second.box.bottom - entry->second.box.top;
+        return true;
+    }
+
+public:
+    //! Index \c key with box (\c x, \c y, \c width, \c height), update \c key box if it is already indexed.
+    auto    insert( const Key& key, double x, double y, double width, double height ) -> void {
+        const Box box{ x, y, x + std::max( 0., width ), y + std::max( 0., height ) };
+        const Range range = getRange( box );
+        auto entry = _entries.find( key );
+        if ( entry != _entries.end() ) {
+            if ( entry->second.range == range ) {   // Fast path: box moved inside the same cells
+                entry->second.box = box;
+                return;
+            }
+            unlink( key, entry->second.range );
+            entry->second = Entry{ box, range };
+        } else
+            _entries.emplace( key, Entry{ box, range } );
+        link( key, range );
+    }
+
+    //! Remove \c key from index, return false if \c key was not indexed.
+    auto    remove( const Key& key ) -> bool {
+        auto entry = _entries.find( key );
+        if ( entry == _entries.end() )
+            return false;
+        unlink( key, entry->second.range );
+        _entries.erase( entry );
+        return true;
+    }
+
+    auto    clear() noexcept -> void {
+        _entries.clear();
+        _cells.clear();
+        _oversized.clear();
+    }
+
+    /*! \brief Call \c functor once with every key whose box intersect rectangle (\c x, \c y, \c width, \c height).
+     *
+     * Boxes touching the rectangle border are reported. Keys are reported in unspecified order, index must not be
+     * modified from \c functor.
+     */
+    template < class Functor >
+    auto    query( double x, double y, double width, double height, Functor functor ) const -> void {
+        const Box rect{ x, y, x + std::max( 0., width ), y + std::max( 0., height ) };
+        const Range range = getRange( rect );
+        const auto rangeCellCount = static_cast< double >( range.right - range.left + 1 ) *
+                                    static_cast< double >( range.bottom - range.top + 1 );
+        if ( rangeCellCount <= static_cast< double >( _cells.size() ) ) {
+            for ( auto row = range.top; row <= range.bottom; ++row )
+                for ( auto column = range.left; column <= range.right; ++column ) {
+                    const auto cell = _cells.find( getCellKey( column, row ) );
+                    if ( cell != _cells.cend() )
+                        reportCell( cell->second, column, row, range, rect, functor );
+                }
+        } else {    // Query cover more cells than there are non empty cells: iterate non empty cells
+            for ( const auto& cell : _cells ) {
+                const auto column = static_cast< std::int32_t >( cell.first >> 32 );
+                const auto row = static_cast< std::int32_t >( cell.first & 0xFFFFFFFF );
+                if ( column >= range.left && column <= range.right &&
+                     row >= range.top && row <= range.bottom )
+                    reportCell( cell.second, column, row, range, rect, functor );
+            }
+        }
+        for ( const auto& key : _oversized ) {
+            const auto& box = _entries.find( key )->second.box;
+            if ( intersects( box, rect ) )
+                functor( key );
+        }
+    }
+
+private:
+    struct Box {
+        double  left, top, right, bottom;
+    };
+    //! Inclusive range of cells overlapped by a box.
+    struct Range {
+        std::int32_t    left, top, right, bottom;
+        inline auto operator==( const Range& other ) const noexcept -> bool {
+            return left == other.left && top == other.top && right == other.right && bottom == other.bottom;
+        }
+    };
+    struct Entry {
+        Box     box;
+        Range   range;
+    };
+    using Cell = std::vector< Key >;
+
+    static inline auto  intersects( const Box& a, const Box& b ) noexcept -> bool {
+        return a.left <= b.right && b.left <= a.right && a.top <= b.bottom && b.top <= a.bottom;
+    }
+    static inline auto  getCellKey( std::int32_t column, std::int32_t row ) noexcept -> std::int64_t {
+        return static_cast< std::int64_t >( ( static_cast< std::uint64_t >( static_cast< std::uint32_t >( column ) ) << 32 ) |
+                                            static_cast< std::uint32_t >( row ) );
+    }
+    inline auto getCell( double coordinate ) const noexcept -> std::int32_t {
+        const double cell = std::floor( coordinate / _cellSize );
+        return static_cast< std::int32_t >( std::max( -1073741824., std::min( 1073741823., cell ) ) );
+    }
+    inline auto getRange( const Box& box ) const noexcept -> Range {
+        return Range{ getCell( box.left ), getCell( box.top ), getCell( box.right ), getCell( box.bottom ) };
+    }
+    inline auto isOversized( const Range& range ) const noexcept -> bool {
+        return static_cast< double >( range.right - range.left + 1 ) *
+               static_cast< double >( range.bottom - range.top + 1 ) > static_cast< double >( _maxCellSpan );
+    }
+
+    /*! \brief Report keys in \c cell (\c column, \c row) intersecting \c rect.
+     *
+     * A box overlapping multiple cells is reported only from the first cell overlapped by both the box and
+     * the query range, so that it is reported once without a visited set.
+     */
+    template < class Functor >
+    auto    reportCell( const Cell& cell, std::int32_t column, std::int32_t row,
+                        const Range& range, const Box& rect, Functor& functor ) const -> void {
+        for ( const auto& key : cell ) {
+            const auto& entry = _entries.find( key )->second;
+            if ( std::max( entry.range.left, range.left ) != column ||
+                 std::max( entry.range.top, range.top ) != row )
+                continue;
+            if ( intersects( entry.box, rect ) )
+                functor( key );
+        }
+    }
+
+    auto    link( const Key& key, const Range& range ) -> void {
+        if ( isOversized( range ) ) {
+            _oversized.push_back( key );
+            return;
+        }
+        for ( auto row = range.top; row <= range.bottom; ++row )
+            for ( auto column = range.left; column <= range.right; ++column )
+                _cells[ getCellKey( column, row ) ].push_back( key );
+    }
+    auto    unlink( const Key& key, const Range& range ) -> void {
+        if ( isOversized( range ) ) {
+            eraseKey( _oversized, key );
+            return;
+        }
+        for ( auto row = range.top; row <= range.bottom; ++row )
+            for ( auto column = range.left; column <= range.right; ++column ) {
+                auto cell = _cells.find( getCellKey( column, row ) );
+                if ( cell == _cells.end() )
+                    continue;
+                eraseKey( cell->second, key );
+                if ( cell->second.empty() )
+                    _cells.erase( cell );
+            }
+    }
+    //! Swap and pop \c key from \c keys (cell order is not significant).
+    static auto eraseKey( std::vector< Key >& keys, const Key& key ) noexcept -> void {
+        auto k = std::find( keys.begin(), keys.end(), key );
+        if ( k == keys.end() )
+            return;
+        *k = keys.back();
+        keys.pop_back();
+    }
+
+    double      _cellSize{ 256. };
+    size_type   _maxCellSpan{ 64 };
+    std::unordered_map< Key, Entry, Hash >      _entries;
+    std::unordered_map< std::int64_t, Cell >    _cells;
+    std::vector< Key >                          _oversized;
+};
+
+} // ::gtpo
+
+#endif // gtpoSpatialGrid_h
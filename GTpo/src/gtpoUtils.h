@@ -116,13 +116,41 @@ struct ContainerAccessors {
      */
     template <typename T>
     struct remove { };
+
+    /*! \brief Generic "predicate remover", remove all items matching a predicate in one pass (used for bulk removal).
+     *
+     * \code
+     *   gtpo::DefaultConfig::remove_if<IntList>::from( l, []( int i ) { return i > 42; } );
+     * \endcode
+     */
+    template <typename T>
+    struct remove_if { };
+
+    /*! \brief Generic "unordered item remover", remove item at a given position by moving the last item in its place.
+     *
+     * Only required for random access containers used with gtpo::UnorderedRemoval.
+     */
+    template <typename T>
+    struct swap_and_pop { };
+
+    /*! \brief Generic "range appender", append all items of a range at the end of a container in one call.
+     *
+     * Only required for graph main containers when gtpo::GenGraph<>::insertNodes() or insertEdges() are used.
+     */
+    template <typename T>
+    struct append_range { };
 };
 
 } // ::gtpo
 
 namespace std
 {
-    //! Specialization of std::hash for weak_ptr type.
+    /*! \brief Specialization of std::hash for weak_ptr type.
+     *
+     * \warning Hashing lock() \c key (two atomic operations) and the hash of an expired weak_ptr
+     * is different from its hash while it was alive: do not let an element expire while it is stored
+     * in a hashed container. GenGraph and GenGroup search containers are keyed by owner pointers instead.
+     */
     template< typename T >
     struct hash< std::weak_ptr< T > >
     {
@@ -29,6 +29,10 @@
 #include <list>
 #include <memory>
 #include <iostream>
+#include <thread>
+#include <array>
+#include <random>
+#include <algorithm>
 
 // GTpo headers
 #include <GTpo>
@@ -349,6 +353,279 @@ TEST(GTpoTopo, parallelEdges)
     g.clear();
 }
 
+TEST(GTpoTopo, outEdgesIndex)
+{
+    gtpo::GenGraph<> g;
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    auto n3 = g.createNode();
+    auto e1 = g.createEdge(n1, n2);
+    auto e2 = g.createEdge(n1, n3);
+    auto he1 = g.createEdge(n3, e1);
+    g.createEdge(n1, n1);
+    EXPECT_TRUE( g.findEdge(n1, n2).lock() == e1.lock() );
+    EXPECT_TRUE( g.findEdge(n1, n3).lock() == e2.lock() );
+    EXPECT_TRUE( g.findEdge(n3, e1).lock() == he1.lock() );
+    EXPECT_FALSE( g.hasEdge(n2, n1) );
+    EXPECT_FALSE( g.hasEdge(n3, e2) );
+    EXPECT_TRUE( g.hasEdge(n1, n1) );
+    EXPECT_TRUE( n1.lock()->getOutEdgesIndex().size() == 3 );
+
+    g.removeEdge(e1);               // Remove e1 and he1
+    EXPECT_FALSE( g.hasEdge(n1, n2) );
+    EXPECT_FALSE( g.hasEdge(n3, e1) );
+    EXPECT_TRUE( n3.lock()->getOutEdgesIndex().size() == 0 );
+    g.removeNode(n3);
+    EXPECT_TRUE( n1.lock()->getOutEdgesIndex().size() == 1 );
+    EXPECT_TRUE( g.getEdgeCount(n1, n1) == 1 );
+    g.clear();
+}
+
+TEST(GTpoTopo, outEdgesIndexHEdgeDestination)
+{
+    // TEST: out edges index follow an hyper edge destination modified after insertion
+    gtpo::GenGraph<> g;
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    auto n3 = g.createNode();
+    auto e1 = g.createEdge(n1, n2);
+    auto e2 = g.createEdge(n2, n3);
+    auto he1 = g.createEdge(n3, e1);
+    EXPECT_TRUE( g.hasEdge(n3, e1) );
+
+    e1.lock()->removeInHEdge(he1);  // Reset he1 hyper destination
+    EXPECT_FALSE( g.hasEdge(n3, e1) );
+    e2.lock()->addInHEdge(he1);     // Set he1 hyper destination to e2
+    EXPECT_TRUE( g.findEdge(n3, e2).lock() == he1.lock() );
+    EXPECT_FALSE( g.hasEdge(n3, e1) );
+    EXPECT_TRUE( n3.lock()->getOutEdgesIndex().size() == 1 );
+
+    g.removeEdge(he1);
+    EXPECT_FALSE( g.hasEdge(n3, e2) );
+    EXPECT_TRUE( n3.lock()->getOutEdgesIndex().size() == 0 );
+    g.clear();
+}
+
+TEST(GTpoTopo, removalCount)
+{
+    // TEST: removal count is incremented by every primitive removal, not by insertions
+    gtpo::GenGraph<> g;
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    auto e1 = g.createEdge(n1, n2);
+    const auto count = g.getRemovalCount();
+    g.createNode();
+    EXPECT_EQ( g.getRemovalCount(), count );
+    g.removeEdge(e1);
+    EXPECT_GT( g.getRemovalCount(), count );
+    const auto edgeCount = g.getRemovalCount();
+    g.removeNode(n1);
+    EXPECT_GT( g.getRemovalCount(), edgeCount );
+    const auto nodeCount = g.getRemovalCount();
+    g.clear();
+    EXPECT_GT( g.getRemovalCount(), nodeCount );
+}
+
+TEST(GTpoTopo, removeNodesBulk)
+{
+    gtpo::GenGraph<> g;
+    std::vector< gtpo::GenGraph<>::WeakNode > nodes;
+    for ( int n = 0; n < 10; ++n )
+        nodes.push_back( g.createNode() );
+    for ( int n = 1; n < 10; ++n )
+        g.createEdge( nodes[ n - 1 ], nodes[ n ] );
+    auto he = g.createEdge( nodes[ 0 ], g.findEdge( nodes[ 4 ], nodes[ 5 ] ) );
+    std::vector< gtpo::GenGraph<>::WeakNode > removed{ nodes[ 2 ], nodes[ 5 ], nodes[ 5 ], nodes[ 7 ] };
+    g.removeNodes( removed );           // Duplicates are ignored
+    EXPECT_EQ( g.getNodeCount(), 7 );
+    EXPECT_EQ( g.getEdgeCount(), 3 );   // 0-1, 3-4, 8-9 (he is removed with 4-5)
+    EXPECT_FALSE( g.contains( he ) );
+    EXPECT_FALSE( g.contains( nodes[ 5 ] ) );
+    EXPECT_TRUE( g.isRootNode( nodes[ 3 ] ) );
+    EXPECT_TRUE( g.isRootNode( nodes[ 6 ] ) );
+    EXPECT_TRUE( g.isRootNode( nodes[ 8 ] ) );
+    EXPECT_EQ( g.getRootNodeCount(), 4 );
+    EXPECT_EQ( nodes[ 0 ].lock()->getOutDegree(), 1 );
+    g.removeEdges( std::vector< gtpo::GenGraph<>::WeakEdge >{ g.findEdge( nodes[ 0 ], nodes[ 1 ] ) } );
+    EXPECT_EQ( g.getEdgeCount(), 2 );
+    EXPECT_EQ( g.getRootNodeCount(), 5 );
+    g.clear();
+}
+
+struct UnorderedConfig : public gtpo::GraphConfig,
+                         public gtpo::StdContainerAccessors,
+                         public gtpo::PropertiesAccessors< gtpo::GenNode<UnorderedConfig>,
+                                                           gtpo::GenEdge<UnorderedConfig>,
+                                                           gtpo::GenGroup<UnorderedConfig> >
+{
+    using Removal   = gtpo::UnorderedRemoval;
+    using Node      = gtpo::GenNode<UnorderedConfig>;
+    using Edge      = gtpo::GenEdge<UnorderedConfig>;
+    using Group     = gtpo::GenGroup<UnorderedConfig>;
+};
+
+TEST(GTpoTopo, unorderedRemoval)
+{
+    using Graph = gtpo::GenGraph< UnorderedConfig >;
+    Graph g;
+    std::vector< Graph::WeakNode > nodes;
+    for ( int n = 0; n < 6; ++n )
+        nodes.push_back( g.createNode() );
+    auto e1 = g.createEdge( nodes[ 0 ], nodes[ 1 ] );
+    auto e2 = g.createEdge( nodes[ 1 ], nodes[ 2 ] );
+    auto e3 = g.createEdge( nodes[ 5 ], nodes[ 0 ] );
+    g.removeNode( nodes[ 1 ] );         // Remove e1 and e2, last node is moved in nodes[1] position
+    EXPECT_EQ( g.getNodeCount(), 5 );
+    EXPECT_EQ( g.getEdgeCount(), 1 );
+    EXPECT_TRUE( g.contains( e3 ) );
+    EXPECT_FALSE( g.contains( e1 ) );
+    EXPECT_FALSE( g.contains( e2 ) );
+    EXPECT_TRUE( g.getNodes()[ 1 ] == nodes[ 5 ].lock() );
+    g.removeNode( nodes[ 5 ] );         // Moved node could still be removed
+    g.removeNode( nodes[ 0 ] );
+    EXPECT_EQ( g.getEdgeCount(), 0 );
+    g.removeNodes( std::vector< Graph::WeakNode >{ nodes[ 2 ], nodes[ 4 ] } );
+    g.removeNode( nodes[ 3 ] );         // Indexes are rebuilt after bulk removal
+    EXPECT_EQ( g.getNodeCount(), 0 );
+    EXPECT_EQ( g.getRootNodeCount(), 0 );
+    g.clear();
+}
+
+TEST(GTpoTopo, unorderedGroupRemoval)
+{
+    using Graph = gtpo::GenGraph< UnorderedConfig >;
+    Graph g;
+    std::vector< Graph::WeakNode > nodes;
+    for ( int n = 0; n < 4; ++n )
+        nodes.push_back( g.createNode() );
+    auto group = g.createGroup().lock();
+    ASSERT_TRUE( group );
+    group->insertNodes( nodes );
+    EXPECT_EQ( group->getNodeCount(), 4 );
+    group->removeNode( nodes[ 0 ] );    // Last node is moved in nodes[0] position
+    EXPECT_TRUE( group->getNodes()[ 0 ].lock() == nodes[ 3 ].lock() );
+    EXPECT_FALSE( group->hasNode( nodes[ 0 ] ) );
+    group->removeNode( nodes[ 3 ] );    // Moved node could still be removed
+    group->removeNode( nodes[ 1 ] );
+    EXPECT_EQ( group->getNodeCount(), 1 );
+    EXPECT_TRUE( group->hasNode( nodes[ 2 ] ) );
+    g.clear();
+}
+
+struct PooledConfig : public gtpo::GraphConfig,
+                      public gtpo::StdContainerAccessors,
+                      public gtpo::PropertiesAccessors< gtpo::GenNode<PooledConfig>,
+                                                        gtpo::GenEdge<PooledConfig>,
+                                                        gtpo::GenGroup<PooledConfig> >
+{
+    using Allocation    = gtpo::PoolAllocation;
+    using Node          = gtpo::GenNode<PooledConfig>;
+    using Edge          = gtpo::GenEdge<PooledConfig>;
+    using Group         = gtpo::GenGroup<PooledConfig>;
+};
+
+TEST(GTpoTopo, poolAllocation)
+{
+    using Graph = gtpo::GenGraph< PooledConfig >;
+    Graph::WeakNode survivor;
+    {
+        Graph g;
+        auto n1 = g.createNode();
+        auto n2 = g.createNode();
+        auto n3 = g.createNode();
+        g.createEdge( n1, n2 );
+        g.createEdge( n2, n3 );
+        g.createGroup();
+        EXPECT_EQ( g.getNodeCount(), 3 );
+        EXPECT_EQ( g.getEdgeCount(), 2 );
+        // Nodes created in sequence are allocated in the same chunk at a constant stride
+        const auto p1 = reinterpret_cast< std::uintptr_t >( n1.lock().get() );
+        const auto p2 = reinterpret_cast< std::uintptr_t >( n2.lock().get() );
+        const auto p3 = reinterpret_cast< std::uintptr_t >( n3.lock().get() );
+        EXPECT_EQ( p2 - p1, p3 - p2 );
+        g.removeNode( n2 );
+        EXPECT_EQ( g.getEdgeCount(), 0 );
+        n2.reset();                 // Block is released with the last weak reference (control block and node share the block)
+        auto n4 = g.createNode();   // Freed block is reused
+        EXPECT_EQ( reinterpret_cast< std::uintptr_t >( n4.lock().get() ), p2 );
+        g.clear();
+        EXPECT_TRUE( n1.expired() );
+        survivor = g.createNode();
+    }   // Graph destroyed while a weak reference on a pooled node is still alive
+    EXPECT_TRUE( survivor.expired() );
+    survivor.reset();   // Release the last control block, and then the pool
+
+    gtpo::MemoryPool pool{ 4 };
+    void* block = pool.allocate( 24, alignof( std::max_align_t ) );
+    EXPECT_NE( block, nullptr );
+    EXPECT_EQ( pool.allocate( 256, alignof( std::max_align_t ) ), nullptr );   // Pool block size is fixed by first allocation
+    EXPECT_FALSE( pool.trim() );
+    pool.deallocate( block );
+    EXPECT_TRUE( pool.trim() );
+    EXPECT_EQ( pool.getChunkCount(), 0u );
+}
+
+struct InlineAdjacencyConfig : public gtpo::GraphConfig,
+                               public gtpo::StdContainerAccessors,
+                               public gtpo::PropertiesAccessors< gtpo::GenNode<InlineAdjacencyConfig>,
+                                                                 gtpo::GenEdge<InlineAdjacencyConfig>,
+                                                                 gtpo::GenGroup<InlineAdjacencyConfig> >
+{
+    using Adjacency     = gtpo::InlineAdjacency<4>;
+    using AdjacentNodes = gtpo::DerivedAdjacentNodes;
+    using Node          = gtpo::GenNode<InlineAdjacencyConfig>;
+    using Edge          = gtpo::GenEdge<InlineAdjacencyConfig>;
+    using Group         = gtpo::GenGroup<InlineAdjacencyConfig>;
+};
+
+TEST(GTpoTopo, inlineAdjacency)
+{
+    using Graph = gtpo::GenGraph< InlineAdjacencyConfig >;
+    static_assert( std::is_same< InlineAdjacencyConfig::Node::WeakEdges, gtpo::SmallVector< Graph::WeakEdge, 4 > >::value, "" );
+    Graph g;
+    auto hub = g.createNode();
+    std::vector< Graph::WeakNode > leafs;
+    for ( int n = 0; n < 6; ++n ) {     // Hub out degree spill from inline storage
+        leafs.push_back( g.createNode() );
+        g.createEdge( hub, leafs.back() );
+        EXPECT_EQ( hub.lock()->getOutEdges().isInline(), n < 4 );
+    }
+    auto hubPtr = hub.lock();
+    EXPECT_EQ( hubPtr->getOutDegree(), 6u );
+    auto outNodes = hubPtr->getOutNodes();      // Derived from out edges
+    ASSERT_EQ( outNodes.size(), 6u );
+    EXPECT_TRUE( gtpo::compare_weak_ptr<>( outNodes[ 5 ], leafs[ 5 ] ) );
+    EXPECT_EQ( leafs[ 0 ].lock()->getInNodes().size(), 1u );
+
+    g.removeNode( leafs[ 2 ] );
+    EXPECT_EQ( hubPtr->getOutDegree(), 5u );
+    EXPECT_EQ( hubPtr->getOutNodes().size(), 5u );
+    g.removeEdge( leafs[ 0 ].lock()->getInEdges()[ 0 ] );
+    EXPECT_EQ( hubPtr->getOutDegree(), 4u );
+    EXPECT_TRUE( g.isRootNode( leafs[ 0 ] ) );
+
+    // In hyper edges side record is only allocated for edges with in hyper edges
+    auto edge = g.createEdge( leafs[ 3 ], leafs[ 4 ] );
+    EXPECT_EQ( edge.lock()->getInHDegree(), 0 );
+    auto hEdge = g.createEdge( leafs[ 5 ], edge );
+    EXPECT_EQ( edge.lock()->getInHDegree(), 1 );
+    EXPECT_EQ( edge.lock()->getInHNodes().size(), 1u );
+    g.removeEdge( hEdge );
+    EXPECT_EQ( edge.lock()->getInHDegree(), 0 );
+    g.clear();
+
+    gtpo::SmallVector< int, 2 > values{ 1, 2, 3 };
+    EXPECT_FALSE( values.isInline() );
+    values.erase( values.begin() );
+    gtpo::SmallVector< int, 2 > copy{ values };
+    EXPECT_TRUE( copy.isInline() );
+    EXPECT_EQ( copy[ 0 ], 2 );
+    EXPECT_EQ( copy.back(), 3 );
+    gtpo::SmallVector< int, 2 > moved{ std::move( values ) };
+    EXPECT_EQ( moved.size(), 2u );
+    EXPECT_TRUE( values.empty() );
+}
+
 //-----------------------------------------------------------------------------
 // GTpo topology restricted hyper edges tests
 //-----------------------------------------------------------------------------
@@ -520,6 +797,41 @@ TEST(GTpo, protobufHEdges)
     } else ASSERT_TRUE( false );
 }
 
+TEST(GTpo, protobufIncremental)
+{
+    gtpo::GenGraph<> go;
+    auto n1 = go.createNode();
+    auto n2 = go.createNode();
+    auto n3 = go.createNode();
+    auto e1 = go.createEdge(n1, n2);
+    go.createEdge(n2, n3);
+    go.createEdge(n3, e1);
+    auto group1 = go.createGroup();
+    group1.lock()->insertNode( n1 );
+
+    gtpo::ProtoSerializer<> ps;
+    gtpo::pb::Graph pbGraph;
+    gtpo::ProgressNotifier progress;
+    ps.serializeOut( go, pbGraph, progress );
+
+    gtpo::GenGraph<> gi;
+    gtpo::ProtoSerializer<>::InCursor cursor;
+    int calls = 0;
+    double lastProgress = 0.;
+    while ( !ps.serializeInSome( pbGraph, gi, cursor, 2 ) ) {
+        EXPECT_GT( cursor.getProgress( pbGraph ), lastProgress );
+        lastProgress = cursor.getProgress( pbGraph );
+        ++calls;
+    }
+    EXPECT_EQ( calls, 3 );     // 1 group + 3 nodes + 3 edges, 2 by 2
+    EXPECT_DOUBLE_EQ( cursor.getProgress( pbGraph ), 1. );
+    EXPECT_TRUE( ps.serializeInSome( pbGraph, gi, cursor, 2 ) );    // Complete serialization is a no-op
+    EXPECT_EQ( gi.getNodeCount(), 3 );
+    EXPECT_EQ( gi.getEdges().size(), 3u );
+    EXPECT_EQ( gi.getGroups().size(), 1u );
+    EXPECT_EQ( gi.getGroups()[0]->getNodeCount(), 1 );
+}
+
 //-----------------------------------------------------------------------------
 // GTpo Progress Notifier Tests
 //-----------------------------------------------------------------------------
@@ -639,6 +951,53 @@ TEST(GTpo, stpoGroupAdjacentEdgesBehaviour2)
     g.clear();
 }
 
+TEST(GTpo, stpoGroupAdjacentEdgesCounted)
+{
+    stpo::Graph g;
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    auto n3 = g.createNode();
+    auto e1 = g.createEdge( n1, n2 );
+    auto e2 = g.createEdge( n1, n2 );   // Parallel edge
+    auto e3 = g.createEdge( n2, n3 );
+    auto e4 = g.createEdge( n3, n3 );   // Self loop
+
+    auto sg1 = g.createGroup().lock();
+    ASSERT_TRUE( sg1 );
+    std::vector< stpo::Graph::WeakNode > nodes{ n1, n2, n3, n1 };   // Duplicated nodes are inserted once
+    sg1->insertNodes( nodes );
+    EXPECT_EQ( sg1->getNodeCount(), 3 );
+    auto& adjacentEdges = sg1->getAdjacentEdges();
+    EXPECT_EQ( adjacentEdges.size(), 4u );
+    EXPECT_EQ( adjacentEdges.getCount( e1.lock().get() ), 2u );     // Both endpoints in group
+    EXPECT_EQ( adjacentEdges.getCount( e4.lock().get() ), 2u );
+    EXPECT_TRUE( gtpo::find_weak_ptr( adjacentEdges, e2 ) );
+
+    sg1->insertNode( n2 );              // Already in group, adjacent edges are not counted twice
+    EXPECT_EQ( adjacentEdges.getCount( e3.lock().get() ), 2u );
+
+    sg1->removeNode( n3 );              // e3 stay adjacent trought n2, e4 is no longer adjacent
+    EXPECT_EQ( adjacentEdges.size(), 3u );
+    EXPECT_EQ( adjacentEdges.getCount( e3.lock().get() ), 1u );
+    EXPECT_FALSE( adjacentEdges.contains( e4.lock().get() ) );
+
+    auto sg2 = g.createGroup().lock(); // Moving n3 to another group
+    sg2->insertNode( n3 );
+    EXPECT_EQ( sg2->getAdjacentEdges().size(), 2u );
+    g.createEdge( n3, n1 );             // Edge created between two groups is adjacent to both
+    EXPECT_EQ( adjacentEdges.size(), 4u );
+    EXPECT_EQ( sg2->getAdjacentEdges().size(), 3u );
+
+    g.removeEdge( e3 );                 // Edge removal remove edge whatever its count is
+    EXPECT_EQ( adjacentEdges.size(), 3u );
+    EXPECT_EQ( sg2->getAdjacentEdges().size(), 2u );
+
+    sg1->removeNode( n1 );
+    sg1->removeNode( n2 );
+    EXPECT_TRUE( adjacentEdges.empty() );
+    g.clear();
+}
+
 
 //-----------------------------------------------------------------------------
 // GTpo Behaviour test (using STpo)
@@ -823,3 +1182,779 @@ TEST(GTpo, stpoRemoveNodeNodesCount)
 }
 
 
+
+TEST(GTpo, stpoContainsOwnerPointer)
+{
+    stpo::Graph g;
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    auto e1 = g.createEdge( n1, n2 );
+    auto g1 = g.createGroup();
+    g1.lock()->insertNode( n1 );
+    EXPECT_TRUE( g.contains( n1 ) );
+    EXPECT_TRUE( g.contains( n1.lock().get() ) );
+    EXPECT_TRUE( g.contains( e1.lock().get() ) );
+    EXPECT_TRUE( g.hasGroup( g1.lock().get() ) );
+    EXPECT_TRUE( g1.lock()->hasNode( n1 ) );
+    EXPECT_FALSE( g1.lock()->hasNode( n2 ) );
+    EXPECT_FALSE( g.contains( static_cast< const stpo::Node* >( nullptr ) ) );
+    EXPECT_TRUE( g.isRootNode( n1 ) );
+    EXPECT_FALSE( g.isRootNode( n2 ) );
+
+    g.removeEdge( e1 );
+    EXPECT_FALSE( g.contains( e1 ) );       // e1 is expired
+    EXPECT_TRUE( g.isRootNode( n2 ) );
+    g1.lock()->removeNode( n1 );
+    EXPECT_FALSE( g1.lock()->hasNode( n1 ) );
+    g.removeNode( n2 );
+    EXPECT_FALSE( g.contains( n2 ) );
+    g.removeGroup( g1 );
+    EXPECT_FALSE( g.hasGroup( g1 ) );
+    g.clear();
+}
+
+template < class Config >
+class BatchCountingBehaviour : public gtpo::GraphBehaviour< Config >
+{
+public:
+    using WeakNode          = std::weak_ptr< typename Config::Node >;
+    using WeakEdge          = std::weak_ptr< typename Config::Edge >;
+    using WeakNodesBatch    = typename gtpo::GraphBehaviour< Config >::WeakNodesBatch;
+    using WeakEdgesBatch    = typename gtpo::GraphBehaviour< Config >::WeakEdgesBatch;
+
+    int nodeInsertedCount{ 0 };
+    int nodesInsertedCount{ 0 };
+    int edgeInsertedCount{ 0 };
+    int edgesInsertedCount{ 0 };
+    int nodeRemovedCount{ 0 };
+    int edgeRemovedCount{ 0 };
+    std::size_t lastNodesBatchSize{ 0 };
+    std::size_t lastEdgesBatchSize{ 0 };
+protected:
+    virtual void    nodeInserted( WeakNode& ) noexcept override { ++nodeInsertedCount; }
+    virtual void    edgeInserted( WeakEdge& ) noexcept override { ++edgeInsertedCount; }
+    virtual void    nodesInserted( const WeakNodesBatch& nodes ) noexcept override { ++nodesInsertedCount; lastNodesBatchSize = nodes.size(); }
+    virtual void    edgesInserted( const WeakEdgesBatch& edges ) noexcept override { ++edgesInsertedCount; lastEdgesBatchSize = edges.size(); }
+    virtual void    nodeRemoved( WeakNode& ) noexcept override { ++nodeRemovedCount; }
+    virtual void    edgeRemoved( WeakEdge& ) noexcept override { ++edgeRemovedCount; }
+};
+
+TEST(GTpo, stpoBatchNotifications)
+{
+    stpo::Graph g;
+    using Behaviour = BatchCountingBehaviour< stpo::Graph::Configuration >;
+    auto behaviour = new Behaviour();
+    g.addBehaviour( std::unique_ptr< Behaviour >( behaviour ) );
+
+    stpo::Graph::WeakNode n1, n2, n3;
+    {
+        stpo::Graph::BatchScope batch{ g };
+        EXPECT_TRUE( g.isInBatch() );
+        n1 = g.createNode();
+        n2 = g.createNode();
+        n3 = g.createNode();
+        {
+            stpo::Graph::BatchScope nestedBatch{ g };   // Nested batches are flushed with the outermost one
+            g.createEdge( n1, n2 );
+            g.createEdge( n2, n3 );
+            g.createEdge( n3, n3 );
+        }
+        auto removed = g.createNode();
+        g.removeNode( removed );    // Removed during batch, never notified
+        EXPECT_EQ( behaviour->nodesInsertedCount, 0 );
+        EXPECT_EQ( behaviour->edgesInsertedCount, 0 );
+    }
+    EXPECT_FALSE( g.isInBatch() );
+    EXPECT_EQ( behaviour->nodesInsertedCount, 1 );
+    EXPECT_EQ( behaviour->lastNodesBatchSize, 3u );
+    EXPECT_EQ( behaviour->edgesInsertedCount, 1 );
+    EXPECT_EQ( behaviour->lastEdgesBatchSize, 3u );
+    EXPECT_EQ( behaviour->nodeInsertedCount, 0 );
+    EXPECT_EQ( behaviour->edgeInsertedCount, 0 );
+
+    // Root nodes are maintained at the end of the batch
+    EXPECT_TRUE( g.isRootNode( n1 ) );
+    EXPECT_FALSE( g.isRootNode( n2 ) );
+    EXPECT_FALSE( g.isRootNode( n3 ) );
+    EXPECT_EQ( g.getRootNodeCount(), 1 );
+
+    g.createNode();     // Outside a batch, notifications are immediate
+    EXPECT_EQ( behaviour->nodeInsertedCount, 1 );
+    EXPECT_THROW( g.endBatch(), gtpo::bad_topology_error );
+    g.clear();
+}
+
+TEST(GTpo, stpoBatchRemovalNotifications)
+{
+    stpo::Graph g;
+    using Behaviour = BatchCountingBehaviour< stpo::Graph::Configuration >;
+    auto behaviour = new Behaviour();
+    g.addBehaviour( std::unique_ptr< Behaviour >( behaviour ) );
+
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    auto e1 = g.createEdge( n1, n2 );
+    {
+        stpo::Graph::BatchScope batch{ g };
+        auto n3 = g.createNode();
+        auto n4 = g.createNode();
+        g.createEdge( n3, n4 );
+        g.createEdge( n1, n3 );
+        g.removeNode( n3 );     // Inserted in batch: neither n3 nor its edges removal are notified
+        EXPECT_EQ( behaviour->nodeRemovedCount, 0 );
+        EXPECT_EQ( behaviour->edgeRemovedCount, 0 );
+        g.removeEdge( e1 );     // Inserted before batch: removal is notified immediately
+        EXPECT_EQ( behaviour->edgeRemovedCount, 1 );
+    }
+    EXPECT_EQ( behaviour->nodesInsertedCount, 1 );
+    EXPECT_EQ( behaviour->lastNodesBatchSize, 1u );     // Only n4
+    EXPECT_EQ( behaviour->edgesInsertedCount, 0 );
+
+    {
+        stpo::Graph::BatchScope batch{ g };
+        auto n5 = g.createNode();
+        g.removeNode( n1 );     // Inserted before batch
+        g.removeNode( n5 );
+        EXPECT_EQ( behaviour->nodeRemovedCount, 1 );
+    }
+    g.removeNode( n2 );         // Outside a batch, notifications are immediate
+    EXPECT_EQ( behaviour->nodeRemovedCount, 2 );
+    g.clear();
+}
+
+TEST(GTpo, stpoBulkInsertion)
+{
+    stpo::Graph g;
+    using Behaviour = BatchCountingBehaviour< stpo::Graph::Configuration >;
+    auto behaviour = new Behaviour();
+    g.addBehaviour( std::unique_ptr< Behaviour >( behaviour ) );
+
+    auto n0 = g.createNode();
+    std::vector< stpo::Graph::SharedNode > nodes;
+    for ( int n = 0; n < 4; ++n )
+        nodes.emplace_back( std::make_shared< stpo::Node >() );
+    g.insertNodes( nodes );
+    EXPECT_EQ( g.getNodeCount(), 5 );
+    EXPECT_EQ( behaviour->nodeInsertedCount, 1 );
+    EXPECT_EQ( behaviour->nodesInsertedCount, 1 );
+    EXPECT_EQ( behaviour->lastNodesBatchSize, 4u );
+    EXPECT_TRUE( g.contains( nodes[ 3 ].get() ) );
+    EXPECT_EQ( g.getNodes()[ 4 ], nodes[ 3 ] );
+
+    std::vector< stpo::Graph::SharedEdge > edges;
+    for ( int e = 0; e < 3; ++e ) {
+        auto edge = std::make_shared< stpo::Edge >();
+        edge->setSrc( nodes[ e ] );
+        edge->setDst( nodes[ e + 1 ] );
+        edges.emplace_back( edge );
+    }
+    g.insertEdges( edges );
+    EXPECT_EQ( g.getEdgeCount(), 3u );
+    EXPECT_EQ( behaviour->edgesInsertedCount, 1 );
+    EXPECT_EQ( behaviour->lastEdgesBatchSize, 3u );
+    EXPECT_TRUE( g.hasEdge( nodes[ 0 ], nodes[ 1 ] ) );
+    EXPECT_TRUE( g.isRootNode( nodes[ 0 ] ) );
+    EXPECT_FALSE( g.isRootNode( nodes[ 3 ] ) );
+    EXPECT_EQ( g.getRootNodeCount(), 2 );     // n0 and nodes[0]
+
+    // Invalid ranges are rejected without modifying graph
+    std::vector< stpo::Graph::SharedEdge > invalidEdges{ std::make_shared< stpo::Edge >() };
+    EXPECT_THROW( g.insertEdges( invalidEdges ), gtpo::bad_topology_error );
+    EXPECT_EQ( g.getEdgeCount(), 3u );
+    std::vector< stpo::Graph::SharedNode > invalidNodes{ std::make_shared< stpo::Node >(), nullptr };
+    EXPECT_THROW( g.insertNodes( invalidNodes ), gtpo::bad_topology_error );
+    EXPECT_EQ( g.getNodeCount(), 5 );
+
+    g.removeNode( n0 );
+    g.removeNode( nodes[ 1 ] );
+    EXPECT_EQ( g.getEdgeCount(), 1u );
+    g.clear();
+}
+
+TEST(GTpo, stpoResetTopology)
+{
+    stpo::Graph g;
+    auto n1 = g.createNode().lock();
+    auto n2 = g.createNode().lock();
+    auto n3 = g.createNode().lock();
+    auto e1 = g.createEdge( n1, n2 ).lock();
+    auto e2 = g.createEdge( n2, n3 ).lock();
+    auto he = g.createEdge( n1, e2 ).lock();
+    EXPECT_EQ( e2->getInHDegree(), 1 );
+
+    // Removed primitives are reset and recycled in another graph
+    g.removeEdge( he );
+    g.removeNode( n2 );
+    EXPECT_FALSE( g.contains( n2.get() ) );
+    n2->resetTopology();
+    e1->resetTopology();
+    e2->resetTopology();
+    he->resetTopology();
+    EXPECT_EQ( n2->getInDegree(), 0u );
+    EXPECT_EQ( n2->getOutDegree(), 0u );
+    EXPECT_TRUE( n2->getOutEdgesIndex().empty() );
+    EXPECT_TRUE( e1->getSrc().expired() );
+    EXPECT_TRUE( e1->getDst().expired() );
+    EXPECT_TRUE( he->getHDst().expired() );
+    EXPECT_EQ( e2->getInHDegree(), 0 );
+
+    stpo::Graph g2;
+    auto m1 = g2.createNode().lock();
+    g2.insertNode( n2 );
+    e1->setSrc( m1 );
+    e1->setDst( n2 );
+    g2.insertEdge( e1 );
+    EXPECT_TRUE( g2.contains( n2.get() ) );
+    EXPECT_TRUE( g2.hasEdge( m1, n2 ) );
+    EXPECT_EQ( n2->getInDegree(), 1u );
+    EXPECT_EQ( g2.getEdgeCount(), 1u );
+    g2.removeNode( n2 );
+    EXPECT_EQ( g2.getEdgeCount(), 0u );
+    g.clear();
+    g2.clear();
+}
+
+template < class Config >
+class EdgeInsertedBehaviour : public BatchCountingBehaviour< Config >
+{
+public:
+    virtual auto    getEvents() const noexcept -> gtpo::BehaviourEventMask override { return gtpo::BehaviourEvent::EdgeInserted; }
+};
+
+TEST(GTpo, stpoEventMaskedBehaviours)
+{
+    using Config = stpo::Graph::Configuration;
+    // Static behaviours event masks are known at compile time
+    static_assert( gtpo::behaviour_events< gtpo::GraphGroupAjacentEdgesBehaviour< Config > >::value ==
+                   ( gtpo::BehaviourEvent::EdgeInserted | gtpo::BehaviourEvent::EdgeRemoved ), "" );
+    static_assert( gtpo::behaviour_events< BatchCountingBehaviour< Config > >::value == gtpo::BehaviourEvent::All, "" );
+    static_assert( ( stpo::Graph::getStaticEvents() & gtpo::BehaviourEvent::NodeInserted ) == 0, "" );
+    static_assert( gtpo::BehaviourEvent::index( gtpo::BehaviourEvent::OutNodeRemoved ) == gtpo::BehaviourEvent::Count - 1, "" );
+
+    stpo::Graph g;
+    EXPECT_EQ( g.getEvents(), gtpo::BehaviourEventMask{ gtpo::BehaviourEvent::None } );
+    auto all = new BatchCountingBehaviour< Config >();
+    auto masked = new EdgeInsertedBehaviour< Config >();
+    g.addBehaviour( std::unique_ptr< BatchCountingBehaviour< Config > >( all ) );
+    g.addBehaviour( std::unique_ptr< EdgeInsertedBehaviour< Config > >( masked ) );
+    EXPECT_EQ( g.getEvents(), gtpo::BehaviourEventMask{ gtpo::BehaviourEvent::All } );
+
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    g.createEdge( n1, n2 );
+    EXPECT_EQ( all->nodeInsertedCount, 2 );
+    EXPECT_EQ( all->edgeInsertedCount, 1 );
+    EXPECT_EQ( masked->nodeInsertedCount, 0 );  // Not subscribed to NodeInserted
+    EXPECT_EQ( masked->edgeInsertedCount, 1 );
+    {
+        stpo::Graph::BatchScope batch{ g };     // Batch notifications follow their per primitive event
+        g.createNode();
+        g.createEdge( n2, n1 );
+    }
+    EXPECT_EQ( masked->nodesInsertedCount, 0 );
+    EXPECT_EQ( masked->edgesInsertedCount, 1 );
+
+    // Static group behaviour is still applied with virtual behaviours registered
+    auto group = g.createGroup().lock();
+    ASSERT_TRUE( group );
+    group->insertNode( n1 );
+    EXPECT_EQ( group->getAdjacentEdges().size(), 2u );
+
+    g.BehaviourableBase::clear();
+    EXPECT_EQ( g.getEvents(), gtpo::BehaviourEventMask{ gtpo::BehaviourEvent::None } );
+    g.createNode();
+    g.clear();
+}
+
+TEST(GTpo, stpoCsrSnapshot)
+{
+    stpo::Graph g;
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    auto n3 = g.createNode();
+    auto n4 = g.createNode();
+    auto e1 = g.createEdge( n1, n2 );
+    g.createEdge( n1, n3 );
+    g.createEdge( n1, n3 );     // Parallel edge
+    g.createEdge( n3, n3 );     // Trivial circuit
+    g.createEdge( n4, e1 );     // Hyper edge, not part of snapshot
+
+    gtpo::CsrSnapshot< stpo::Graph > csr{ g };
+    EXPECT_EQ( csr.getNodeCount(), 4u );
+    EXPECT_EQ( csr.getEdgeCount(), 4u );
+    const auto i1 = csr.getNodeIndex( n1 );
+    const auto i2 = csr.getNodeIndex( n2 );
+    const auto i3 = csr.getNodeIndex( n3 );
+    const auto i4 = csr.getNodeIndex( n4 );
+    EXPECT_EQ( csr.getOutDegree( i1 ), 3u );
+    EXPECT_EQ( csr.getInDegree( i2 ), 1u );
+    EXPECT_EQ( csr.getInDegree( i3 ), 3u );
+    EXPECT_EQ( csr.getOutDegree( i3 ), 1u );
+    EXPECT_EQ( csr.getOutDegree( i4 ), 0u );
+    EXPECT_EQ( csr.getOutNodes( i1 )[ 0 ], i2 );
+    EXPECT_EQ( csr.getOutNodes( i1 )[ 1 ], i3 );
+    EXPECT_EQ( csr.getInNodes( i2 )[ 0 ], i1 );
+    const auto e = csr.getOutEdges( i1 )[ 0 ];
+    EXPECT_TRUE( gtpo::compare_weak_ptr( csr.getEdge( e ), e1 ) );
+    EXPECT_EQ( csr.getEdgeSrc( e ), i1 );
+    EXPECT_EQ( csr.getEdgeDst( e ), i2 );
+    EXPECT_TRUE( gtpo::compare_weak_ptr( csr.getNode( i3 ), n3 ) );
+
+    // Snapshot is not affected by later graph modifications
+    g.removeNode( n2 );
+    EXPECT_EQ( csr.getNodeCount(), 4u );
+    EXPECT_TRUE( csr.getNode( i2 ).expired() );
+    EXPECT_EQ( csr.getNodeIndex( static_cast< const stpo::Node* >( nullptr ) ), csr.invalidIndex );
+    g.clear();
+}
+
+TEST(GTpo, stpoGraphSnapshot)
+{
+    stpo::Graph g;
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    auto n3 = g.createNode();
+    auto e1 = g.createEdge( n1, n2 );
+    g.createEdge( n2, n3 );
+    g.createEdge( n3, e1 );     // Hyper edge, not part of snapshot
+    n1.lock()->setLabel( "n1" );
+
+    const auto s1 = g.snapshot();
+    EXPECT_EQ( s1.getNodeCount(), 3u );
+    EXPECT_EQ( s1.getEdgeCount(), 2u );
+    const auto i1 = g.getSnapshotIndex( n1.lock().get() );
+    const auto i2 = g.getSnapshotIndex( n2.lock().get() );
+    const auto ie1 = g.getSnapshotIndex( e1.lock().get() );
+    ASSERT_TRUE( s1.hasNode( i1 ) );
+    EXPECT_EQ( s1.getNode( i1 ).label, "n1" );
+    ASSERT_EQ( s1.getNode( i1 ).outEdges.size(), 1u );
+    EXPECT_EQ( s1.getNode( i1 ).outEdges[ 0 ], ie1 );
+    EXPECT_EQ( s1.getEdge( ie1 ).src, i1 );
+    EXPECT_EQ( s1.getEdge( ie1 ).dst, i2 );
+    EXPECT_EQ( g.snapshot().getVersion(), s1.getVersion() );   // No changes, same version
+
+    // Modifications are visible in next snapshot only
+    n1.lock()->setX( 42. );
+    e1.lock()->setWeight( 2. );
+    g.removeNode( n2 );
+    auto n4 = g.createNode();   // Reuse n2 slot
+    const auto s2 = g.snapshot();
+    EXPECT_GT( s2.getVersion(), s1.getVersion() );
+    EXPECT_DOUBLE_EQ( s1.getNode( i1 ).x, 0. );
+    EXPECT_DOUBLE_EQ( s2.getNode( i1 ).x, 42. );
+    EXPECT_DOUBLE_EQ( s1.getEdge( ie1 ).weight, 0. );
+    EXPECT_EQ( s1.getNodeCount(), 3u );
+    EXPECT_EQ( s1.getEdgeCount(), 2u );
+    EXPECT_EQ( s2.getNodeCount(), 3u );
+    EXPECT_EQ( s2.getEdgeCount(), 0u );
+    EXPECT_TRUE( s2.getNode( i1 ).outEdges.empty() );
+    EXPECT_FALSE( s2.hasEdge( ie1 ) );
+    EXPECT_EQ( g.getSnapshotIndex( n4.lock().get() ), i2 );
+
+    // Traverse a snapshot from a worker thread while graph is modified
+    auto n5 = g.createNode();
+    g.createEdge( n4, n5 );
+    const auto s3 = g.snapshot();
+    std::size_t edgeCount = 0;
+    std::thread worker{ [s3, &edgeCount]() {
+        for ( stpo::Graph::Snapshot::Index n = 0; n < s3.getNodeSlotCount(); ++n )
+            if ( s3.hasNode( n ) )
+                edgeCount += s3.getNode( n ).outEdges.size();
+    } };
+    for ( int i = 0; i < 100; ++i ) {
+        auto n = g.createNode();
+        g.createEdge( n4, n );
+        n4.lock()->setY( i );
+        g.snapshot();
+    }
+    worker.join();
+    EXPECT_EQ( edgeCount, 1u );
+    EXPECT_EQ( s3.getNode( g.getSnapshotIndex( n4.lock().get() ) ).outEdges.size(), 1u );
+    EXPECT_EQ( g.snapshot().getNode( g.getSnapshotIndex( n4.lock().get() ) ).outEdges.size(), 101u );
+
+    g.clear();
+    EXPECT_EQ( g.snapshot().getNodeCount(), 0u );
+    EXPECT_EQ( s3.getNodeCount(), 4u );
+}
+
+TEST(GTpo, mpscQueue)
+{
+    gtpo::MpscQueue< int > q{ 5 };
+    EXPECT_EQ( q.getCapacity(), 8u );
+    EXPECT_TRUE( q.isEmpty() );
+    for ( int i = 0; i < 8; ++i )
+        EXPECT_TRUE( q.tryPush( i ) );
+    EXPECT_FALSE( q.tryPush( 8 ) );     // Full, rejected
+    EXPECT_FALSE( q.push( 8, std::chrono::milliseconds{ 1 } ) );
+    EXPECT_EQ( q.getSize(), 8u );
+    EXPECT_EQ( q.getPushedCount(), 8u );
+    EXPECT_EQ( q.getRejectedCount(), 2u );
+    int v = -1;
+    EXPECT_TRUE( q.tryPop( v ) );
+    EXPECT_EQ( v, 0 );
+    EXPECT_TRUE( q.tryPush( 8 ) );
+    int expected = 1;
+    EXPECT_EQ( q.popMany( [&expected]( int&& i ) { EXPECT_EQ( i, expected++ ); return i < 4; } ), 4u );
+    EXPECT_EQ( q.popMany( [&expected]( int&& i ) { EXPECT_EQ( i, expected++ ); } ), 4u );
+    EXPECT_FALSE( q.tryPop( v ) );
+    EXPECT_EQ( q.getPoppedCount(), 9u );
+
+    // Concurrent producers with backpressure, per producer order is preserved
+    using Value = std::pair< int, int >;
+    gtpo::MpscQueue< Value > mq{ 64 };
+    const int producerCount = 4, valueCount = 20000;
+    std::vector< std::thread > producers;
+    for ( int p = 0; p < producerCount; ++p )
+        producers.emplace_back( [&mq, p, valueCount]() {
+            for ( int i = 0; i < valueCount; ++i )
+                while ( !mq.tryPush( Value{ p, i } ) )
+                    std::this_thread::yield();
+        } );
+    std::vector< int > next( producerCount, 0 );
+    int popped = 0;
+    bool ordered = true;
+    while ( popped < producerCount * valueCount )
+        popped += static_cast< int >( mq.popMany( [&next, &ordered]( Value&& value ) {
+            ordered = ordered && value.second == next[ value.first ]++;
+        } ) );
+    for ( auto& producer : producers )
+        producer.join();
+    EXPECT_TRUE( ordered );
+    EXPECT_TRUE( mq.isEmpty() );
+    EXPECT_EQ( mq.getPushedCount(), static_cast< std::uint64_t >( producerCount * valueCount ) );
+    EXPECT_EQ( mq.getPoppedCount(), mq.getPushedCount() );
+}
+
+TEST(GTpo, spatialGrid)
+{
+    gtpo::SpatialGrid< int > grid{ 100., 16 };
+    grid.insert( 0, 10., 10., 20., 20. );
+    grid.insert( 1, 90., 90., 30., 30. );           // Overlap 4 cells
+    grid.insert( 2, -500., -500., 2000., 10. );     // Oversized (more than 16 cells)
+    EXPECT_EQ( grid.size(), 3u );
+    std::vector< int > found;
+    const auto query = [&grid, &found]( double x, double y, double w, double h ) {
+        found.clear();
+        grid.query( x, y, w, h, [&found]( int key ) { found.push_back( key ); } );
+        std::sort( found.begin(), found.end() );
+    };
+    query( 0., 0., 50., 50. );
+    EXPECT_EQ( found, ( std::vector< int >{ 0 } ) );
+    query( 100., 100., 5., 5. );                    // Box reported once even if it overlap many cells
+    EXPECT_EQ( found, ( std::vector< int >{ 1 } ) );
+    query( -1000., -1000., 3000., 3000. );
+    EXPECT_EQ( found, ( std::vector< int >{ 0, 1, 2 } ) );
+    query( 1000., -495., 10., 1. );
+    EXPECT_EQ( found, ( std::vector< int >{ 2 } ) );
+
+    grid.insert( 0, 15., 15., 20., 20. );           // Move in the same cell
+    grid.insert( 1, 510., 510., 10., 10. );         // Move to another cell
+    double x = 0., y = 0., w = 0., h = 0.;
+    EXPECT_TRUE( grid.getBox( 1, x, y, w, h ) );
+    EXPECT_DOUBLE_EQ( x, 510. );
+    EXPECT_DOUBLE_EQ( w, 10. );
+    query( 0., 0., 200., 200. );
+    EXPECT_EQ( found, ( std::vector< int >{ 0 } ) );
+    EXPECT_TRUE( grid.remove( 2 ) );
+    EXPECT_FALSE( grid.remove( 2 ) );
+    query( -1000., -1000., 3000., 3000. );
+    EXPECT_EQ( found, ( std::vector< int >{ 0, 1 } ) );
+
+    // Random boxes checked against brute force intersection
+    std::mt19937 generator{ 42 };
+    std::uniform_real_distribution< double > position{ -2000., 2000. };
+    std::uniform_real_distribution< double > size{ 0., 400. };
+    std::vector< std::array< double, 4 > > boxes( 500 );
+    grid.clear();
+    for ( int b = 0; b < static_cast< int >( boxes.size() ); ++b ) {
+        boxes[ b ] = { position( generator ), position( generator ), size( generator ), size( generator ) };
+        grid.insert( b, boxes[ b ][ 0 ], boxes[ b ][ 1 ], boxes[ b ][ 2 ], boxes[ b ][ 3 ] );
+    }
+    for ( int q = 0; q < 50; ++q ) {
+        const double qx = position( generator ), qy = position( generator );
+        const double qw = size( generator ) * ( q % 10 ), qh = size( generator ) * ( q % 10 );
+        query( qx, qy, qw, qh );
+        std::vector< int > expected;
+        for ( int b = 0; b < static_cast< int >( boxes.size() ); ++b )
+            if ( boxes[ b ][ 0 ] <= qx + qw && qx <= boxes[ b ][ 0 ] + boxes[ b ][ 2 ] &&
+                 boxes[ b ][ 1 ] <= qy + qh && qy <= boxes[ b ][ 1 ] + boxes[ b ][ 3 ] )
+                expected.push_back( b );
+        EXPECT_EQ( found, expected );
+    }
+}
+
+TEST(GTpo, stpoRandomGraphGenerator)
+{
+    stpo::Graph g;
+    RandomGraph::RandomConfig rc;
+    rc.nodeCount = 50;
+    rc.outNodeRng = std::make_pair( 1, 2 );
+    RandomGraph::Generator< stpo::Graph > generator{ g, rc };
+    int steps = 0;
+    double progress = 0.;
+    while ( !generator.step( 10 ) ) {
+        EXPECT_GT( generator.getProgress(), progress );
+        progress = generator.getProgress();
+        ++steps;
+    }
+    EXPECT_EQ( steps, 9 );      // 50 nodes then 50 source nodes, 10 by 10
+    EXPECT_DOUBLE_EQ( generator.getProgress(), 1. );
+    EXPECT_TRUE( generator.step( 10 ) );
+    EXPECT_EQ( g.getNodeCount(), 50 );
+    EXPECT_GT( g.getEdges().size(), 0u );
+    EXPECT_LE( g.getEdges().size(), 100u );
+    ASSERT_EQ( g.getNodes().size(), 50u );
+    EXPECT_EQ( g.getNodes()[ 3 ]->getLabel(), "Node #3" );
+}
+
+TEST(GTpo, stpoAlgorithms)
+{
+    stpo::Graph g;
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    auto n3 = g.createNode();
+    auto n4 = g.createNode();
+    auto n5 = g.createNode();
+    auto e12 = g.createEdge( n1, n2 );
+    auto e23 = g.createEdge( n2, n3 );
+    auto e13 = g.createEdge( n1, n3 );
+    g.createEdge( n3, n4 );
+    e12.lock()->setWeight( 1. );
+    e23.lock()->setWeight( 1. );
+    e13.lock()->setWeight( 5. );
+
+    using Csr = gtpo::CsrSnapshot< stpo::Graph >;
+    namespace algo = gtpo::algorithm;
+    {
+        Csr csr{ g };
+        const auto i1 = csr.getNodeIndex( n1 ), i2 = csr.getNodeIndex( n2 ), i3 = csr.getNodeIndex( n3 );
+        const auto i4 = csr.getNodeIndex( n4 ), i5 = csr.getNodeIndex( n5 );
+
+        auto bfs = algo::bfs( csr, i1 );
+        EXPECT_FALSE( bfs.canceled );
+        EXPECT_EQ( bfs.reachedCount, 4u );
+        EXPECT_EQ( bfs.levels[ i1 ], 0u );
+        EXPECT_EQ( bfs.levels[ i3 ], 1u );
+        EXPECT_EQ( bfs.levels[ i4 ], 2u );
+        EXPECT_EQ( bfs.levels[ i5 ], algo::invalidIndex );
+
+        auto topo = algo::topologicalSort( csr );
+        EXPECT_TRUE( topo.isAcyclic() );
+        EXPECT_EQ( topo.order.size(), 5u );
+
+        auto paths = algo::shortestPaths( csr, algo::getEdgeWeights( csr ), i1 );
+        EXPECT_DOUBLE_EQ( paths.distances[ i3 ], 2. );      // Through n2, not direct n1->n3 edge
+        EXPECT_TRUE( gtpo::compare_weak_ptr( csr.getEdge( paths.predecessors[ i3 ] ), e23 ) );
+        EXPECT_EQ( paths.predecessors[ i1 ], algo::invalidIndex );
+        EXPECT_THROW( algo::shortestPaths( csr, std::vector< double >{}, i1 ), gtpo::bad_topology_error );
+
+        auto scc = algo::stronglyConnectedComponents( csr );
+        EXPECT_EQ( scc.componentCount, 5u );
+        EXPECT_NE( scc.components[ i2 ], scc.components[ i3 ] );
+    }
+
+    g.createEdge( n4, n2 );     // Create circuit n2 -> n3 -> n4 -> n2
+    {
+        Csr csr{ g };
+        auto topo = algo::topologicalSort( csr );
+        EXPECT_FALSE( topo.isAcyclic() );
+        EXPECT_EQ( topo.cycleNodes.size(), 3u );
+
+        auto scc = algo::stronglyConnectedComponents( csr );
+        EXPECT_EQ( scc.componentCount, 3u );
+        EXPECT_EQ( scc.components[ csr.getNodeIndex( n2 ) ], scc.components[ csr.getNodeIndex( n4 ) ] );
+        EXPECT_NE( scc.components[ csr.getNodeIndex( n1 ) ], scc.components[ csr.getNodeIndex( n2 ) ] );
+    }
+    g.clear();
+}
+
+TEST(GTpo, stpoAlgorithmsParallelBfsCancel)
+{
+    stpo::Graph g;
+    stpo::Graph::WeakNode root;
+    {
+        stpo::Graph::BatchScope batch{ g };
+        root = g.createNode();
+        std::vector< stpo::Graph::WeakNode > level;
+        for ( int n = 0; n < 5000; ++n ) {  // Wide frontier to trigger parallel expansion
+            auto node = g.createNode();
+            g.createEdge( root, node );
+            level.push_back( node );
+        }
+        for ( auto& node : level )
+            g.createEdge( node, g.createNode() );
+    }
+    gtpo::CsrSnapshot< stpo::Graph > csr{ g };
+    const auto source = csr.getNodeIndex( root );
+    auto bfs = gtpo::algorithm::bfs( csr, source, nullptr, 4 );
+    EXPECT_EQ( bfs.reachedCount, 10001u );
+    EXPECT_EQ( bfs.levels[ csr.getNodeIndex( g.getNodes().back() ) ], 2u );
+
+    gtpo::ProgressNotifier progress;
+    progress.cancel();
+    auto canceled = gtpo::algorithm::bfs( csr, source, &progress, 4 );
+    EXPECT_TRUE( canceled.canceled );
+    EXPECT_EQ( canceled.reachedCount, 1u );
+    progress.reset();
+    EXPECT_FALSE( progress.isCanceled() );
+    g.clear();
+}
+
+TEST(GTpo, stpoGeometryStore)
+{
+    stpo::Graph g;
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    n1.lock()->setX( 10. ); n1.lock()->setY( 20. ); n1.lock()->setWidth( 5. ); n1.lock()->setHeight( 5. );
+    n2.lock()->setX( -10. ); n2.lock()->setY( 0. ); n2.lock()->setWidth( 1. ); n2.lock()->setHeight( 2. );
+    auto group = g.createGroup();
+    group.lock()->setX( 1. );
+
+    gtpo::GeometryStore< stpo::Graph > store{ g };
+    auto& nodes = store.getNodes();
+    ASSERT_EQ( nodes.size(), 2u );
+    EXPECT_EQ( reinterpret_cast< std::uintptr_t >( nodes.x.data() ) % 32, 0u );
+    const auto s1 = store.getNodeSlot( n1 );
+    ASSERT_NE( s1, store.invalidSlot );
+    EXPECT_EQ( nodes.x[ s1 ], 10. );
+    EXPECT_EQ( nodes.y[ s1 ], 20. );
+    EXPECT_EQ( store.getGroups().x[ store.getGroupSlot( group ) ], 1. );
+
+    double left = 0., top = 0., right = 0., bottom = 0.;
+    EXPECT_TRUE( nodes.getBoundingBox( left, top, right, bottom ) );
+    EXPECT_EQ( left, -10. ); EXPECT_EQ( top, 0. ); EXPECT_EQ( right, 15. ); EXPECT_EQ( bottom, 25. );
+
+    // Geometry is written back to nodes only when store is committed
+    auto n3 = g.createNode();
+    EXPECT_EQ( store.getNodeSlot( n3 ), store.invalidSlot );
+    {
+        gtpo::GeometryStore< stpo::Graph >::BatchScope batch{ store };
+        EXPECT_TRUE( g.isInBatch() );
+        nodes.translate( 100., 50. );
+        store.getGroups().width[ 0 ] = 42.;
+        EXPECT_EQ( n1.lock()->getX(), 10. );
+    }
+    EXPECT_FALSE( g.isInBatch() );
+    EXPECT_EQ( n1.lock()->getX(), 110. );
+    EXPECT_EQ( n1.lock()->getY(), 70. );
+    EXPECT_EQ( n2.lock()->getX(), 90. );
+    EXPECT_EQ( group.lock()->getWidth(), 42. );
+
+    g.removeNode( n2 );     // Removed nodes are ignored on commit
+    store.commit();
+    store.load();
+    EXPECT_EQ( store.getNodes().size(), 2u );
+    EXPECT_NE( store.getNodeSlot( n3 ), store.invalidSlot );
+    g.clear();
+}
+
+//-----------------------------------------------------------------------------
+// GTpo dense storage tests
+//-----------------------------------------------------------------------------
+
+TEST(GTpoDense, slotMapStaleHandles)
+{
+    gtpo::SlotMap< int > m;
+    auto h1 = m.emplace( 1 );
+    auto h2 = m.emplace( 2 );
+    auto h3 = m.emplace( 3 );
+    EXPECT_TRUE( m.size() == 3 );
+    EXPECT_TRUE( m.erase( h1 ) );
+    EXPECT_FALSE( m.erase( h1 ) );          // h1 is now stale
+    EXPECT_FALSE( m.contains( h1 ) );
+    EXPECT_TRUE( *m.get( h2 ) == 2 );       // Last item moved in h1 position, handles are stable
+    EXPECT_TRUE( *m.get( h3 ) == 3 );
+    auto h4 = m.emplace( 4 );               // Reuse h1 slot with a new generation
+    EXPECT_TRUE( h4.getIndex() == h1.getIndex() );
+    EXPECT_FALSE( m.contains( h1 ) );
+    EXPECT_TRUE( *m.get( h4 ) == 4 );
+    m.clear();
+    EXPECT_FALSE( m.contains( h2 ) );
+    EXPECT_TRUE( m.get( h4 ) == nullptr );
+}
+
+TEST(GTpoDense, createRemoveNodesEdges)
+{
+    gtpo::GenGraph< gtpo::DenseConfig > g;
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    auto n3 = g.createNode();
+    EXPECT_TRUE( g.getNodeCount() == 3 );
+    EXPECT_TRUE( g.getRootNodeCount() == 3 );
+    auto e1 = g.createEdge( n1, n2 );
+    g.createEdge( n1, n2 );                 // Parallel edge
+    g.createEdge( n2, n3 );
+    EXPECT_TRUE( g.getEdgeCount() == 3 );
+    EXPECT_TRUE( g.getEdgeCount( n1, n2 ) == 2 );
+    EXPECT_TRUE( g.getRootNodeCount() == 1 );
+    EXPECT_TRUE( g.isRootNode( n1 ) );
+    EXPECT_FALSE( g.isRootNode( n2 ) );
+    EXPECT_TRUE( g.findEdge( n1, n2 ) == e1 );
+    EXPECT_TRUE( g.getNode( n1 )->getOutDegree() == 2 );
+    EXPECT_TRUE( g.getNode( n2 )->getInDegree() == 2 );
+
+    g.removeEdge( e1 );
+    EXPECT_FALSE( g.contains( e1 ) );
+    EXPECT_TRUE( g.hasEdge( n1, n2 ) );     // Parallel edge is still there
+    g.removeAllEdges( n1, n2 );
+    EXPECT_FALSE( g.hasEdge( n1, n2 ) );
+    EXPECT_TRUE( g.isRootNode( n2 ) );
+    EXPECT_TRUE( g.getRootNodeCount() == 2 );
+
+    g.removeNode( n2 );                     // Remove n2 and its n2->n3 out edge
+    EXPECT_FALSE( g.contains( n2 ) );
+    EXPECT_TRUE( g.getEdgeCount() == 0 );
+    EXPECT_TRUE( g.getNodeCount() == 2 );
+    EXPECT_TRUE( g.getRootNodeCount() == 2 );
+    EXPECT_TRUE( g.getNode( n3 )->getInDegree() == 0 );
+    EXPECT_THROW( g.createEdge( n1, n2 ), gtpo::bad_topology_error );
+    EXPECT_THROW( g.removeNode( n2 ), gtpo::bad_topology_error );
+    g.clear();
+    EXPECT_FALSE( g.contains( n1 ) );
+    EXPECT_TRUE( g.getRootNodeCount() == 0 );
+}
+
+TEST(GTpoDense, circuitRootNode)
+{
+    gtpo::GenGraph< gtpo::DenseConfig > g;
+    auto n1 = g.createNode();
+    auto e = g.createEdge( n1, n1 );        // Trivial circuit does not modify root node count
+    EXPECT_TRUE( g.getRootNodeCount() == 1 );
+    g.removeEdge( e );
+    EXPECT_TRUE( g.getRootNodeCount() == 1 );
+    EXPECT_TRUE( g.isRootNode( n1 ) );
+    g.createEdge( n1, n1 );
+    g.removeNode( n1 );                     // Circuit appears in both in and out edges
+    EXPECT_TRUE( g.getRootNodeCount() == 0 );
+    EXPECT_TRUE( g.getEdgeCount() == 0 );
+}
+
+TEST(GTpoDense, hyperEdgesAndGroups)
+{
+    gtpo::GenGraph< gtpo::DenseConfig > g;
+    auto n1 = g.createNode();
+    auto n2 = g.createNode();
+    auto n3 = g.createNode();
+    auto e1 = g.createEdge( n1, n2 );
+    auto he1 = g.createEdge( n3, e1 );
+    EXPECT_TRUE( g.hasEdge( n3, e1 ) );
+    EXPECT_TRUE( g.findEdge( n3, e1 ) == he1 );
+    EXPECT_TRUE( g.getEdge( e1 )->getInHDegree() == 1 );
+    EXPECT_TRUE( g.getRootNodeCount() == 2 );   // Hyper edge does not modify root nodes
+    g.removeEdge( e1 );                         // Removing e1 also remove he1
+    EXPECT_FALSE( g.contains( he1 ) );
+    EXPECT_TRUE( g.getNode( n3 )->getOutDegree() == 0 );
+
+    auto g1 = g.createGroup();
+    g.groupNode( g1, n1 );
+    g.groupNode( g1, n2 );
+    EXPECT_TRUE( g.hasGroup( g1 ) );
+    EXPECT_TRUE( g.getGroup( g1 )->getNodeCount() == 2 );
+    EXPECT_TRUE( g.getNode( n1 )->getGroup() == g1 );
+    g.removeNode( n1 );
+    EXPECT_TRUE( g.getGroup( g1 )->getNodeCount() == 1 );
+    g.removeGroup( g1 );
+    EXPECT_FALSE( g.hasGroup( g1 ) );
+    EXPECT_TRUE( g.getNode( n2 )->getGroup().isNull() );
+    EXPECT_TRUE( g.getNodeCount() == 2 );
+}
@@ -42,6 +42,7 @@
 // STD headers
 #include <memory>       // shared_ptr, weak_ptr
 #include <type_traits>  // integral_constant
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
@@ -258,6 +259,31 @@ public:
         emitItemCountChanged();
     }
 
+    /*! \brief Append all items in \c items range with a single model rows insertion (null items are ignored).
+     *
+     * Prefer appendRange() to successive append() calls for bulk insertion: views are notified once for the whole
+     * range and underlying container is grown once.
+     */
+    template < class Range >
+    void        appendRange( const Range& items ) {
+        int count = 0;
+        for ( const auto& item : items )
+            if ( !isNullPtr( item, typename ItemDispatcher<T>::type{} ) )
+                ++count;
+        if ( count == 0 )
+            return;
+        beginInsertRows( QModelIndex{}, _container.size( ), _container.size( ) + count - 1 );
+        _container.reserve( _container.size( ) + count );
+        for ( const auto& item : items ) {
+            if ( isNullPtr( item, typename ItemDispatcher<T>::type{} ) )
+                continue;
+            _container.append( item );
+            appendImpl( item, typename ItemDispatcher<T>::type{} );
+        }
+        endInsertRows( );
+        emitItemCountChanged();
+    }
+
     //! Shortcut to Container<T>::insert().
     void        insert( T item, int i ) {
         if ( i < 0 ||           // i == 0      === prepend
@@ -293,16 +319,20 @@ private:
     }
 
 public:
-    //! Shortcut to Container<T>::remove().
+    /*! \brief Remove first occurrence of \c item (a single model row is removed).
+     *
+     * Removing the last item is O(1) (no search, no move), prefer removing items from container end for bulk removal.
+     */
     void        remove( T item ) {
         if ( isNullPtr( item, typename ItemDispatcher<T>::type{} ) )
             return;
-        int itemIndex = _container.indexOf( item );
+        const int itemIndex = ( !_container.isEmpty() && _container.last() == item ) ? _container.size() - 1 :
+                                                                                     _container.indexOf( item );
         if ( itemIndex < 0 )
             return;
         beginRemoveRows( QModelIndex{}, itemIndex, itemIndex );
         removeImpl( item, typename ItemDispatcher<T>::type{} );
-        _container.removeAll( item );
+        _container.erase( _container.begin() + itemIndex );
         endRemoveRows( );
         emitItemCountChanged();
     }
@@ -351,6 +381,48 @@ public:
             remove( item );
     }
 
+    /*! \brief Remove all items matching predicate \c p in one compacting pass.
+     *
+     * Predicate is called exactly once per item. When matching items form a contiguous range, a single model
+     * rows removal is notified, otherwise the model is reset once.
+     */
+    template < class Predicate >
+    void        removeIf( Predicate p ) {
+        std::vector< char > matches( static_cast< std::size_t >( _container.size() ), 0 );
+        int first = -1;
+        int last = -1;
+        int count = 0;
+        for ( int i = 0; i < _container.size(); ++i ) {
+            if ( !p( _container.at( i ) ) )
+                continue;
+            matches[ static_cast< std::size_t >( i ) ] = 1;
+            if ( first < 0 )
+                first = i;
+            last = i;
+            ++count;
+        }
+        if ( count == 0 )
+            return;
+        const bool contiguous = ( last - first + 1 == count );
+        if ( contiguous )
+            beginRemoveRows( QModelIndex{}, first, last );
+        else
+            beginResetModel();
+        int kept = first;
+        for ( int i = first; i < _container.size(); ++i ) {
+            if ( matches[ static_cast< std::size_t >( i ) ] )
+                removeImpl( _container.at( i ), typename ItemDispatcher<T>::type{} );
+            else
+                _container[ kept++ ] = std::move( _container[ i ] );
+        }
+        _container.erase( _container.begin() + kept, _container.end() );
+        if ( contiguous )
+            endRemoveRows( );
+        else
+            endResetModel( );
+        emitItemCountChanged();
+    }
+
     inline  void    clear() noexcept {
         beginResetModel();
         _qObjectItemMap.clear();
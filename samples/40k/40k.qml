@@ -44,6 +44,8 @@ ApplicationWindow {
             anchors.fill: parent
             clip: true
             enableConnectorDropNode: true
+            virtualized: true       // Only nodes in view (plus a margin) are visible
+            batchedEdges: true      // Default edges are drawn with a single scene graph node
             Component.onCompleted: {
             }
             onNodeRightClicked: { }
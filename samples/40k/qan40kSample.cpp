@@ -36,12 +36,36 @@
 #include <QQuickItem>
 #include <QQuickStyle>
 #include <QElapsedTimer>
+#include <QQmlComponent>
+#include <QFile>
 
 // Topology sample headers
 #include "./qan40kSample.h"
 
 using namespace qan;
 
+//! Return the number of items in \c item subtree (including \c item).
+static int  countItems( const QQuickItem* item )
+{
+    if ( item == nullptr )
+        return 0;
+    int count = 1;
+    for ( const auto child : item->childItems() )
+        count += countItems( child );
+    return count;
+}
+
+//! Return process resident memory in kB (Linux only, 0 elsewhere).
+static qint64   residentMemory( )
+{
+    QFile status{ "/proc/self/status" };
+    if ( !status.open( QIODevice::ReadOnly | QIODevice::Text ) )
+        return 0;
+    for ( QByteArray line = status.readLine(); !line.isEmpty(); line = status.readLine() )
+        if ( line.startsWith( "VmRSS:" ) )
+            return line.mid( 6 ).trimmed().split( ' ' ).value( 0 ).toLongLong();
+    return 0;
+}
 
 int	main( int argc, char** argv )
 {
@@ -63,30 +87,52 @@ int	main( int argc, char** argv )
                 break;
         }
         qWarning() << "graph=" << graph.data();
+        // Compare default Node.qml delegate with C++ qan::FastNodeItem: run with and without --fast-nodes
+        const bool fastNodes = app.arguments().contains( "--fast-nodes" );
+        if ( graph && fastNodes ) {
+            auto fastNodeComponent = new QQmlComponent{ engine.data(), graph.data() };
+            fastNodeComponent->setData( "import QuickQanava 2.0 as Qan\nQan.FastNode { }", QUrl{} );
+            graph->registerNodeDelegate( "qan::Node", fastNodeComponent );
+        }
         //auto defaultNode = graph->get
         if ( graph ) {
-            unsigned int n = 0;
-            QElapsedTimer t; t.start();
             //QImage image(":/qt4logo4k.png");
             QImage image(":/qt4logo1k.png");
             qWarning() << "image: width=" << image.width() << "\theight=" << image.height();
             qWarning() << "rendering " << ( image.width() * image.height() ) << " nodes";
-            qreal defaultWidth{40.}, defaultHeight{30.};
-            qreal xSpacing{5.}, ySpacing{3.};
-            for ( int x = 0; x < image.width(); x++ ) {
-                qreal nodeX = static_cast<qreal>(x) * ( defaultWidth + xSpacing ) + xSpacing;
-                for ( int y = 0; y < image.height(); y++ ) {
-                    qreal nodeY = static_cast<qreal>(y) * ( defaultHeight + ySpacing ) + ySpacing;
-                    auto node = graph->insertNode();    // FIXME
-                    node->setX(nodeX);
-                    node->setY(nodeY);
+            // Nodes are inserted in per frame time slices, view stay interactive while nodes are created
+            const int nodeCount = image.width() * image.height();
+            auto n = std::make_shared< int >( 0 );
+            auto t = std::make_shared< QElapsedTimer >(); t->start();
+            const qint64 initialMemory = residentMemory();
+            graph->getScheduler()->schedule( [graph, image, n, nodeCount]() -> double {
+                if ( !graph || *n >= nodeCount )
+                    return 1.;
+                const qreal defaultWidth{40.}, defaultHeight{30.};
+                const qreal xSpacing{5.}, ySpacing{3.};
+                // Nodes are inserted in chunks with one model rows insertion per chunk
+                const int chunk = std::min( 256, nodeCount - *n );
+                QVector<QRectF> geometries; geometries.reserve( chunk );
+                for ( int c = *n; c < *n + chunk; ++c ) {
+                    const int x = c / image.height();
+                    const int y = c % image.height();
+                    geometries.append( QRectF{ static_cast<qreal>(x) * ( defaultWidth + xSpacing ) + xSpacing,
+                                               static_cast<qreal>(y) * ( defaultHeight + ySpacing ) + ySpacing,
+                                               defaultWidth, defaultHeight } );
+                }
+                const auto nodes = graph->insertNodes( chunk, nullptr, geometries );
+                for ( auto node : nodes )
                     node->setMinimumSize( {defaultWidth / 2., defaultHeight / 2.} );
-                    node->setWidth(defaultWidth);
-                    node->setHeight(defaultHeight);
-                    //node->setLabel( QString::number(n++) );
+                *n += chunk;
+                return static_cast< double >( *n ) / static_cast< double >( nodeCount );
+            }, "Inserting nodes" );
+            QObject::connect( graph->getScheduler(), &qan::WorkScheduler::jobFinished, [graph, t, initialMemory, fastNodes]( int ) {
+                qWarning() << ( fastNodes ? "qan::FastNodeItem" : "Node.qml" ) << "nodes creation took " << t->elapsed() << "ms";
+                if ( graph ) {
+                    qWarning() << "\titems: " << countItems( graph->getContainerItem() );
+                    qWarning() << "\tresident memory increase: " << ( residentMemory() - initialMemory ) << "kB";
                 }
-            }
-            qWarning() << "Node components creation took " << t.elapsed() << "ms";
+            } );
         }
     }
 
@@ -48,6 +48,10 @@
 #include "./qanStyle.h"
 #include "./qanStyleManager.h"
 #include "./qanProgressNotifier.h"
+#include "./qanWorkScheduler.h"
+#include "./qanDelegatePool.h"
+#include "./qanIncubation.h"
+#include "./qanFastNodeItem.h"
 #include "./fqlBottomRightResizer.h"
 
 struct QuickQanava {
@@ -56,6 +60,7 @@ struct QuickQanava {
         QuickContainers::initialize();
 
         qmlRegisterType< qan::Node >( "QuickQanava", 2, 0, "AbstractNode");
+        qmlRegisterType< qan::FastNodeItem >( "QuickQanava", 2, 0, "FastNode");
         qmlRegisterType< qan::Edge >( "QuickQanava", 2, 0, "Edge");
         qmlRegisterType< qan::Group >( "QuickQanava", 2, 0, "AbstractGroup");
         qmlRegisterType< qan::Graph >( "QuickQanava", 2, 0, "AbstractGraph");
@@ -68,6 +73,10 @@ struct QuickQanava {
         qmlRegisterType< qan::EdgeStyle >( "QuickQanava", 2, 0, "EdgeStyle");
         qmlRegisterType< qan::StyleManager >( "QuickQanava", 2, 0, "StyleManager");
         qmlRegisterType< qan::ProgressNotifier >( "QuickQanava", 2, 0, "ProgressNotifier");
+        qmlRegisterType< qan::WorkScheduler >( "QuickQanava", 2, 0, "WorkScheduler");
+        qmlRegisterType< qan::IncubationController >( "QuickQanava", 2, 0, "IncubationController");
+        qmlRegisterUncreatableType< qan::Incubation >( "QuickQanava", 2, 0, "Incubation", "Incubation is created by qan::Graph::insertNodesAsync()");
+        qmlRegisterUncreatableType< qan::DelegatePool >( "QuickQanava", 2, 0, "DelegatePool", "DelegatePool is owned by qan::Graph, use Graph.delegatePool");
         qmlRegisterType< fql::BottomRightResizer >( "QuickQanava", 2, 0, "BottomRightResizer" );
     }
 };
@@ -104,6 +104,30 @@ struct ContainerAccessors : public gtpo::ContainerAccessors
     struct remove< QSet<T> > {
         static void  from( QSet<T>& c, const T& t ) { c.remove( t ); }
     };
+
+    template < typename T >
+    struct append_range { };
+
+    template < typename T >
+    struct append_range< QVector<T> > {
+        template <typename R>
+        static void  into( QVector<T>& c, const R& r ) { for ( const auto& t : r ) c.append( t ); }
+    };
+
+    template < typename T >
+    struct append_range< qcm::ContainerModel<QVector, T> > {
+        template <typename R>
+        static void  into( qcm::ContainerModel<QVector, T>& c, const R& r ) { c.appendRange( r ); }    // Single model rows insertion
+    };
+
+    template < typename T >
+    struct remove_if { };
+
+    template < typename T >
+    struct remove_if< qcm::ContainerModel<QVector, T> > {
+        template <typename P>
+        static void  from( qcm::ContainerModel<QVector, T>& c, P p ) { c.removeIf( p ); }   // Single pass, one model notification
+    };
 };
 
 /*! \brief Exception thrown by QuickQanava to notify runtime error (nullptr assert, etc.).
@@ -0,0 +1,193 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanDelegatePool.cpp
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QDebug>
+
+// QuickQanava headers
+#include "./qanDelegatePool.h"
+
+namespace qan { // ::qan
+
+/* DelegatePool Object Management *///-----------------------------------------
+DelegatePool::DelegatePool( QObject* receiver, QObject* parent ) :
+    QObject{ parent },
+    _receiver{ receiver }
+{
+    _idleTimer.setSingleShot( true );
+    connect( &_idleTimer, &QTimer::timeout, this, &DelegatePool::onIdleTimeout );
+}
+
+DelegatePool::~DelegatePool()
+{
+    _idleTimer.stop();
+    for ( auto& bucket : _buckets )
+        for ( auto item : bucket.items )
+            delete item;
+    _buckets.clear();
+}
+//-----------------------------------------------------------------------------
+
+/* Pool Management *///--------------------------------------------------------
+QQuickItem* DelegatePool::acquire( QQmlComponent* component )
+{
+    if ( component == nullptr )
+        return nullptr;
+    auto bucket = _buckets.find( component );
+    if ( bucket == _buckets.end() )
+        return nullptr;
+    if ( bucket->component.isNull() ) {     // Component has been destroyed (and its address eventually reused)
+        clearBucket( *bucket );
+        _buckets.erase( bucket );
+        return nullptr;
+    }
+    if ( bucket->items.empty() )
+        return nullptr;
+    QQuickItem* item = bucket->items.back();
+    bucket->items.pop_back();
+    --_size;
+    ++_reusedCount;
+    emit sizeChanged();
+    return item;
+}
+
+bool    DelegatePool::canRelease( QQmlComponent* component ) const noexcept
+{
+    if ( component == nullptr ||
+         _capacity <= 0 )
+        return false;
+    const auto bucket = _buckets.constFind( component );
+    return bucket == _buckets.cend() ||
+           static_cast< int >( bucket->items.size() ) < _capacity;
+}
+
+bool    DelegatePool::release( QQuickItem* item, QQmlComponent* component )
+{
+    if ( item == nullptr ||
+         !canRelease( component ) )
+        return false;
+    auto bucket = _buckets.find( component );
+    if ( bucket == _buckets.end() )
+        bucket = _buckets.insert( component, Bucket{ QPointer< QQmlComponent >{ component }, {} } );
+    else if ( bucket->component.isNull() ) {
+        clearBucket( *bucket );
+        bucket->component = component;
+    }
+    if ( _receiver != nullptr )
+        QObject::disconnect( item, nullptr, _receiver, nullptr );
+    item->setVisible( false );
+    item->setParentItem( nullptr );
+    bucket->items.push_back( item );
+    ++_size;
+    emit sizeChanged();
+    if ( _idleInterval > 0 )
+        _idleTimer.start( _idleInterval );
+    return true;
+}
+
+int     DelegatePool::trim( int maxCount )
+{
+    int trimmed{ 0 };
+    for ( auto bucket = _buckets.begin(); bucket != _buckets.end() && trimmed < maxCount; ) {
+        while ( !bucket->items.empty() && trimmed < maxCount ) {
+            delete bucket->items.back();
+            bucket->items.pop_back();
+            ++trimmed;
+        }
+        if ( bucket->items.empty() )
+            bucket = _buckets.erase( bucket );
+        else
+            ++bucket;
+    }
+    if ( trimmed > 0 ) {
+        _size -= trimmed;
+        emit sizeChanged();
+    }
+    return trimmed;
+}
+
+void    DelegatePool::clear()
+{
+    _idleTimer.stop();
+    trim( _size );
+}
+
+void    DelegatePool::setCapacity( int capacity )
+{
+    capacity = qMax( 0, capacity );
+    if ( capacity == _capacity )
+        return;
+    _capacity = capacity;
+    int trimmed{ 0 };
+    for ( auto& bucket : _buckets ) {      // Destroy excess items
+        while ( static_cast< int >( bucket.items.size() ) > _capacity ) {
+            delete bucket.items.back();
+            bucket.items.pop_back();
+            ++trimmed;
+        }
+    }
+    if ( trimmed > 0 ) {
+        _size -= trimmed;
+        emit sizeChanged();
+    }
+    emit capacityChanged();
+}
+
+void    DelegatePool::setIdleInterval( int idleInterval )
+{
+    idleInterval = qMax( 0, idleInterval );
+    if ( idleInterval == _idleInterval )
+        return;
+    _idleInterval = idleInterval;
+    if ( _idleInterval == 0 )
+        _idleTimer.stop();
+    else if ( _size > 0 )
+        _idleTimer.start( _idleInterval );
+    emit idleIntervalChanged();
+}
+
+void    DelegatePool::onIdleTimeout()
+{
+    trim( _trimBatchSize );
+    if ( _size > 0 )
+        _idleTimer.start( 0 );     // Continue trimming on next event loop iteration
+}
+
+void    DelegatePool::clearBucket( Bucket& bucket )
+{
+    const int trimmed = static_cast< int >( bucket.items.size() );
+    for ( auto item : bucket.items )
+        delete item;
+    bucket.items.clear();
+    if ( trimmed > 0 ) {
+        _size -= trimmed;
+        emit sizeChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,147 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanDelegatePool.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef qanDelegatePool_h
+#define qanDelegatePool_h
+
+// QT headers
+#include <QObject>
+#include <QPointer>
+#include <QHash>
+#include <QTimer>
+#include <QQuickItem>
+#include <QQmlComponent>
+
+// STD headers
+#include <vector>
+
+namespace qan { // ::qan
+
+/*! \brief Per delegate component pool of reset node and edge items, used by qan::Graph to reuse removed primitives.
+ *
+ * Creating a node or edge from its QML delegate is the most expensive part of an insertion (component instantiation,
+ * bindings setup), a graph with high insertion/removal churn (streamed or filtered topology) recreate the same delegates
+ * over and over. When a primitive is removed from a qan::Graph, it is reset (see qan::Node::resetForRecycling() and
+ * qan::Edge::resetForRecycling()) and released in this pool instead of being destroyed, the next insertion with the
+ * same QQmlComponent acquire it back instead of creating a new item.
+ *
+ * At most getCapacity() items are pooled per component, items released in a full pool are destroyed. Once no item
+ * has been released for getIdleInterval() milliseconds the pool is trimmed (a few items per event loop iteration) to
+ * avoid keeping unused items alive forever.
+ *
+ * \note Pooled items are hidden and have no parent item, they are owned by the pool and destroyed with it.
+ * \nosubgrouping
+ */
+class DelegatePool : public QObject
+{
+    /*! \name DelegatePool Object Management *///------------------------------
+    //@{
+    Q_OBJECT
+public:
+    /*! \brief Construct an empty pool releasing items connected to \c receiver.
+     *
+     * Connections from released items to \c receiver (usually the owning graph) are disconnected on release.
+     */
+    explicit DelegatePool( QObject* receiver, QObject* parent = nullptr );
+    virtual ~DelegatePool();
+    DelegatePool( const DelegatePool& ) = delete;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Pool Management *///---------------------------------------------
+    //@{
+public:
+    //! Return a pooled item previously created from \c component, or nullptr if there is no such item.
+    QQuickItem*     acquire( QQmlComponent* component );
+    //! Return true if \c item created from \c component could be released in this pool (ie pool is not full for \c component).
+    bool            canRelease( QQmlComponent* component ) const noexcept;
+    /*! \brief Release an already reset \c item created from \c component in this pool.
+     *
+     * \return true if \c item has been pooled (and is then owned by the pool), false if it must be destroyed by caller.
+     */
+    bool            release( QQuickItem* item, QQmlComponent* component );
+    /*! \brief Destroy at most \c maxCount pooled items.
+     *
+     * \return number of destroyed items.
+     */
+    int             trim( int maxCount );
+    //! Destroy all pooled items.
+    Q_INVOKABLE void    clear();
+
+    //! Number of items actually pooled (for all components).
+    Q_PROPERTY( int size READ getSize NOTIFY sizeChanged FINAL )
+    inline int      getSize() const noexcept { return _size; }
+    //! Number of items reused from the pool since its creation.
+    Q_PROPERTY( int reusedCount READ getReusedCount NOTIFY sizeChanged FINAL )
+    inline int      getReusedCount() const noexcept { return _reusedCount; }
+signals:
+    void            sizeChanged();
+
+public:
+    //! Maximum number of pooled items per component (default to 1024, 0 disable pooling), excess items are destroyed.
+    Q_PROPERTY( int capacity READ getCapacity WRITE setCapacity NOTIFY capacityChanged FINAL )
+    void            setCapacity( int capacity );
+    inline int      getCapacity() const noexcept { return _capacity; }
+signals:
+    void            capacityChanged();
+
+public:
+    //! Delay in milliseconds without release after which pooled items are trimmed (default to 10000, 0 disable trimming).
+    Q_PROPERTY( int idleInterval READ getIdleInterval WRITE setIdleInterval NOTIFY idleIntervalChanged FINAL )
+    void            setIdleInterval( int idleInterval );
+    inline int      getIdleInterval() const noexcept { return _idleInterval; }
+signals:
+    void            idleIntervalChanged();
+
+private slots:
+    //! Trim a batch of items and reschedule until the pool is empty (unless items have been released meanwhile).
+    void            onIdleTimeout();
+
+private:
+    struct Bucket {
+        QPointer< QQmlComponent >   component{};
+        std::vector< QQuickItem* >  items{};
+    };
+    //! Destroy \c bucket items, they have been created by a destroyed component.
+    void            clearBucket( Bucket& bucket );
+
+    QObject*                            _receiver{ nullptr };
+    QHash< QQmlComponent*, Bucket >     _buckets;
+    int                                 _size{ 0 };
+    int                                 _reusedCount{ 0 };
+    int                                 _capacity{ 1024 };
+    int                                 _idleInterval{ 10000 };
+    //! Maximum number of items destroyed per idle timeout, avoid a long stall when a large pool is trimmed.
+    static constexpr int                _trimBatchSize{ 256 };
+    QTimer                              _idleTimer;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+#endif // qanDelegatePool_h
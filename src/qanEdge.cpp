@@ -40,7 +40,7 @@ namespace qan { // ::qan
 /* Edge Object Management *///-------------------------------------------------
 Edge::Edge( QQuickItem* parent ) :
     gtpo::GenEdge< qan::Config >{},
-    _defaultStyle{ new qan::EdgeStyle{ "", "qan::Edge" } }
+    _defaultStyle{ qan::EdgeStyle::getSharedDefault( QStringLiteral("qan::Edge") ) }
 {
     setStyle( _defaultStyle.data() );
     setParentItem( parent );
@@ -49,6 +49,34 @@ Edge::Edge( QQuickItem* parent ) :
     setAcceptedMouseButtons( Qt::RightButton | Qt::LeftButton );
     setAcceptDrops( true );
 }
+
+namespace { // ::anonymous
+
+//! Return true if \c edge has behaviours (GTpo edges do not support behaviours yet, behaviours state can't be reset).
+template < class E >
+auto    edgeHasBehaviours( const E& edge, int ) -> decltype( edge.hasBehaviours() ) { return edge.hasBehaviours(); }
+template < class E >
+bool    edgeHasBehaviours( const E&, long ) { return false; }
+
+} // ::anonymous
+
+bool    Edge::resetForRecycling()
+{
+    if ( edgeHasBehaviours( *this, 0 ) )
+        return false;
+    if ( _connectedSource != nullptr )
+        QObject::disconnect( _connectedSource.data(), nullptr, this, nullptr );
+    if ( _connectedDestination != nullptr )
+        QObject::disconnect( _connectedDestination.data(), nullptr, this, nullptr );
+    _connectedSource.clear();
+    _connectedDestination.clear();
+    setStyle( nullptr );        // Reset to shared default style
+    setLabel( QString{} );
+    setWeight( 1.0 );
+    setZ( 0. );
+    resetTopology();
+    return true;
+}
 //-----------------------------------------------------------------------------
 
 /* Edge Topology Management *///-----------------------------------------------
@@ -87,6 +115,7 @@ auto    Edge::setSourceItem( qan::Node* source ) -> void
         connect( source, srcZ.notifySignal(),       this, updateItemSlot );
         connect( source, srcWidth.notifySignal(),   this, updateItemSlot );
         connect( source, srcHeight.notifySignal(),  this, updateItemSlot );
+        _connectedSource = source;
         emit sourceItemChanged();
         if ( source->z() < z() )
             setZ( source->z() );
@@ -146,6 +175,7 @@ void    Edge::configureDestinationItem( QQuickItem* item )
     connect( item, dstZ.notifySignal(),       this, updateItemSlot );
     connect( item, dstWidth.notifySignal(),   this, updateItemSlot );
     connect( item, dstHeight.notifySignal(),  this, updateItemSlot );
+    _connectedDestination = item;
     if ( item->z() < z() )
         setZ( item->z() );
 }
@@ -328,22 +358,13 @@ void    Edge::setStyle( EdgeStyle* style )
         return;
     if ( style == nullptr )
         style = _defaultStyle.data();
-    if ( _style != nullptr && _style != _defaultStyle.data() )  // Every style that is non default is disconnect from this node
+    if ( _style != nullptr )    // Disconnect previous style (including shared default style) from this edge
         QObject::disconnect( _style, 0, this, 0 );
-    _style = style;
-    connect( _style, &QObject::destroyed, this, &Edge::styleDestroyed );    // Monitor eventual style destruction
-    connect( _style, &qan::EdgeStyle::styleModified, this, &Edge::updateItem );
+    _style = style;     // Note: Style destruction is handled in qan::StyleManager, see getStyle()
+    connect( style, &qan::EdgeStyle::styleModified, this, &Edge::updateItem );
     emit styleChanged( );
 }
 
-void    Edge::styleDestroyed( QObject* style )
-{
-    if ( style != nullptr && style != _defaultStyle.data() ) {
-        QObject::disconnect( style, 0, this, 0 );
-        setStyle( _defaultStyle.data() );   // Set default style when current style is destroyed
-    }
-}
-
 void    Edge::setLabel( const QString& label )
 {
     if ( label != _label ) {
@@ -30,6 +30,7 @@
 
 // Qt headers
 #include <QLineF>
+#include <QPointer>
 
 // Qanava headers
 #include "./qanConfig.h"
@@ -57,6 +58,13 @@ public:
     //! Return getDynamicClassName() (default to "qan::Edge").
     inline std::string  getClassName() const noexcept { return getDynamicClassName(); }
     virtual std::string getDynamicClassName() const noexcept { return "qan::Edge"; }
+
+    /*! \brief Reset this edge once it has been removed from its graph so that it could be reused (see qan::DelegatePool).
+     *
+     * Source and destination items are disconnected, style is reset to default style, label and weight are cleared and
+     * GTpo topology is reset. Return false if the edge can't be recycled (it has behaviours), it must then be destroyed.
+     */
+    virtual bool        resetForRecycling();
 public:
     // Qt property for gtpo::Edge serializable standard property.
     Q_PROPERTY( bool serializable READ getSerializable WRITE setSerializableObs NOTIFY serializableChanged FINAL )
@@ -99,6 +107,10 @@ signals:
 protected:
     //! Configure either a node or an edge (for hyper edges) item.
     void        configureDestinationItem( QQuickItem* item );
+private:
+    //! Items actually connected to this edge updateItemSlot(), kept to disconnect them even once topology has expired.
+    QPointer< QQuickItem >  _connectedSource;
+    QPointer< QQuickItem >  _connectedDestination;
     //@}
     //-------------------------------------------------------------------------
 
@@ -166,20 +178,22 @@ signals:
     /*! \name Style and Properties Management *///-----------------------------
     //@{
 private:
-    using SharedEdgeStyle = QSharedPointer< qan::EdgeStyle >;
+    using SharedEdgeStyle = qan::EdgeStyle::SharedEdgeStyle;
+    //! Default style shared with all edges (see qan::EdgeStyle::getSharedDefault()), kept alive while this edge exists.
     SharedEdgeStyle _defaultStyle;
 public:
-    //! Edge current style object (this property is never null, a default style is returned when no style has been manually set).
+    /*! \brief Edge current style object (this property is never null, a default style is returned when no style has been manually set).
+     *
+     * Edge does not monitor its style destruction: qan::StyleManager reset graph edges style before removing a style, and
+     * the shared default style is returned if style is destroyed elsewhere (styleChanged() is then not emitted).
+     */
     Q_PROPERTY( qan::EdgeStyle* style READ getStyle WRITE setStyle NOTIFY styleChanged FINAL )
     void            setStyle( EdgeStyle* style );
-    qan::EdgeStyle* getStyle( ) const { return _style; }
+    qan::EdgeStyle* getStyle( ) const { return _style ? _style.data() : _defaultStyle.data(); }
 private:
-    qan::EdgeStyle* _style{nullptr};
+    QPointer<qan::EdgeStyle>    _style;
 signals:
     void            styleChanged( );
-private slots:
-    //! Called when the style associed to this edge is destroyed.
-    void            styleDestroyed( QObject* style );
 
 public:
     Q_PROPERTY( QString label READ getLabel WRITE setLabel NOTIFY labelChanged FINAL )
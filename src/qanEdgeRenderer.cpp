@@ -0,0 +1,219 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeRenderer.cpp
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+
+// STD headers
+#include <cmath>        // std::sqrt
+#include <algorithm>    // std::fill std::min std::max
+
+// QuickQanava headers
+#include "./qanEdgeRenderer.h"
+#include "./qanGraph.h"
+#include "./qanEdge.h"
+
+namespace qan { // ::qan
+
+/* EdgeRenderer Object Management *///-----------------------------------------
+EdgeRenderer::EdgeRenderer( qan::Graph& graph, QQuickItem* parent ) :
+    QQuickItem{ parent },
+    gtpo::GraphBehaviour< qan::Config >{},
+    _graph( graph )
+{
+    setFlag( QQuickItem::ItemHasContents, true );
+    setZ( -1. );        // Draw edges under nodes
+    if ( parent != nullptr )
+        return;
+    setParentItem( graph.getContainerItem() );
+    connect( &graph, &qan::Graph::containerItemChanged, this, [this]() {
+        setParentItem( _graph.getContainerItem() );
+        _reallocate = true;     // Edges are mapped to renderer CCS, rewrite all slots
+        update();
+    } );
+}
+
+EdgeRenderer::~EdgeRenderer() { }   // Edges connections are closed with this QObject
+//-----------------------------------------------------------------------------
+
+/* Edges Management *///-------------------------------------------------------
+void    EdgeRenderer::insertEdge( qan::Edge* edge )
+{
+    if ( edge == nullptr ||
+         contains( edge ) )
+        return;
+    int slot = 0;
+    if ( !_freeSlots.empty() ) {
+        slot = _freeSlots.back();
+        _freeSlots.pop_back();
+        _slotEdges[ slot ] = edge;
+    } else {
+        slot = static_cast< int >( _slotEdges.size() );
+        _slotEdges.push_back( edge );
+        _dirtyFlags.push_back( 0 );
+        _reallocate = true;
+    }
+    _slots.emplace( edge, slot );
+    connect( edge, &qan::Edge::p2Changed,       this, &EdgeRenderer::onEdgeModified );  // Emitted after p1Changed()
+    connect( edge, &qan::Edge::styleChanged,    this, &EdgeRenderer::onEdgeModified );
+    connect( edge, &QQuickItem::visibleChanged, this, &EdgeRenderer::onEdgeModified );
+    markDirty( slot );
+}
+
+void    EdgeRenderer::removeEdge( qan::Edge* edge )
+{
+    const auto slot = _slots.find( edge );
+    if ( slot == _slots.end() )
+        return;
+    QObject::disconnect( edge, nullptr, this, nullptr );
+    _slotEdges[ slot->second ] = nullptr;
+    _freeSlots.push_back( slot->second );
+    markDirty( slot->second );     // Clear slot vertices
+    _slots.erase( slot );
+}
+
+void    EdgeRenderer::clearEdges( )
+{
+    for ( const auto& slot : _slots )
+        QObject::disconnect( slot.first, nullptr, this, nullptr );
+    _slots.clear();
+    _slotEdges.clear();
+    _freeSlots.clear();
+    _dirtySlots.clear();
+    _dirtyFlags.clear();
+    _reallocate = true;
+    update();
+}
+
+void    EdgeRenderer::edgeRemoved( WeakEdge& weakEdge ) noexcept
+{
+    if ( Behaviour::isEnabled() )
+        removeEdge( weakEdge.lock().get() );
+}
+
+void    EdgeRenderer::onEdgeModified( )
+{
+    const auto slot = _slots.find( static_cast< qan::Edge* >( sender() ) );
+    if ( slot != _slots.end() )
+        markDirty( slot->second );
+}
+
+void    EdgeRenderer::markDirty( int slot )
+{
+    if ( _dirtyFlags[ slot ] == 0 ) {
+        _dirtyFlags[ slot ] = 1;
+        _dirtySlots.push_back( slot );
+    }
+    update();
+}
+//-----------------------------------------------------------------------------
+
+/* Scene Graph Management *///-------------------------------------------------
+QSGNode*    EdgeRenderer::updatePaintNode( QSGNode* oldNode, UpdatePaintNodeData* )
+{
+    // Note: Called from the render thread while GUI thread is blocked, edges could be read safely
+    auto node = static_cast< QSGGeometryNode* >( oldNode );
+    if ( node == nullptr ) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{ QSGGeometry::defaultAttributes_ColoredPoint2D(), 0 };
+        geometry->setDrawingMode( QSGGeometry::DrawTriangles );
+        geometry->setVertexDataPattern( QSGGeometry::DynamicPattern );
+        node->setGeometry( geometry );
+        node->setFlag( QSGNode::OwnsGeometry );
+        node->setMaterial( new QSGVertexColorMaterial{} );
+        node->setFlag( QSGNode::OwnsMaterial );
+        _reallocate = true;
+    }
+    QSGGeometry* geometry = node->geometry();
+    if ( _reallocate ) {        // Slot count has changed: reallocate and rewrite all slots
+        geometry->allocate( static_cast< int >( _slotEdges.size() ) * vertexCountPerEdge );
+        auto vertices = geometry->vertexDataAsColoredPoint2D();
+        for ( std::size_t slot = 0; slot < _slotEdges.size(); ++slot )
+            writeEdge( _slotEdges[ slot ], vertices + slot * vertexCountPerEdge );
+        _reallocate = false;
+    } else {                    // Rewrite dirty slots in place
+        auto vertices = geometry->vertexDataAsColoredPoint2D();
+        for ( const auto slot : _dirtySlots )
+            writeEdge( _slotEdges[ slot ], vertices + slot * vertexCountPerEdge );
+    }
+    for ( const auto slot : _dirtySlots )
+        _dirtyFlags[ slot ] = 0;
+    _dirtySlots.clear();
+    node->markDirty( QSGNode::DirtyGeometry );
+    return node;
+}
+
+void    EdgeRenderer::writeEdge( qan::Edge* edge, QSGGeometry::ColoredPoint2D* vertices ) const
+{
+    if ( edge == nullptr ||
+         !edge->isVisible() ) {
+        std::fill( vertices, vertices + vertexCountPerEdge, QSGGeometry::ColoredPoint2D{ 0.f, 0.f, 0, 0, 0, 0 } );
+        return;
+    }
+    // Map edge points to renderer CCS (edges and renderer usually share graph container item as parent)
+    const bool sameParent = edge->parentItem() == parentItem();
+    const QPointF p1 = sameParent ? edge->position() + edge->getP1() : mapFromItem( edge, edge->getP1() );
+    const QPointF p2 = sameParent ? edge->position() + edge->getP2() : mapFromItem( edge, edge->getP2() );
+    const QPointF line = p2 - p1;
+    const qreal length = std::sqrt( line.x() * line.x() + line.y() * line.y() );
+    if ( length < 0.001 ) {
+        std::fill( vertices, vertices + vertexCountPerEdge, QSGGeometry::ColoredPoint2D{ 0.f, 0.f, 0, 0, 0, 0 } );
+        return;
+    }
+    const qan::EdgeStyle* style = edge->getStyle();
+    const qreal lineWidth = style != nullptr ? style->getLineWidth() : 2.;
+    const qreal capSize = std::max( style != nullptr ? style->getArrowSize() : 4., lineWidth / 2. );  // Like Qgl.Arrow
+    const QColor color = style != nullptr ? style->getLineColor() : QColor{ Qt::black };
+
+    const QPointF direction = line / length;
+    const QPointF normal{ -direction.y(), direction.x() };
+    const QPointF base = p2 - direction * std::min( capSize * 2., length );
+    const QPointF lineOffset = normal * ( lineWidth / 2. );
+    const QPointF capOffset = normal * capSize;
+
+    // Premultiplied color expected by QSGVertexColorMaterial
+    const auto alpha = static_cast< uchar >( color.alpha() );
+    const auto r = static_cast< uchar >( color.red() * color.alpha() / 255 );
+    const auto g = static_cast< uchar >( color.green() * color.alpha() / 255 );
+    const auto b = static_cast< uchar >( color.blue() * color.alpha() / 255 );
+    const auto set = [r, g, b, alpha]( QSGGeometry::ColoredPoint2D& vertex, const QPointF& p ) {
+        vertex.set( static_cast< float >( p.x() ), static_cast< float >( p.y() ), r, g, b, alpha );
+    };
+    set( vertices[ 0 ], p1 + lineOffset );      // Line quad
+    set( vertices[ 1 ], p1 - lineOffset );
+    set( vertices[ 2 ], base + lineOffset );
+    set( vertices[ 3 ], base + lineOffset );
+    set( vertices[ 4 ], p1 - lineOffset );
+    set( vertices[ 5 ], base - lineOffset );
+    set( vertices[ 6 ], p2 );                   // Arrow head
+    set( vertices[ 7 ], base + capOffset );
+    set( vertices[ 8 ], base - capOffset );
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,138 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeRenderer.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef qanEdgeRenderer_h
+#define qanEdgeRenderer_h
+
+// QT headers
+#include <QQuickItem>
+#include <QSGGeometry>
+
+// STD headers
+#include <memory>         // std::weak_ptr
+#include <vector>
+#include <unordered_map>
+
+// GTpo headers
+#include "../GTpo/src/gtpoBehaviour.h"
+
+// QuickQanava headers
+#include "./qanConfig.h"
+
+namespace qan { // ::qan
+
+class Graph;
+class Edge;
+
+/*! \brief Graph behaviour drawing all registered straight edges and their arrow heads with a single scene graph geometry node.
+ *
+ * Used by qan::Graph when \c batchedEdges is set: edges created with the default edge delegate are then lightweight
+ * qan::Edge items without content (they are still used for selection, hit testing and mouse events) and this item,
+ * a child of graph container item, own one QSGGeometryNode holding every edge line and arrow head in a single vertex
+ * buffer, rendered with one draw call.
+ *
+ * Each edge use a fixed slot of vertexCountPerEdge vertices (a line quad and an arrow head triangle), line width and
+ * arrow size are expanded on CPU and edge style line color is stored as a per vertex color attribute. When an edge
+ * endpoints, style or visibility change, only its slot is rewritten in place on next scene graph synchronization,
+ * removed edges slots are cleared and reused.
+ *
+ * Geometry node is not drawn by the software scene graph backend, qan::Graph then does not register any edge in the renderer.
+ *
+ * Renderer is owned by its graph behaviours (see qan::Graph::setBatchedEdges()), it must not be deleted manually.
+ * \nosubgrouping
+ */
+class EdgeRenderer : public QQuickItem,
+                     public gtpo::GraphBehaviour< qan::Config >
+{
+    Q_OBJECT
+    /*! \name EdgeRenderer Object Management *///-------------------------------
+    //@{
+public:
+    //! Renderer is a child of \c parent, or of \c graph container item (following its changes) when \c parent is nullptr.
+    explicit EdgeRenderer( qan::Graph& graph, QQuickItem* parent = nullptr );
+    virtual ~EdgeRenderer();
+    EdgeRenderer( const EdgeRenderer& ) = delete;
+
+    //! Note: Both QQuickItem and behaviour define isEnabled(), use Behaviour::isEnabled() for behaviour state.
+    using Behaviour = gtpo::GraphBehaviour< qan::Config >;
+    using WeakEdge  = std::weak_ptr< qan::Config::Edge >;
+
+    static constexpr gtpo::BehaviourEventMask   events = gtpo::BehaviourEvent::EdgeRemoved;
+    virtual auto    getEvents() const noexcept -> gtpo::BehaviourEventMask override { return events; }
+private:
+    qan::Graph&     _graph;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Edges Management *///--------------------------------------------
+    //@{
+public:
+    //! Number of vertices used to draw an edge (two triangles for the line, one for the arrow head).
+    static constexpr int    vertexCountPerEdge = 9;
+
+    //! Draw \c edge with this renderer (\c edge should not have any visual content).
+    void            insertEdge( qan::Edge* edge );
+    //! Stop drawing \c edge.
+    void            removeEdge( qan::Edge* edge );
+    //! Stop drawing all edges.
+    void            clearEdges( );
+    inline bool     contains( qan::Edge* edge ) const noexcept { return _slots.find( edge ) != _slots.cend(); }
+    inline std::size_t  getEdgeCount( ) const noexcept { return _slots.size(); }
+
+    virtual void    edgeRemoved( WeakEdge& weakEdge ) noexcept override;
+private slots:
+    //! Connected to registered edges geometry, style and visibility change notifications.
+    void            onEdgeModified( );
+private:
+    //! Mark edge \c slot for update on next scene graph synchronization.
+    void            markDirty( int slot );
+
+    std::unordered_map< qan::Edge*, int >   _slots;
+    //! Edge drawn in each vertex buffer slot (nullptr for a free slot).
+    std::vector< qan::Edge* >               _slotEdges;
+    std::vector< int >                      _freeSlots;
+    std::vector< int >                      _dirtySlots;
+    std::vector< char >                     _dirtyFlags;
+    //! Set when slot count has changed, the whole vertex buffer is then reallocated and rewritten.
+    bool                                    _reallocate{ true };
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Scene Graph Management *///--------------------------------------
+    //@{
+protected:
+    virtual QSGNode*    updatePaintNode( QSGNode* oldNode, UpdatePaintNodeData* ) override;
+private:
+    //! Write \c edge line and arrow head vertices (degenerated triangles for a nullptr or hidden edge).
+    void                writeEdge( qan::Edge* edge, QSGGeometry::ColoredPoint2D* vertices ) const;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+#endif // qanEdgeRenderer_h
@@ -0,0 +1,222 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanFastNodeItem.cpp
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QQuickWindow>
+#if QT_VERSION >= QT_VERSION_CHECK( 5, 8, 0 )
+#include <QSGRectangleNode>
+#else
+#include <QSGSimpleRectNode>
+#endif
+#include <QSGSimpleTextureNode>
+#include <QFontMetricsF>
+#include <QPainter>
+#include <QImage>
+
+// STD headers
+#include <cmath>        // std::ceil
+#include <algorithm>    // std::min
+
+// QuickQanava headers
+#include "./qanFastNodeItem.h"
+#include "./qanStyle.h"
+
+namespace qan { // ::qan
+
+#if QT_VERSION >= QT_VERSION_CHECK( 5, 8, 0 )
+using RectangleNode = QSGRectangleNode;
+#else
+using RectangleNode = QSGSimpleRectNode;    // Before Qt 5.8, OpenGL is the only scene graph backend
+#endif
+
+/* FastNodeItem Object Management *///-----------------------------------------
+FastNodeItem::FastNodeItem( QQuickItem* parent ) :
+    qan::Node{ parent }
+{
+    setFlag( QQuickItem::ItemHasContents, true );
+    setWidth( 110. );       // Same default size than Node.qml
+    setHeight( 50. );
+    connect( this, &qan::Node::styleChanged, this, &FastNodeItem::onStyleChanged );
+    connect( this, &qan::Node::labelChanged, this, &FastNodeItem::invalidateLabel );
+    onStyleChanged();       // Default style has been set in qan::Node constructor
+}
+
+FastNodeItem::~FastNodeItem( ) { }
+
+bool    FastNodeItem::resetForRecycling()
+{
+    if ( !qan::Node::resetForRecycling() )
+        return false;
+    setDrawLabel( true );
+    return true;
+}
+//-----------------------------------------------------------------------------
+
+/* Scene Graph Management *///-------------------------------------------------
+void    FastNodeItem::geometryChanged( const QRectF& newGeometry, const QRectF& oldGeometry )
+{
+    qan::Node::geometryChanged( newGeometry, oldGeometry );
+    if ( newGeometry.size() != oldGeometry.size() ) {
+        setDefaultBoundingShape();      // Done from RectNodeTemplate.qml for QML nodes
+        invalidateGeometry();
+        invalidateLabel();
+    }
+}
+
+void    FastNodeItem::onStyleChanged( )
+{
+    const auto style = getStyle();
+    if ( style != nullptr ) {       // Note: Previous style connections are closed in qan::Node::setStyle()
+        connect( style, &qan::NodeStyle::backColorChanged,      this, &FastNodeItem::invalidateGeometry );
+        connect( style, &qan::NodeStyle::borderColorChanged,    this, &FastNodeItem::invalidateGeometry );
+        connect( style, &qan::NodeStyle::borderWidthChanged,    this, &FastNodeItem::invalidateGeometry );
+        connect( style, &qan::NodeStyle::hasShadowChanged,      this, &FastNodeItem::invalidateGeometry );
+        connect( style, &qan::NodeStyle::shadowColorChanged,    this, &FastNodeItem::invalidateGeometry );
+        connect( style, &qan::NodeStyle::shadowOffsetChanged,   this, &FastNodeItem::invalidateGeometry );
+        connect( style, &qan::NodeStyle::labelFontChanged,      this, &FastNodeItem::invalidateLabel );
+    }
+    invalidateGeometry();
+    invalidateLabel();
+}
+
+void    FastNodeItem::setDrawLabel( bool drawLabel )
+{
+    if ( drawLabel == _drawLabel )
+        return;
+    _drawLabel = drawLabel;
+    invalidateLabel();
+}
+
+void    FastNodeItem::invalidateGeometry( )
+{
+    _geometryDirty = true;
+    update();
+}
+
+void    FastNodeItem::invalidateLabel( )
+{
+    _labelDirty = true;
+    update();
+}
+
+QSGNode*    FastNodeItem::updatePaintNode( QSGNode* oldNode, UpdatePaintNodeData* )
+{
+    // Root node children are shadow, border and background rectangles, then label texture node (drawn in children order)
+    auto root = oldNode;
+    if ( root == nullptr ) {
+        if ( window() == nullptr )
+            return nullptr;
+        root = new QSGNode{};
+        for ( int r = 0; r < rectangleCount; ++r )
+#if QT_VERSION >= QT_VERSION_CHECK( 5, 8, 0 )
+            root->appendChildNode( window()->createRectangleNode() );
+#else
+            root->appendChildNode( new QSGSimpleRectNode{} );
+#endif
+        _geometryDirty = true;
+        _labelDirty = true;
+    }
+    if ( _geometryDirty ) {
+        updateBackground( root );
+        _geometryDirty = false;
+    }
+    if ( _labelDirty ) {
+        updateLabelNode( root );
+        _labelDirty = false;
+    }
+    return root;
+}
+
+void    FastNodeItem::updateBackground( QSGNode* root ) const
+{
+    auto shadow = static_cast< RectangleNode* >( root->childAtIndex( 0 ) );
+    auto border = static_cast< RectangleNode* >( root->childAtIndex( 1 ) );
+    auto background = static_cast< RectangleNode* >( root->childAtIndex( 2 ) );
+    const QRectF rect{ 0., 0., width(), height() };
+    const qan::NodeStyle* style = getStyle();
+    if ( style == nullptr ) {
+        shadow->setRect( QRectF{} );
+        border->setRect( rect );
+        border->setColor( Qt::black );
+        background->setRect( rect.adjusted( 1., 1., -1., -1. ) );
+        background->setColor( Qt::white );
+        return;
+    }
+    const QSizeF& offset = style->getShadowOffset();
+    shadow->setRect( style->getHasShadow() ? rect.translated( offset.width(), offset.height() ) : QRectF{} );
+    shadow->setColor( style->getShadowColor() );
+    const qreal borderWidth = qBound( 0., style->getBorderWidth(), std::min( width(), height() ) / 2. );
+    border->setRect( rect );
+    border->setColor( style->getBorderColor() );
+    background->setRect( rect.adjusted( borderWidth, borderWidth, -borderWidth, -borderWidth ) );
+    background->setColor( style->getBackColor() );
+}
+
+void    FastNodeItem::updateLabelNode( QSGNode* root )
+{
+    auto labelNode = root->childCount() > rectangleCount ? static_cast< QSGSimpleTextureNode* >( root->lastChild() ) : nullptr;
+    const QString& label = getLabel();
+    const QRectF labelArea = QRectF{ 0., 0., width(), height() }.adjusted( 1., 1., -1., -1. );   // Like RectNodeTemplate.qml margins
+    const QFont font = getStyle() != nullptr ? getStyle()->getLabelFont() : QFont{};
+    constexpr int flags = Qt::AlignHCenter | Qt::AlignVCenter | Qt::TextWordWrap;
+    const QRectF labelRect = !_drawLabel || label.isEmpty() || labelArea.isEmpty() ? QRectF{} :
+                                 QFontMetricsF{ font }.boundingRect( labelArea, flags, label ).intersected( labelArea );
+    if ( labelRect.isEmpty() ||
+         window() == nullptr ) {
+        if ( labelNode != nullptr ) {
+            root->removeChildNode( labelNode );
+            delete labelNode;       // Own its texture
+        }
+        return;
+    }
+
+    // Rasterize only label bounding rect, texture is reused until label, font or node size change
+    const qreal dpr = window()->effectiveDevicePixelRatio();
+    QImage image{ static_cast< int >( std::ceil( labelRect.width() * dpr ) ),
+                  static_cast< int >( std::ceil( labelRect.height() * dpr ) ),
+                  QImage::Format_ARGB32_Premultiplied };
+    image.setDevicePixelRatio( dpr );
+    image.fill( Qt::transparent );
+    {
+        QPainter painter{ &image };
+        painter.setRenderHint( QPainter::TextAntialiasing );
+        painter.setFont( font );
+        painter.setPen( Qt::black );
+        painter.drawText( QRectF{ QPointF{ 0., 0. }, labelRect.size() }, flags, label );
+    }
+    if ( labelNode == nullptr ) {
+        labelNode = new QSGSimpleTextureNode{};
+        labelNode->setOwnsTexture( true );
+        labelNode->setFiltering( QSGTexture::Linear );
+        root->appendChildNode( labelNode );
+    }
+    labelNode->setTexture( window()->createTextureFromImage( image ) );
+    labelNode->setRect( labelRect );
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
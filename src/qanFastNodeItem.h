@@ -0,0 +1,108 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanFastNodeItem.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef qanFastNodeItem_h
+#define qanFastNodeItem_h
+
+// QT headers
+#include <QQuickItem>
+#include <QSGNode>
+
+// QuickQanava headers
+#include "./qanNode.h"
+
+namespace qan { // ::qan
+
+/*! \brief Node drawing its background, border, shadow and label from its qan::NodeStyle directly in C++, without any QML child item.
+ *
+ * Default Node.qml delegate build each node from several QML items (background rectangle, drop shadow, label layout and label editor),
+ * with their bindings. FastNodeItem is a qan::Node with a single scene graph subtree: three rectangle nodes for shadow, border and
+ * background (created with QQuickWindow::createRectangleNode() with Qt >= 5.8, so they are drawn by every scene graph backend), and one texture node for the label rasterized once and cached until the label, the style
+ * font or the node size change. Since it is a qan::Node, dragging, selection and resizing work unchanged.
+ *
+ * FastNodeItem is registered in QML as \c Qan.FastNode, use it for a node class by registering a delegate with
+ * qan::Graph::registerNodeDelegate():
+ * \code
+ * Component { id: fastNodeDelegate; Qan.FastNode { } }
+ * Component.onCompleted: graph.registerNodeDelegate( "qan::Node", fastNodeDelegate )
+ * \endcode
+ *
+ * \note Rounded corners and shadow blur are not drawn, label is not editable.
+ * \nosubgrouping
+ */
+class FastNodeItem : public qan::Node
+{
+    /*! \name FastNodeItem Object Management *///------------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit FastNodeItem( QQuickItem* parent = nullptr );
+    virtual ~FastNodeItem( );
+    FastNodeItem( const FastNodeItem& ) = delete;
+
+    //! Call base implementation and restore label drawing.
+    virtual bool        resetForRecycling() override;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Scene Graph Management *///--------------------------------------
+    //@{
+public:
+    //! Number of root node children used for shadow, border and background rectangles (label node is appended after them).
+    static constexpr int    rectangleCount = 3;
+    //! Call base implementation and invalidate cached geometry and label when node is resized.
+    virtual void    geometryChanged( const QRectF& newGeometry, const QRectF& oldGeometry ) override;
+protected:
+    virtual QSGNode*    updatePaintNode( QSGNode* oldNode, UpdatePaintNodeData* ) override;
+public:
+    //! Set to false when label is drawn elsewhere (see qan::LabelLayer), default to true.
+    void            setDrawLabel( bool drawLabel );
+    inline bool     getDrawLabel( ) const noexcept { return _drawLabel; }
+private:
+    bool            _drawLabel{ true };
+private slots:
+    //! Connect current style properties notifications, called when node style change.
+    void            onStyleChanged( );
+    void            invalidateGeometry( );
+    void            invalidateLabel( );
+private:
+    //! Update shadow, border and background rectangle nodes, children of \c root.
+    void            updateBackground( QSGNode* root ) const;
+    //! Rasterize label in a texture child node of \c root (remove child node if there is no label to draw).
+    void            updateLabelNode( QSGNode* root );
+
+    bool            _geometryDirty{ true };
+    bool            _labelDirty{ true };
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE( qan::FastNodeItem )
+
+#endif // qanFastNodeItem_h
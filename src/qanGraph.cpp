@@ -30,6 +30,12 @@
 #include <QVariant>
 #include <QQmlEngine>
 #include <QQmlComponent>
+#include <QQmlContext>
+#include <QQuickWindow>
+#if QT_VERSION >= QT_VERSION_CHECK( 5, 8, 0 )
+#include <QSGRendererInterface>
+#endif
+#include <QElapsedTimer>
 
 // GTpo headers
 #include "gtpoRandomGraph.h"
@@ -43,11 +49,13 @@ namespace qan { // ::qan
 /* Graph Object Management *///------------------------------------------------
 Graph::Graph( QQuickItem* parent ) noexcept :
     gtpo::GenGraph< qan::Config >( parent ),
+    _delegatePool{ std::make_shared< qan::DelegatePool >( this ) },
     _styleManager{ SharedStyleManager{ new qan::StyleManager( this ) } }
 {
     setContainerItem( this );
     setAntialiasing( true );
     setSmooth( true );
+    connect( this, &QQuickItem::windowChanged, this, &Graph::onWindowChanged );
 }
 
 void    Graph::qmlClearGraph( ) noexcept
@@ -57,11 +65,35 @@ void    Graph::qmlClearGraph( ) noexcept
 
 void    Graph::clear( ) noexcept
 {
-    _selectedNodes.clear();
+    abortIncubations();
+    clearSelection();   // Unselect nodes so that they could be recycled
+    _commandNodes.clear();
+    _commandEdges.clear();
+    _commandSweepThreshold = minimumCommandSweepThreshold;
+    unloadBehaviours();
     gtpo::GenGraph< qan::Config >::clear();
+    _virtualizer = nullptr;     // Deleted with graph behaviours
+    if ( _virtualized )
+        installVirtualizer();
+    _edgeRenderer = nullptr;    // Deleted with graph behaviours
+    if ( _batchedEdges )
+        installEdgeRenderer();
+    _labelLayer = nullptr;      // Deleted with graph behaviours
+    if ( _batchedLabels )
+        installLabelLayer();
     _styleManager->clear();
 }
 
+void    Graph::unloadBehaviours( ) noexcept
+{
+    if ( _virtualizer != nullptr )
+        _virtualizer->unload();     // Close nodes geometry connections while nodes are alive
+    if ( _edgeRenderer != nullptr )
+        _edgeRenderer->clearEdges();
+    if ( _labelLayer != nullptr )
+        _labelLayer->unload();      // Restore nodes label drawing while they are alive
+}
+
 void    Graph::addControlNode( qan::Node* node )
 {
     if ( node != nullptr )
@@ -283,6 +315,73 @@ auto    Graph::createFromDelegate( QQmlComponent* component ) -> QQuickItem*
     return item;
 }
 
+namespace { // ::anonymous
+
+//! Shared node/edge deleter recycling released primitives in their graph delegate pool.
+template < class Primitive >
+struct RecyclingDeleter {
+    std::weak_ptr< qan::DelegatePool >  pool;
+    QPointer< QQmlComponent >           component;
+    void operator()( Primitive* primitive ) const {
+        auto sharedPool = pool.lock();      // Expired while graph is destroyed
+        if ( sharedPool &&
+             !component.isNull() &&
+             sharedPool->canRelease( component.data() ) &&
+             primitive->resetForRecycling() &&
+             sharedPool->release( primitive, component.data() ) )
+            return;
+        delete primitive;
+    }
+};
+
+} // ::anonymous
+
+QQuickItem* Graph::acquireFromDelegate( QQmlComponent* component )
+{
+    QQuickItem* item = _delegatePool ? _delegatePool->acquire( component ) : nullptr;
+    if ( item == nullptr )
+        return createFromDelegate( component );
+    item->setVisible( true );
+    item->setParentItem( getContainerItem() );
+    return item;
+}
+
+Graph::SharedNode   Graph::makeSharedNode( qan::Node* node, QQmlComponent* component )
+{
+    return SharedNode{ node, RecyclingDeleter< qan::Node >{ _delegatePool, component } };
+}
+
+Graph::SharedEdge   Graph::makeSharedEdge( qan::Edge* edge, QQmlComponent* component )
+{
+    return SharedEdge{ edge, RecyclingDeleter< qan::Edge >{ _delegatePool, component } };
+}
+
+Graph::SharedNode   Graph::insertDelegateNode( qan::Node* node, QQmlComponent* component )
+{
+    if ( node == nullptr )
+        return SharedNode{};
+    node->setParentItem( getContainerItem() );
+    SharedNode sharedNode = makeSharedNode( node, component );
+    GTpoGraph::insertNode( sharedNode );
+    qan::NodeStyle* defaultStyle = qobject_cast< qan::NodeStyle* >( getStyleManager()->getDefaultNodeStyle( "qan::Node" ) );
+    if ( defaultStyle != nullptr )
+        node->setStyle( defaultStyle );
+    connect( node, &qan::Node::nodeClicked, this, &qan::Graph::nodeClicked );
+    connect( node, &qan::Node::nodeRightClicked, this, &qan::Graph::nodeRightClicked );
+    connect( node, &qan::Node::nodeDoubleClicked, this, &qan::Graph::nodeDoubleClicked );
+    return sharedNode;
+}
+
+void    Graph::abortIncubations( bool destroy )
+{
+    const auto incubations = findChildren< qan::Incubation* >( QString{}, Qt::FindDirectChildrenOnly );
+    for ( auto incubation : incubations ) {
+        incubation->abort();
+        if ( destroy )
+            delete incubation;
+    }
+}
+
 void Graph::setCppOwnership( QQuickItem* item )
 {
     if ( item == nullptr )
@@ -373,6 +472,31 @@ QQuickItem* Graph::createRectangle( QQuickItem* parent )
     }
     return nullptr;
 }
+
+QQuickItem* Graph::acquireSelectionItem( qan::Node& node )
+{
+    QQuickItem* selectionItem = nullptr;
+    if ( !_selectionItemPool.empty() ) {
+        selectionItem = _selectionItemPool.back().release();
+        _selectionItemPool.pop_back();
+        selectionItem->setParentItem( &node );
+    } else
+        selectionItem = createRectangle( &node );
+    return selectionItem;
+}
+
+void    Graph::releaseSelectionItem( QQuickItem* selectionItem )
+{
+    if ( selectionItem == nullptr )
+        return;
+    if ( _selectionItemPool.size() >= _selectionItemPoolCapacity ) {
+        delete selectionItem;
+        return;
+    }
+    selectionItem->setVisible( false );
+    selectionItem->setParentItem( nullptr );
+    _selectionItemPool.emplace_back( selectionItem );
+}
 //-----------------------------------------------------------------------------
 
 /* Graph Factories *///--------------------------------------------------------
@@ -386,10 +510,9 @@ qan::Node*  Graph::insertNode( QQmlComponent* nodeComponent )
         qDebug() << "qan::Graph::insertNode(): Error: Can't find a valid node delegate component.";
         return nullptr;
     }
-    qan::Node* node = static_cast< qan::Node* >( createFromDelegate( nodeComponent ) );
-    node->setSelectionItem( createRectangle( node ) );
+    qan::Node* node = static_cast< qan::Node* >( acquireFromDelegate( nodeComponent ) );
     if ( node != nullptr ) {
-        GTpoGraph::insertNode( std::shared_ptr<qan::Node>{node} );
+        GTpoGraph::insertNode( makeSharedNode( node, nodeComponent ) );
 
         connect( node, &qan::Node::nodeClicked, this, &qan::Graph::nodeClicked );
         connect( node, &qan::Node::nodeRightClicked, this, &qan::Graph::nodeRightClicked );
@@ -413,10 +536,9 @@ qan::Node*  Graph::insertNode( QString nodeClassName )
         nodeComponent = _nodeClassComponents.value( nodeClassName, nullptr );
     if ( nodeComponent == nullptr )
         return nullptr;
-    qan::Node* node = static_cast< qan::Node* >( createFromDelegate( nodeComponent ) );
-    node->setSelectionItem( createRectangle( node ) );
-    SharedNode sharedNode{ node };
+    qan::Node* node = static_cast< qan::Node* >( acquireFromDelegate( nodeComponent ) );
     if ( node != nullptr ) {
+        SharedNode sharedNode = makeSharedNode( node, nodeComponent );
         GTpoGraph::insertNode( sharedNode );
         qan::NodeStyle* defaultStyle = qobject_cast< qan::NodeStyle* >( getStyleManager()->getDefaultNodeStyle( nodeClassName ) );
         if ( defaultStyle != nullptr )
@@ -445,6 +567,160 @@ qan::Node*  Graph::insertNode( QVariant nodeArgument )
     return nullptr;
 }
 
+QVector< qan::Node* >   Graph::insertNodes( int count, QQmlComponent* nodeComponent, const QVector< QRectF >& geometries )
+{
+    QVector< qan::Node* > nodes;
+    if ( count <= 0 )
+        return nodes;
+    if ( nodeComponent == nullptr )
+        nodeComponent = _nodeClassComponents.value( "qan::Node", nullptr );
+    if ( nodeComponent == nullptr ) {
+        qDebug() << "qan::Graph::insertNodes(): Error: Can't find a valid node delegate component.";
+        return nodes;
+    }
+    if ( !nodeComponent->isReady() ) {
+        qDebug() << "qan::Graph::insertNodes(): Error: QML component is not ready:";
+        qDebug() << "\t" << nodeComponent->errorString();
+        return nodes;
+    }
+    QQmlContext* context = nodeComponent->creationContext() != nullptr ? nodeComponent->creationContext() : qmlContext( this );
+    if ( context == nullptr ) {
+        qDebug() << "qan::Graph::insertNodes(): Error: No valid QML context for node delegate creation.";
+        return nodes;
+    }
+    qan::NodeStyle* defaultStyle = qobject_cast< qan::NodeStyle* >( getStyleManager()->getDefaultNodeStyle( "qan::Node" ) );
+
+    std::vector< SharedNode > sharedNodes;
+    sharedNodes.reserve( static_cast< std::size_t >( count ) );
+    nodes.reserve( count );
+    for ( int n = 0; n < count; ++n ) {
+        qan::Node* node = _delegatePool ? qobject_cast< qan::Node* >( _delegatePool->acquire( nodeComponent ) ) : nullptr;
+        const bool recycled = node != nullptr;
+        if ( !recycled ) {
+            QObject* object = nodeComponent->beginCreate( context );
+            node = qobject_cast< qan::Node* >( object );
+            if ( node == nullptr ) {
+                qDebug() << "qan::Graph::insertNodes(): Error: Node delegate does not create a qan::Node:";
+                qDebug() << "\t" << nodeComponent->errorString();
+                if ( object != nullptr ) {
+                    nodeComponent->completeCreate();
+                    delete object;
+                }
+                break;
+            }
+            QQmlEngine::setObjectOwnership( node, QQmlEngine::CppOwnership );
+        }
+        if ( n < geometries.size() ) {      // Set geometry before component completion
+            const QRectF& geometry = geometries.at( n );
+            node->setX( geometry.x() );
+            node->setY( geometry.y() );
+            if ( geometry.width() > 0. )
+                node->setWidth( geometry.width() );
+            if ( geometry.height() > 0. )
+                node->setHeight( geometry.height() );
+        }
+        if ( !recycled )
+            nodeComponent->completeCreate();
+        node->setVisible( true );
+        node->setParentItem( getContainerItem() );
+        if ( defaultStyle != nullptr )
+            node->setStyle( defaultStyle );
+        connect( node, &qan::Node::nodeClicked, this, &qan::Graph::nodeClicked );
+        connect( node, &qan::Node::nodeRightClicked, this, &qan::Graph::nodeRightClicked );
+        connect( node, &qan::Node::nodeDoubleClicked, this, &qan::Graph::nodeDoubleClicked );
+        sharedNodes.emplace_back( makeSharedNode( node, nodeComponent ) );
+        nodes.append( node );
+    }
+    try {
+        GTpoGraph::insertNodes( sharedNodes );  // One model rows insertion, one behaviours notification
+    } catch ( gtpo::bad_topology_error e ) {
+        qDebug() << "qan::Graph::insertNodes(): Error: Topology error:" << e.what();
+        nodes.clear();      // Nodes are released (recycled or destroyed) with sharedNodes
+    }
+    return nodes;
+}
+
+namespace { // ::anonymous
+
+//! Convert a JS array of rect (Qt.rect()) or {x, y, width, height} objects to rectangles.
+QVector< QRectF >   toRects( const QVariantList& geometries )
+{
+    QVector< QRectF > rects;
+    rects.reserve( geometries.size() );
+    for ( const auto& geometry : geometries ) {
+        if ( geometry.canConvert< QRectF >() )
+            rects.append( geometry.toRectF() );
+        else {
+            const QVariantMap map = geometry.toMap();
+            rects.append( QRectF{ map.value( "x" ).toReal(), map.value( "y" ).toReal(),
+                                  map.value( "width" ).toReal(), map.value( "height" ).toReal() } );
+        }
+    }
+    return rects;
+}
+
+} // ::anonymous
+
+QVariantList    Graph::qmlInsertNodes( int count, QQmlComponent* nodeComponent, QVariantList geometries )
+{
+    QVariantList result;
+    const auto nodes = insertNodes( count, nodeComponent, toRects( geometries ) );
+    result.reserve( nodes.size() );
+    for ( const auto node : nodes )
+        result.append( QVariant::fromValue( node ) );
+    return result;
+}
+
+qan::Incubation*    Graph::insertNodesAsync( int count, QQmlComponent* nodeComponent, const QVector< QRectF >& geometries )
+{
+    if ( nodeComponent == nullptr )
+        nodeComponent = _nodeClassComponents.value( "qan::Node", nullptr );
+    if ( nodeComponent == nullptr ) {
+        qDebug() << "qan::Graph::insertNodesAsync(): Error: Can't find a valid node delegate component.";
+        return nullptr;
+    }
+    if ( !nodeComponent->isReady() ) {
+        qDebug() << "qan::Graph::insertNodesAsync(): Error: QML component is not ready:";
+        qDebug() << "\t" << nodeComponent->errorString();
+        return nullptr;
+    }
+    QQmlContext* context = nodeComponent->creationContext() != nullptr ? nodeComponent->creationContext() : qmlContext( this );
+    QQmlEngine* engine = nodeComponent->engine();
+    if ( context == nullptr || engine == nullptr ) {
+        qDebug() << "qan::Graph::insertNodesAsync(): Error: No valid QML context for node delegate creation.";
+        return nullptr;
+    }
+    if ( engine->incubationController() == nullptr )
+        engine->setIncubationController( &_incubationController );
+
+    auto incubation = new qan::Incubation{ *this, nodeComponent };
+    int n = 0;
+    for ( ; n < count && _delegatePool; ++n ) {    // Recycled delegates are complete, insert them synchronously
+        qan::Node* node = qobject_cast< qan::Node* >( _delegatePool->acquire( nodeComponent ) );
+        if ( node == nullptr )
+            break;
+        if ( n < geometries.size() ) {
+            const QRectF& geometry = geometries.at( n );
+            node->setX( geometry.x() );
+            node->setY( geometry.y() );
+            if ( geometry.width() > 0. )
+                node->setWidth( geometry.width() );
+            if ( geometry.height() > 0. )
+                node->setHeight( geometry.height() );
+        }
+        node->setVisible( true );
+        insertDelegateNode( node, nodeComponent );
+        incubation->add( node );
+    }
+    incubation->start( count - n, context, geometries );
+    return incubation;
+}
+
+qan::Incubation*    Graph::qmlInsertNodesAsync( int count, QQmlComponent* nodeComponent, QVariantList geometries )
+{
+    return insertNodesAsync( count, nodeComponent, toRects( geometries ) );
+}
+
 Graph::WeakNode    Graph::createNode( const std::string& className )
 {
     if ( className.size() == 0 )
@@ -461,6 +737,7 @@ void    Graph::removeNode( qan::Node* node )
     try {
         weakNode = WeakNode{ node->shared_from_this() };
     } catch ( std::bad_weak_ptr ) { return; }
+    removeFromSelection( *node );
     GTpoGraph::removeNode( weakNode );
 }
 
@@ -471,7 +748,7 @@ bool    Graph::isNode( QQuickItem* item ) const
     qan::Node* node = qobject_cast< qan::Node* >( item );
     if ( node == nullptr )
         return false;
-    return GTpoGraph::contains( node->shared_from_this() );
+    return GTpoGraph::contains( node );     // O(1) owner pointer lookup
 }
 
 bool    Graph::isEdge( QQuickItem* item ) const
@@ -481,7 +758,7 @@ bool    Graph::isEdge( QQuickItem* item ) const
     qan::Edge* edge = qobject_cast< qan::Edge* >( item );
     if ( edge == nullptr )
         return false;
-    return GTpoGraph::contains( edge->shared_from_this() );
+    return GTpoGraph::contains( edge );     // O(1) owner pointer lookup
 }
 
 bool    Graph::isHyperEdge( QQuickItem* item ) const
@@ -545,8 +822,10 @@ qan::Edge*  Graph::insertEdge( QString edgeClassName, qan::Node* source, qan::No
     if ( edgeComponent == nullptr )
         return nullptr;
     qan::Edge* edge = nullptr;
+    const bool batched = isBatchedEdgeComponent( edgeComponent );
     try {
-        edge = static_cast< qan::Edge* >( createFromDelegate( edgeComponent ) );
+        edge = batched ? createBatchedEdge() :
+                         static_cast< qan::Edge* >( acquireFromDelegate( edgeComponent ) );
         if ( edge != nullptr ) {
             edge->setSourceItem( source );
             edge->setDestinationItem( destination );
@@ -555,14 +834,15 @@ qan::Edge*  Graph::insertEdge( QString edgeClassName, qan::Node* source, qan::No
             WeakNode sharedDestination{ destination->shared_from_this() };
             edge->setSrc( sharedSource );
             edge->setDst( sharedDestination );
-            GTpoGraph::insertEdge( SharedEdge{edge} );  // Note: Do not use shared_from_this()
+            GTpoGraph::insertEdge( makeSharedEdge( edge, batched ? nullptr : edgeComponent ) );  // Note: Do not use shared_from_this()
 
             qan::EdgeStyle* defaultStyle = qobject_cast< qan::EdgeStyle* >( getStyleManager()->getDefaultEdgeStyle( "qan::Edge" ) );
             if ( defaultStyle != nullptr )
                 edge->setStyle( defaultStyle );
 
-            edge->setVisible( true );
             edge->updateItem();
+            if ( batched )
+                insertBatchedEdge( edge );
 
             connect( edge, SIGNAL( edgeClicked( QVariant, QVariant ) ), this, SIGNAL( edgeClicked( QVariant, QVariant ) ) );
             connect( edge, SIGNAL( edgeRightClicked( QVariant, QVariant ) ), this, SIGNAL( edgeRightClicked( QVariant, QVariant ) ) );
@@ -577,6 +857,96 @@ qan::Edge*  Graph::insertEdge( QString edgeClassName, qan::Node* source, qan::No
     return edge;
 }
 
+QVector< qan::Edge* >   Graph::insertEdges( const QVector< NodePair >& edges, QQmlComponent* edgeComponent )
+{
+    QVector< qan::Edge* > result;
+    if ( edges.isEmpty() )
+        return result;
+    if ( edgeComponent == nullptr )
+        edgeComponent = _edgeClassComponents.value( "qan::Edge", nullptr );
+    if ( edgeComponent == nullptr ) {
+        qDebug() << "qan::Graph::insertEdges(): Error: Can't find a valid edge delegate component.";
+        return result;
+    }
+    qan::EdgeStyle* defaultStyle = qobject_cast< qan::EdgeStyle* >( getStyleManager()->getDefaultEdgeStyle( "qan::Edge" ) );
+    const bool batched = isBatchedEdgeComponent( edgeComponent );
+
+    std::vector< SharedEdge > sharedEdges;
+    sharedEdges.reserve( static_cast< std::size_t >( edges.size() ) );
+    for ( const auto& pair : edges ) {
+        if ( pair.first == nullptr || pair.second == nullptr )
+            continue;
+        WeakNode sharedSource;
+        WeakNode sharedDestination;
+        try {
+            sharedSource = WeakNode{ pair.first->shared_from_this() };
+            sharedDestination = WeakNode{ pair.second->shared_from_this() };
+        } catch ( std::bad_weak_ptr ) { continue; }     // Node is not registered in a graph
+        qan::Edge* edge = batched ? createBatchedEdge() :
+                                    static_cast< qan::Edge* >( acquireFromDelegate( edgeComponent ) );
+        if ( edge == nullptr )
+            break;          // Component errors have already been reported
+        edge->setSourceItem( pair.first );
+        edge->setDestinationItem( pair.second );
+        edge->setSrc( sharedSource );
+        edge->setDst( sharedDestination );
+        sharedEdges.emplace_back( makeSharedEdge( edge, batched ? nullptr : edgeComponent ) );
+    }
+    try {
+        GTpoGraph::insertEdges( sharedEdges );  // One model rows insertion, one behaviours notification
+    } catch ( gtpo::bad_topology_error e ) {
+        qDebug() << "qan::Graph::insertEdges(): Error: Topology error:" << e.what();
+        return result;      // Edges are released (recycled or destroyed) with sharedEdges
+    }
+    result.reserve( static_cast< int >( sharedEdges.size() ) );
+    for ( const auto& sharedEdge : sharedEdges ) {
+        qan::Edge* edge = sharedEdge.get();
+        if ( defaultStyle != nullptr )
+            edge->setStyle( defaultStyle );
+        edge->updateItem();
+        if ( batched )
+            insertBatchedEdge( edge );
+        connect( edge, SIGNAL( edgeClicked( QVariant, QVariant ) ), this, SIGNAL( edgeClicked( QVariant, QVariant ) ) );
+        connect( edge, SIGNAL( edgeRightClicked( QVariant, QVariant ) ), this, SIGNAL( edgeRightClicked( QVariant, QVariant ) ) );
+        connect( edge, SIGNAL( edgeDoubleClicked( QVariant, QVariant ) ), this, SIGNAL( edgeDoubleClicked( QVariant, QVariant ) ) );
+        result.append( edge );
+    }
+    return result;
+}
+
+QVariantList    Graph::qmlInsertEdges( QVariantList edges, QQmlComponent* edgeComponent )
+{
+    QVector< NodePair > pairs;
+    pairs.reserve( edges.size() );
+    for ( const auto& edge : qAsConst( edges ) ) {
+        QVariant source, destination;
+        if ( edge.type() == QVariant::List ) {
+            const QVariantList list = edge.toList();
+            if ( list.size() == 2 ) {
+                source = list.at( 0 );
+                destination = list.at( 1 );
+            }
+        } else {
+            const QVariantMap map = edge.toMap();
+            source = map.value( "source" );
+            destination = map.value( "destination" );
+        }
+        auto sourceNode = qobject_cast< qan::Node* >( source.value< QObject* >() );
+        auto destinationNode = qobject_cast< qan::Node* >( destination.value< QObject* >() );
+        if ( sourceNode == nullptr || destinationNode == nullptr ) {
+            qDebug() << "qan::Graph::qmlInsertEdges(): Warning: Ignoring invalid edge description " << edge;
+            continue;
+        }
+        pairs.append( NodePair{ sourceNode, destinationNode } );
+    }
+    QVariantList result;
+    const auto createdEdges = insertEdges( pairs, edgeComponent );
+    result.reserve( createdEdges.size() );
+    for ( const auto edge : createdEdges )
+        result.append( QVariant::fromValue( edge ) );
+    return result;
+}
+
 qan::Edge*  Graph::insertEdge( QString edgeClassName, qan::Node* source, qan::Edge* destination, QQmlComponent* edgeComponent )
 {
     if ( source == nullptr ||
@@ -588,8 +958,10 @@ qan::Edge*  Graph::insertEdge( QString edgeClassName, qan::Node* source, qan::Ed
     if ( edgeComponent == nullptr )
         return nullptr;
     qan::Edge* edge = nullptr;
+    const bool batched = isBatchedEdgeComponent( edgeComponent );
     try {
-        edge = static_cast< qan::Edge* >( createFromDelegate( edgeComponent ) );
+        edge = batched ? createBatchedEdge() :
+                         static_cast< qan::Edge* >( acquireFromDelegate( edgeComponent ) );
         if ( edge != nullptr ) {
             edge->setSourceItem( source );
             edge->setDestinationEdge( destination );
@@ -598,13 +970,14 @@ qan::Edge*  Graph::insertEdge( QString edgeClassName, qan::Node* source, qan::Ed
             WeakEdge destinationPtr{ destination->shared_from_this() };
             edge->setSrc( sourcePtr );
             edge->setHDst( destinationPtr );
-            GTpoGraph::insertEdge( SharedEdge{edge} );  // Note: Do not use shared_from_this()
+            GTpoGraph::insertEdge( makeSharedEdge( edge, batched ? nullptr : edgeComponent ) );  // Note: Do not use shared_from_this()
 
             qan::EdgeStyle* defaultStyle = qobject_cast< qan::EdgeStyle* >( getStyleManager()->getDefaultEdgeStyle( "qan::Edge" ) );
             if ( defaultStyle != nullptr )
                 edge->setStyle( defaultStyle );
-            edge->setVisible( true );
             edge->updateItem();
+            if ( batched )
+                insertBatchedEdge( edge );
             connect( edge, SIGNAL( edgeClicked( QVariant, QVariant ) ),
                      this, SIGNAL( edgeClicked( QVariant, QVariant ) ) );
             connect( edge, SIGNAL( edgeRightClicked( QVariant, QVariant ) ),
@@ -737,13 +1110,367 @@ void    Graph::removeGroup( qan::Group* group )
 
 bool    Graph::hasGroup( qan::Group* group ) const
 {
-    if ( group == nullptr )
-        return false;
-    WeakGroup weakGroup;
-    try {
-        weakGroup = WeakGroup{ group->shared_from_this() };
-    } catch ( std::bad_weak_ptr ) { return false; }
-    return gtpo::GenGraph< qan::Config >::hasGroup( weakGroup );
+    return gtpo::GenGraph< qan::Config >::hasGroup( group );   // O(1) owner pointer lookup, nullptr return false
+}
+//-----------------------------------------------------------------------------
+
+/* Asynchronous Graph Commands *///--------------------------------------------
+bool    Graph::pushCommand( qan::GraphCommand command, int timeout )
+{
+    const bool queued = timeout > 0 ? _commandQueue.push( std::move( command ), std::chrono::milliseconds{ timeout } ) :
+                                      _commandQueue.tryPush( std::move( command ) );
+    // Post at most one frame request until queued commands are applied
+    if ( queued && !_commandsScheduled.exchange( true, std::memory_order_acq_rel ) )
+        QMetaObject::invokeMethod( this, "scheduleCommands", Qt::QueuedConnection );
+    return queued;
+}
+
+int     Graph::applyCommands( int budget )
+{
+    if ( budget < 0 )
+        budget = _commandBudget;
+    _commandsScheduled.store( false, std::memory_order_release );   // Commands pushed from now will request a new frame
+    QElapsedTimer timer;
+    timer.start();
+    int applied = 0;
+    _commandQueue.popMany( [this, budget, &timer, &applied]( qan::GraphCommand&& command ) {
+        if ( applyCommand( command ) )
+            ++applied;
+        else
+            _invalidCommandCount.fetch_add( 1, std::memory_order_relaxed );
+        return budget == 0 || timer.elapsed() < budget;
+    } );
+    _appliedCommandCount.fetch_add( static_cast< quint64 >( applied ), std::memory_order_relaxed );
+    if ( _commandNodes.size() + _commandEdges.size() > _commandSweepThreshold )
+        sweepCommandPrimitives();
+    if ( !_commandQueue.isEmpty() )     // Budget exhausted, continue on next frame
+        scheduleCommands();
+    if ( applied > 0 )
+        emit commandsApplied( applied );
+    return applied;
+}
+
+void    Graph::setCommandBudget( int commandBudget )
+{
+    if ( commandBudget < 0 ) {
+        qDebug() << "qan::Graph::setCommandBudget(): Error: Command budget must be positive or 0.";
+        return;
+    }
+    if ( commandBudget != _commandBudget ) {
+        _commandBudget = commandBudget;
+        emit commandBudgetChanged();
+    }
+}
+
+void    Graph::sweepCommandPrimitives( )
+{
+    // Primitives removed outside of remove commands (or by graph clear) leave expired entries
+    const auto eraseExpired = []( auto& primitives ) {
+        for ( auto primitive = primitives.begin(); primitive != primitives.end(); )
+            primitive = primitive->second.expired() ? primitives.erase( primitive ) : std::next( primitive );
+    };
+    eraseExpired( _commandNodes );
+    eraseExpired( _commandEdges );
+    // Sweep again once ID maps have doubled: sweep cost is amortized over inserted primitives
+    const std::size_t threshold = 2 * ( _commandNodes.size() + _commandEdges.size() );
+    _commandSweepThreshold = threshold > minimumCommandSweepThreshold ? threshold : minimumCommandSweepThreshold;
+}
+
+qan::Node*  Graph::getCommandNode( quint64 id ) const
+{
+    const auto node = _commandNodes.find( id );
+    return node != _commandNodes.cend() ? node->second.lock().get() : nullptr;
+}
+
+qan::Edge*  Graph::getCommandEdge( quint64 id ) const
+{
+    const auto edge = _commandEdges.find( id );
+    return edge != _commandEdges.cend() ? edge->second.lock().get() : nullptr;
+}
+
+bool    Graph::applyCommand( qan::GraphCommand& command )
+{
+    using Type = qan::GraphCommand::Type;
+    switch ( command.type ) {
+    case Type::InsertNode: {
+        if ( getCommandNode( command.id ) != nullptr )
+            return false;       // ID already in use
+        qan::Node* node = insertNode( static_cast< QQmlComponent* >( nullptr ) );
+        if ( node == nullptr )
+            return false;
+        node->setX( command.x );
+        node->setY( command.y );
+        if ( !command.label.isEmpty() )
+            node->setLabel( command.label );
+        _commandNodes[ command.id ] = node->shared_from_this();
+        return true;
+    }
+    case Type::RemoveNode: {
+        qan::Node* node = getCommandNode( command.id );
+        _commandNodes.erase( command.id );
+        if ( node == nullptr )
+            return false;
+        removeNode( node );
+        return true;
+    }
+    case Type::MoveNode: {
+        qan::Node* node = getCommandNode( command.id );
+        if ( node == nullptr )
+            return false;
+        node->setX( command.x );
+        node->setY( command.y );
+        return true;
+    }
+    case Type::InsertEdge: {
+        qan::Node* source = getCommandNode( command.source );
+        qan::Node* destination = getCommandNode( command.destination );
+        if ( source == nullptr || destination == nullptr || getCommandEdge( command.id ) != nullptr )
+            return false;
+        qan::Edge* edge = insertEdge( source, destination );
+        if ( edge == nullptr )
+            return false;
+        _commandEdges[ command.id ] = edge->shared_from_this();
+        return true;
+    }
+    case Type::RemoveEdge: {
+        qan::Edge* edge = getCommandEdge( command.id );
+        _commandEdges.erase( command.id );
+        if ( edge == nullptr )
+            return false;
+        removeEdge( edge );
+        return true;
+    }
+    case Type::Undefined:
+    default: break;
+    }
+    return false;
+}
+
+void    Graph::onWindowChanged( QQuickWindow* window )
+{
+    _scheduler.setWindow( window );
+    _incubationController.setWindow( window );
+    disconnect( _frameConnection );
+    if ( window != nullptr ) {
+        // QQuickWindow::afterAnimating() is emitted in GUI thread once per frame, before scene graph synchronization
+        _frameConnection = connect( window, &QQuickWindow::afterAnimating, this, [this]() {
+            if ( !_commandQueue.isEmpty() )
+                applyCommands();
+        } );
+        scheduleCommands();
+    }
+}
+
+void    Graph::scheduleCommands( )
+{
+    if ( _commandQueue.isEmpty() )
+        _commandsScheduled.store( false, std::memory_order_release );
+    else if ( window() != nullptr )
+        window()->update();
+}
+//-----------------------------------------------------------------------------
+
+/* Asynchronous Graph Jobs *///------------------------------------------------
+int     Graph::clearAsync( qan::ProgressNotifier* progress )
+{
+    clearSelection();   // Unselect nodes so that they could be recycled
+    const int primitiveCount = static_cast< int >( getEdgeCount() ) + getNodeCount();
+    QPointer< qan::Graph > graph{ this };
+    return _scheduler.schedule( [graph, primitiveCount]() -> double {
+        if ( !graph )
+            return 1.;
+        // Edges then nodes are popped from their container end: removing the last model row is O(1) and a node
+        // without edges is removed in O(1), so a chunk cost does not depend on remaining graph size.
+        try {
+            for ( int e = 0; e < 64 && graph->getEdgeCount() > 0; ++e )
+                graph->GTpoGraph::removeEdge( graph->getEdges().at( static_cast< int >( graph->getEdgeCount() ) - 1 ) );
+            for ( int n = 0; n < 16 && graph->getEdgeCount() == 0 && graph->getNodeCount() > 0; ++n )
+                graph->removeNode( graph->getNodes().at( graph->getNodeCount() - 1 ).get() );   // Also unselect nodes selected while clearing
+        } catch ( gtpo::bad_topology_error e ) {
+            qDebug() << "qan::Graph::clearAsync(): Error: Topology error:" << e.what();
+            graph->clear();
+            return 1.;
+        }
+        const int remaining = static_cast< int >( graph->getEdgeCount() ) + graph->getNodeCount();
+        if ( remaining > 0 )
+            return 1. - static_cast< double >( remaining ) / static_cast< double >( std::max( 1, primitiveCount ) );
+        graph->clear();     // Remaining groups and styles
+        return 1.;
+    }, QStringLiteral( "Clearing graph" ), progress );
+}
+
+int     Graph::initializeRandomAsync( int nodeCount,
+                                      int   minOutNodes, int maxOutNodes,
+                                      qreal minWidth, qreal maxWidth,
+                                      qreal minHeight, qreal maxHeight,
+                                      QRectF br, qan::ProgressNotifier* progress )
+{
+    if ( !br.isValid() || br.isEmpty() )
+        return -1;
+    RandomGraph::RandomConfig rc;
+    rc.nodeClassName = "qan::Node";
+    rc.edgeClassName = "qan::Edge";
+    rc.nodeCount = nodeCount;
+    rc.outNodeRng = std::make_pair( minOutNodes, maxOutNodes );
+    rc.widthRng = std::make_pair( minWidth, maxWidth );
+    rc.heightRng = std::make_pair( minHeight, maxHeight );
+    rc.xRng = std::make_pair( 0, br.width() - maxWidth );
+    rc.yRng = std::make_pair( 0, br.height() - maxHeight );
+    using Generator = RandomGraph::Generator< qan::Graph >;
+    auto generator = std::make_shared< Generator >( *this, rc );
+    QPointer< qan::Graph > graph{ this };
+    return _scheduler.schedule( [graph, generator]() -> double {
+        if ( !graph )
+            return 1.;
+        const int firstNode = graph->getNodeCount();
+        generator->step( 8 );
+        qreal nz = static_cast< qreal >( firstNode );
+        for ( int n = firstNode; n < graph->getNodeCount(); ++n )
+            graph->getNodes().at( n )->setZ( nz++ );     // Force valid z values
+        return generator->getProgress();
+    }, QStringLiteral( "Generating random graph" ), progress );
+}
+//-----------------------------------------------------------------------------
+
+/* Viewport Virtualization *///------------------------------------------------
+void    Graph::setVirtualized( bool virtualized )
+{
+    if ( virtualized == _virtualized )
+        return;
+    _virtualized = virtualized;
+    if ( _virtualized )
+        installVirtualizer();
+    else if ( _virtualizer != nullptr )
+        _virtualizer->unload();     // Show all hidden primitives, virtualizer stay registered but disabled
+    emit virtualizedChanged();
+}
+
+void    Graph::setVirtualizationMargin( qreal virtualizationMargin )
+{
+    if ( qFuzzyCompare( 1. + virtualizationMargin, 1. + _virtualizationMargin ) )
+        return;
+    _virtualizationMargin = virtualizationMargin;
+    if ( _virtualizer != nullptr )
+        _virtualizer->setMargin( virtualizationMargin );
+    emit virtualizationMarginChanged();
+}
+
+void    Graph::setViewportRect( const QRectF& viewportRect )
+{
+    _viewportRect = viewportRect;
+    if ( _virtualizer != nullptr )
+        _virtualizer->setViewport( viewportRect );
+    if ( _labelLayer != nullptr )
+        _labelLayer->setViewport( viewportRect );
+}
+
+void    Graph::installVirtualizer( )
+{
+    if ( _virtualizer == nullptr ) {
+        auto virtualizer = std::make_unique< qan::ViewportVirtualizer >( *this );
+        _virtualizer = virtualizer.get();
+        addBehaviour( std::move( virtualizer ) );
+    }
+    _virtualizer->setMargin( _virtualizationMargin );
+    _virtualizer->setViewport( _viewportRect );
+    _virtualizer->load();
+}
+//-----------------------------------------------------------------------------
+
+/* Batched Edges Rendering *///------------------------------------------------
+void    Graph::setBatchedEdges( bool batchedEdges )
+{
+    if ( batchedEdges == _batchedEdges )
+        return;
+    _batchedEdges = batchedEdges;
+    if ( _batchedEdges )
+        installEdgeRenderer();  // Note: When disabled, renderer keep drawing already batched edges
+    emit batchedEdgesChanged();
+}
+
+void    Graph::installEdgeRenderer( )
+{
+    if ( _edgeRenderer != nullptr )
+        return;
+    auto edgeRenderer = std::make_unique< qan::EdgeRenderer >( *this );
+    _edgeRenderer = edgeRenderer.get();
+    addBehaviour( std::move( edgeRenderer ) );
+}
+
+bool    Graph::isBatchedEdgeComponent( const QQmlComponent* edgeComponent ) const
+{
+    return _batchedEdges &&
+           _edgeRenderer != nullptr &&
+           edgeComponent != nullptr &&
+           edgeComponent == _edgeClassComponents.value( "qan::Edge", nullptr ) &&
+           !isSoftwareRenderer();
+}
+
+bool    Graph::isSoftwareRenderer( ) const
+{
+    // Software adaptation (used for offscreen and headless rendering) does not draw edge renderer custom geometry
+#if QT_VERSION >= QT_VERSION_CHECK( 5, 8, 0 )
+    if ( window() != nullptr ) {
+        const QSGRendererInterface* rendererInterface = window()->rendererInterface();     // Note: graphicsApi() is available before window is exposed
+        return rendererInterface != nullptr &&
+               rendererInterface->graphicsApi() == QSGRendererInterface::Software;
+    }
+    return QQuickWindow::sceneGraphBackend() == QStringLiteral( "software" );
+#else
+    return false;       // Before Qt 5.8, OpenGL is the only scene graph backend
+#endif
+}
+
+qan::Edge*  Graph::createBatchedEdge( )
+{
+    auto edge = new qan::Edge{};
+    QQmlEngine::setObjectOwnership( edge, QQmlEngine::CppOwnership );
+    edge->setParentItem( getContainerItem() );
+    return edge;
+}
+
+void    Graph::insertBatchedEdge( qan::Edge* edge )
+{
+    _edgeRenderer->insertEdge( edge );
+    if ( _labelLayer != nullptr &&
+         _labelLayer->isLoaded() )
+        _labelLayer->insertEdge( edge );
+}
+//-----------------------------------------------------------------------------
+
+/* Batched Labels Rendering *///-----------------------------------------------
+void    Graph::setBatchedLabels( bool batchedLabels )
+{
+    if ( batchedLabels == _batchedLabels )
+        return;
+    _batchedLabels = batchedLabels;
+    if ( _batchedLabels )
+        installLabelLayer();
+    else if ( _labelLayer != nullptr )
+        _labelLayer->unload();  // Nodes draw their own label again, layer stay registered but disabled
+    emit batchedLabelsChanged();
+}
+
+void    Graph::setLabelMinimumPixelSize( qreal labelMinimumPixelSize )
+{
+    if ( qFuzzyCompare( 1. + labelMinimumPixelSize, 1. + _labelMinimumPixelSize ) )
+        return;
+    _labelMinimumPixelSize = labelMinimumPixelSize;
+    if ( _labelLayer != nullptr )
+        _labelLayer->setMinimumPixelSize( labelMinimumPixelSize );
+    emit labelMinimumPixelSizeChanged();
+}
+
+void    Graph::installLabelLayer( )
+{
+    if ( _labelLayer == nullptr ) {
+        auto labelLayer = std::make_unique< qan::LabelLayer >( *this );
+        _labelLayer = labelLayer.get();
+        addBehaviour( std::move( labelLayer ) );
+    }
+    _labelLayer->setMinimumPixelSize( _labelMinimumPixelSize );
+    _labelLayer->setViewport( _viewportRect );
+    _labelLayer->load();
 }
 //-----------------------------------------------------------------------------
 
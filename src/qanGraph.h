@@ -38,12 +38,23 @@
 #include "./qanNode.h"
 #include "./qanGroup.h"
 #include "./qanNavigable.h"
+#include "./qanGraphCommand.h"
+#include "./qanWorkScheduler.h"
+#include "./qanViewportVirtualizer.h"
+#include "./qanEdgeRenderer.h"
+#include "./qanLabelLayer.h"
+#include "./qanDelegatePool.h"
+#include "./qanIncubation.h"
 
 // QT headers
 #include <QQuickItem>
 #include <QSharedPointer>
 #include <QAbstractListModel>
 
+// STD headers
+#include <atomic>
+#include <unordered_map>
+
 namespace qan { // ::qan
 
 /*! \brief FIXME.
@@ -65,8 +76,15 @@ public:
      * Graph is a factory for inserted nodes and edges, even if they have been created trought
      * QML delegates, they will be destroyed with the graph they have been created in.
      */
-    virtual ~Graph( ) { clearDelegates(); }
+    virtual ~Graph( ) { abortIncubations( true ); unloadBehaviours(); clearDelegates(); }
     Graph( const Graph& ) = delete;
+private:
+    /*! \brief Disconnect virtualizer, edge renderer and label layer from graph primitives.
+     *
+     * Must be called before GTpo destroy nodes and edges: primitives are destroyed without removal notifications
+     * and QQuickItem destructor emit geometry/parent signals that behaviours would otherwise process.
+     */
+    void            unloadBehaviours( ) noexcept;
 public:
     /*! \brief Clear this graph topology and styles.
      *
@@ -261,6 +279,21 @@ protected:
 private:
     std::unique_ptr< QQmlComponent >   _rectangleComponent{nullptr};
 
+public:
+    /*! \brief Get a selection hilight item for \c node from graph selection items pool (a new rectangle is created when pool is empty).
+     *
+     * Selection items are created lazily when a node is selected and returned to the pool with releaseSelectionItem()
+     * when it is deselected: unselected nodes have no selection item. Internally used by qan::Node::setSelected().
+     * \return a selection item reparented to \c node (caller get ownership), or nullptr on error.
+     */
+    QQuickItem*     acquireSelectionItem( qan::Node& node );
+    //! Hide \c selectionItem and return it to graph selection items pool (graph get ownership), item is destroyed if the pool is full.
+    void            releaseSelectionItem( QQuickItem* selectionItem );
+private:
+    //! Maximum number of unused selection items kept for reuse.
+    static constexpr std::size_t    _selectionItemPoolCapacity{ 32 };
+    std::vector< std::unique_ptr< QQuickItem > >    _selectionItemPool;
+
 private:
     QMap< QString, QQmlComponent* > _nodeClassComponents;
     QMap< QString, QQmlComponent* > _edgeClassComponents;
@@ -299,6 +332,38 @@ public:
      */
     Q_INVOKABLE qan::Node*  insertNode( QVariant nodeArguments );
 
+    /*! \brief Insert \c count nodes created with \c nodeComponent (default to "qan::Node" delegate) and return them.
+     *
+     * Bulk version of insertNode(): delegate component and default node style are resolved once, node \c geometries
+     * (x, y, width, height) are set before delegate creation is completed, and nodes are inserted in graph with
+     * a single nodes model rows insertion and a single batch of behaviours notifications. When \c geometries is
+     * smaller than \c count, remaining nodes keep their delegate geometry.
+     *
+     * \note graph keep ownership of returned nodes.
+     */
+    QVector< qan::Node* >   insertNodes( int count, QQmlComponent* nodeComponent = nullptr,
+                                         const QVector< QRectF >& geometries = QVector< QRectF >{} );
+
+    /*! \brief QML interface for insertNodes(): \c geometries is a JS array of rect (Qt.rect()) or {x, y, width, height} objects.
+     *
+     * \return a JS array of created nodes.
+     */
+    Q_INVOKABLE QVariantList    qmlInsertNodes( int count, QQmlComponent* nodeComponent = nullptr, QVariantList geometries = QVariantList{} );
+
+    /*! \brief Asynchronous variant of insertNodes(): node delegates are incubated in per frame time slices.
+     *
+     * Each node is inserted in graph topology as soon as its delegate root object is created, and shown once its
+     * delegate is complete (nodes recycled from delegatePool are inserted immediately). Returned qan::Incubation
+     * report progress and notify when every delegate is ready, see qan::Incubation::then().
+     *
+     * \return nullptr if \c nodeComponent is invalid.
+     */
+    qan::Incubation*        insertNodesAsync( int count, QQmlComponent* nodeComponent = nullptr,
+                                              const QVector< QRectF >& geometries = QVector< QRectF >{} );
+
+    //! QML interface for insertNodesAsync(), \c geometries use qmlInsertNodes() format.
+    Q_INVOKABLE qan::Incubation*    qmlInsertNodesAsync( int count, QQmlComponent* nodeComponent = nullptr, QVariantList geometries = QVariantList{} );
+
     //! Defined for serialization support, do not use.
     virtual WeakNode        createNode( const std::string& className ) override;
 
@@ -356,6 +421,24 @@ public:
     //! Shortcut to gtpo::GenGraph<>::insertEdge().
     qan::Edge*              insertEdge( QString edgeClassName, qan::Node* source, qan::Edge* destination, QQmlComponent* edgeComponent = nullptr );
 
+    using NodePair          = QPair< qan::Node*, qan::Node* >;
+
+    /*! \brief Insert one edge created with \c edgeComponent (default to "qan::Edge" delegate) per source/destination node pair in \c edges.
+     *
+     * Bulk version of insertEdge(): edge delegate and default edge style are resolved once, edges are inserted in graph
+     * with a single edges model rows insertion and a single batch of behaviours notifications. Pairs with a nullptr
+     * node or a node not registered in this graph are ignored.
+     *
+     * \note graph keep ownership of returned edges.
+     */
+    QVector< qan::Edge* >   insertEdges( const QVector< NodePair >& edges, QQmlComponent* edgeComponent = nullptr );
+
+    /*! \brief QML interface for insertEdges(): \c edges is a JS array of [source, destination] arrays or {source, destination} objects.
+     *
+     * \return a JS array of created edges.
+     */
+    Q_INVOKABLE QVariantList    qmlInsertEdges( QVariantList edges, QQmlComponent* edgeComponent = nullptr );
+
     //! Defined for serialization support, do not use, not part of public API.
     virtual WeakEdge        createEdge( const std::string& className, WeakNode source, WeakNode destination  ) override;
 
@@ -426,6 +509,261 @@ signals:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Asynchronous Graph Commands *///---------------------------------
+    //@{
+public:
+    /*! \brief Push a mutation \c command from any thread, command will be applied in GUI thread on next frame.
+     *
+     * Command queue is bounded: when it is full, pushCommand() wait at most \c timeout milliseconds for
+     * the GUI thread to make room (default to 0, ie never block) before dropping \c command. Return value
+     * should be used for backpressure: a producer receiving false should slow down or retry later.
+     *
+     * \note Thread safe, lock free when \c timeout is 0.
+     * \return true if \c command has been queued, false if it has been dropped.
+     */
+    bool                pushCommand( qan::GraphCommand command, int timeout = 0 );
+
+    /*! \brief Apply queued commands in GUI thread for at most \c budget milliseconds.
+     *
+     * Called automatically once per frame (after animations) with \c commandBudget budget, a negative
+     * \c budget use \c commandBudget, 0 apply all queued commands. Commands referencing unknown IDs are
+     * dropped.
+     * \return number of successfully applied commands.
+     */
+    Q_INVOKABLE int     applyCommands( int budget = -1 );
+
+    //! Maximum time spent applying queued commands per frame in milliseconds (default to 4, 0 to apply all commands).
+    Q_PROPERTY( int commandBudget READ getCommandBudget WRITE setCommandBudget NOTIFY commandBudgetChanged FINAL )
+    void                setCommandBudget( int commandBudget );
+    inline int          getCommandBudget( ) const noexcept { return _commandBudget; }
+signals:
+    void                commandBudgetChanged( );
+    //! Emitted after queued commands have been applied, \c count is the number of applied commands.
+    void                commandsApplied( int count );
+
+public:
+    //! Number of commands successfully queued with pushCommand() (thread safe).
+    Q_INVOKABLE quint64 getQueuedCommandCount( ) const { return _commandQueue.getPushedCount(); }
+    //! Number of commands successfully applied (thread safe).
+    Q_INVOKABLE quint64 getAppliedCommandCount( ) const { return _appliedCommandCount.load( std::memory_order_relaxed ); }
+    //! Number of commands dropped, either because command queue was full or because they referenced an unknown ID (thread safe).
+    Q_INVOKABLE quint64 getDroppedCommandCount( ) const { return _commandQueue.getRejectedCount() + _invalidCommandCount.load( std::memory_order_relaxed ); }
+    //! Approximate number of commands waiting in queue (thread safe).
+    Q_INVOKABLE int     getPendingCommandCount( ) const { return static_cast< int >( _commandQueue.getSize() ); }
+
+    //! Return node created by a command with ID \c id (or \c nullptr if no such node exists, GUI thread only).
+    qan::Node*          getCommandNode( quint64 id ) const;
+    //! Return edge created by a command with ID \c id (or \c nullptr if no such edge exists, GUI thread only).
+    qan::Edge*          getCommandEdge( quint64 id ) const;
+
+private:
+    //! Apply \c command, return false if command is invalid (unknown ID or failed creation).
+    bool                applyCommand( qan::GraphCommand& command );
+    //! Connect to current window frame notifications for per frame command application.
+    void                onWindowChanged( QQuickWindow* window );
+    //! Schedule a new frame in GUI thread if commands are waiting in queue.
+    Q_INVOKABLE void    scheduleCommands( );
+    //! Erase command IDs of nodes and edges that no longer exist (called from applyCommands() when ID maps grow).
+    void                sweepCommandPrimitives( );
+
+private:
+    qan::GraphCommandQueue  _commandQueue{ 16384 };
+    int                     _commandBudget{ 4 };
+    std::atomic< bool >     _commandsScheduled{ false };
+    std::atomic< quint64 >  _appliedCommandCount{ 0 };
+    std::atomic< quint64 >  _invalidCommandCount{ 0 };
+    QMetaObject::Connection _frameConnection;
+    std::unordered_map< quint64, WeakNode > _commandNodes;
+    std::unordered_map< quint64, WeakEdge > _commandEdges;
+    static constexpr std::size_t    minimumCommandSweepThreshold = 1024;
+    //! Command IDs are swept for expired primitives when their count exceed this threshold.
+    std::size_t             _commandSweepThreshold{ minimumCommandSweepThreshold };
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Asynchronous Graph Jobs *///-------------------------------------
+    //@{
+public:
+    /*! \brief Cooperative scheduler running long graph operations in per frame time slices in GUI thread.
+     *
+     * Scheduler is driven by this graph window frames, use it to schedule custom long operations (for example bulk
+     * node insertion) without freezing rendering, async methods of this graph (clearAsync(), initializeRandomAsync())
+     * and qan::ProtoSerializer::loadGraphFromAsync() schedule their jobs on it.
+     */
+    Q_PROPERTY( qan::WorkScheduler* scheduler READ getScheduler CONSTANT FINAL )
+    inline qan::WorkScheduler*  getScheduler( ) noexcept { return &_scheduler; }
+private:
+    qan::WorkScheduler  _scheduler;
+
+public:
+    //! Incubation controller used for asynchronous delegate creation (installed on graph QML engine if it has none).
+    Q_PROPERTY( qan::IncubationController* incubationController READ getIncubationController CONSTANT FINAL )
+    inline qan::IncubationController*   getIncubationController( ) noexcept { return &_incubationController; }
+private:
+    friend qan::Incubation;
+    //! Insert an incubated \c node created from \c component in graph and return its owning pointer.
+    SharedNode                  insertDelegateNode( qan::Node* node, QQmlComponent* component );
+    //! Complete pending incubations synchronously without notifying them, and destroy them if \c destroy is true.
+    void                        abortIncubations( bool destroy = false );
+    qan::IncubationController   _incubationController;
+
+public:
+    /*! \brief Asynchronous variant of clear(): remove nodes in per frame time slices, then clear graph.
+     *
+     * \return scheduled job ID (see qan::WorkScheduler::jobFinished()).
+     */
+    Q_INVOKABLE int     clearAsync( qan::ProgressNotifier* progress = nullptr );
+
+    //! Asynchronous variant of initializeRandom(), return scheduled job ID.
+    Q_INVOKABLE int     initializeRandomAsync( int   nodeCount,
+                                               int   minOutNodes, int maxOutNodes,
+                                               qreal minWidth, qreal maxWidth,
+                                               qreal minHeight, qreal maxHeight,
+                                               QRectF br, qan::ProgressNotifier* progress = nullptr );
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Viewport Virtualization *///-------------------------------------
+    //@{
+public:
+    /*! \brief Hide nodes and edges outside of graph view viewport (default to false).
+     *
+     * When enabled, a qan::ViewportVirtualizer index nodes and edges bounding boxes, qan::GraphView report its viewport
+     * with setViewportRect() on pan, zoom and resize, and only primitives intersecting viewport expanded with
+     * \c virtualizationMargin are visible. Graph topology is not modified: hidden primitives stay in graph and models.
+     */
+    Q_PROPERTY( bool virtualized READ getVirtualized WRITE setVirtualized NOTIFY virtualizedChanged FINAL )
+    void            setVirtualized( bool virtualized );
+    inline bool     getVirtualized( ) const noexcept { return _virtualized; }
+private:
+    bool            _virtualized{ false };
+signals:
+    void            virtualizedChanged( );
+
+public:
+    //! Margin added around viewport (in container item coordinates) before primitives are hidden, default to 200.
+    Q_PROPERTY( qreal virtualizationMargin READ getVirtualizationMargin WRITE setVirtualizationMargin NOTIFY virtualizationMarginChanged FINAL )
+    void            setVirtualizationMargin( qreal virtualizationMargin );
+    inline qreal    getVirtualizationMargin( ) const noexcept { return _virtualizationMargin; }
+private:
+    qreal           _virtualizationMargin{ 200. };
+signals:
+    void            virtualizationMarginChanged( );
+
+public:
+    //! Set graph visible area in container item coordinates (usually called from qan::GraphView).
+    void                    setViewportRect( const QRectF& viewportRect );
+    inline const QRectF&    getViewportRect( ) const noexcept { return _viewportRect; }
+    //! Return graph viewport virtualizer (nullptr until virtualized has been set to true).
+    inline qan::ViewportVirtualizer*    getVirtualizer( ) noexcept { return _virtualizer; }
+private:
+    //! Create and register virtualizer behaviour if it does not exist, then load it.
+    void                        installVirtualizer( );
+    QRectF                      _viewportRect;
+    //! Owned by graph behaviours, deleted when graph is cleared.
+    qan::ViewportVirtualizer*   _virtualizer{ nullptr };
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Batched Edges Rendering *///------------------------------------
+    //@{
+public:
+    /*! \brief Draw edges using default "qan::Edge" delegate with a single scene graph node (default to false).
+     *
+     * When enabled, edges inserted with the default edge delegate are created as qan::Edge items without visual content
+     * (still used for selection and mouse events) and drawn by a qan::EdgeRenderer as straight lines with arrow heads
+     * colored with their style \c lineColor. Edges with a custom delegate are not affected. Changing this property
+     * only affect edges inserted afterwards.
+     *
+     * \note With the software scene graph backend (offscreen or headless rendering), which does not draw custom geometry,
+     * edges are still created from their delegate: the property is then ignored.
+     */
+    Q_PROPERTY( bool batchedEdges READ getBatchedEdges WRITE setBatchedEdges NOTIFY batchedEdgesChanged FINAL )
+    void            setBatchedEdges( bool batchedEdges );
+    inline bool     getBatchedEdges( ) const noexcept { return _batchedEdges; }
+private:
+    bool            _batchedEdges{ false };
+signals:
+    void            batchedEdgesChanged( );
+
+public:
+    //! Return graph edge renderer (nullptr until batchedEdges has been set to true).
+    inline qan::EdgeRenderer*   getEdgeRenderer( ) noexcept { return _edgeRenderer; }
+private:
+    //! Create and register edge renderer behaviour if it does not exist.
+    void                installEdgeRenderer( );
+    //! Return true if edges created with \c edgeComponent should be drawn by edge renderer.
+    bool                isBatchedEdgeComponent( const QQmlComponent* edgeComponent ) const;
+    //! Return true if graph window (or default window when graph has no window) use the software scene graph backend.
+    bool                isSoftwareRenderer( ) const;
+    //! Create an edge without visual content for edge renderer.
+    qan::Edge*          createBatchedEdge( );
+    //! Register inserted batched \c edge in edge renderer (and label layer if any).
+    void                insertBatchedEdge( qan::Edge* edge );
+    //! Owned by graph behaviours, deleted when graph is cleared.
+    qan::EdgeRenderer*  _edgeRenderer{ nullptr };
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Batched Labels Rendering *///-----------------------------------
+    //@{
+public:
+    /*! \brief Draw qan::FastNodeItem nodes and batched edges labels with a single qan::LabelLayer (default to false).
+     *
+     * When enabled, each distinct label is laid out and rasterized once in a shared glyph atlas and all visible labels are
+     * drawn in one batch, labels smaller than \c labelMinimumPixelSize on screen are culled.
+     */
+    Q_PROPERTY( bool batchedLabels READ getBatchedLabels WRITE setBatchedLabels NOTIFY batchedLabelsChanged FINAL )
+    void            setBatchedLabels( bool batchedLabels );
+    inline bool     getBatchedLabels( ) const noexcept { return _batchedLabels; }
+private:
+    bool            _batchedLabels{ false };
+signals:
+    void            batchedLabelsChanged( );
+
+public:
+    //! Labels with an on screen height (in pixels) below this size are not drawn by label layer, default to 5.
+    Q_PROPERTY( qreal labelMinimumPixelSize READ getLabelMinimumPixelSize WRITE setLabelMinimumPixelSize NOTIFY labelMinimumPixelSizeChanged FINAL )
+    void            setLabelMinimumPixelSize( qreal labelMinimumPixelSize );
+    inline qreal    getLabelMinimumPixelSize( ) const noexcept { return _labelMinimumPixelSize; }
+private:
+    qreal           _labelMinimumPixelSize{ 5. };
+signals:
+    void            labelMinimumPixelSizeChanged( );
+
+public:
+    //! Return graph label layer (nullptr until batchedLabels has been set to true).
+    inline qan::LabelLayer* getLabelLayer( ) noexcept { return _labelLayer; }
+private:
+    //! Create and register label layer behaviour if it does not exist, then load it.
+    void                installLabelLayer( );
+    //! Owned by graph behaviours, deleted when graph is cleared.
+    qan::LabelLayer*    _labelLayer{ nullptr };
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Delegate Pooling *///-------------------------------------------
+    //@{
+public:
+    /*! \brief Pool of removed nodes and edges reused by insertNode(), insertEdge() and bulk variants for the same delegate component.
+     *
+     * Primitives created from a delegate component are reset and released in this pool when their last shared reference
+     * is released (usually on removal), set \c delegatePool.capacity to 0 to disable pooling.
+     */
+    Q_PROPERTY( qan::DelegatePool* delegatePool READ getDelegatePool CONSTANT FINAL )
+    inline qan::DelegatePool*   getDelegatePool( ) noexcept { return _delegatePool.get(); }
+private:
+    //! Return an item acquired from delegate pool (made visible in container item), or created with createFromDelegate().
+    QQuickItem*         acquireFromDelegate( QQmlComponent* component );
+    //! Return an owning pointer on \c node that recycle it in delegate pool (or delete it if there is no pool) once released.
+    SharedNode          makeSharedNode( qan::Node* node, QQmlComponent* component );
+    //! Edge variant of makeSharedNode().
+    SharedEdge          makeSharedEdge( qan::Edge* edge, QQmlComponent* component );
+    //! Shared so that primitives released after the pool (ie while graph is destroyed) are deleted instead of recycled.
+    std::shared_ptr< qan::DelegatePool >    _delegatePool;
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Style Management *///--------------------------------------------
     //@{
 public:
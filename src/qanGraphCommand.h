@@ -0,0 +1,88 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanGraphCommand.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef qanGraphCommand_h
+#define qanGraphCommand_h
+
+// GTpo headers
+#include <GTpo>
+
+// QT headers
+#include <QtGlobal>
+#include <QString>
+
+namespace qan { // ::qan
+
+/*! \brief Compact graph mutation command, pushed from any thread and applied by qan::Graph in the GUI thread.
+ *
+ * Nodes and edges are referenced by caller defined 64 bits IDs (for example a database key or a parser
+ * index), qan::Graph maintain the mapping between caller IDs and the nodes and edges it creates.
+ *
+ * \code
+ *   // From a worker thread
+ *   graph->pushCommand( qan::GraphCommand::insertNode( 1, 10., 10., "n1" ) );
+ *   graph->pushCommand( qan::GraphCommand::insertNode( 2, 100., 10., "n2" ) );
+ *   graph->pushCommand( qan::GraphCommand::insertEdge( 42, 1, 2 ) );
+ *   graph->pushCommand( qan::GraphCommand::moveNode( 2, 100., 50. ) );
+ * \endcode
+ * \sa qan::Graph::pushCommand()
+ */
+struct GraphCommand
+{
+    enum class Type : quint8 {
+        Undefined,
+        InsertNode,     //!< Insert a default node with ID \c id at (\c x, \c y) with an optional \c label.
+        RemoveNode,     //!< Remove node \c id.
+        MoveNode,       //!< Move node \c id to (\c x, \c y).
+        InsertEdge,     //!< Insert a default edge with ID \c id between nodes \c source and \c destination.
+        RemoveEdge      //!< Remove edge \c id.
+    };
+
+    Type        type{ Type::Undefined };
+    quint64     id{ 0 };
+    quint64     source{ 0 };
+    quint64     destination{ 0 };
+    qreal       x{ 0. };
+    qreal       y{ 0. };
+    QString     label{};
+
+    static inline GraphCommand  insertNode( quint64 id, qreal x, qreal y, const QString& label = QString{} ) {
+        return GraphCommand{ Type::InsertNode, id, 0, 0, x, y, label };
+    }
+    static inline GraphCommand  removeNode( quint64 id ) { return GraphCommand{ Type::RemoveNode, id, 0, 0, 0., 0., QString{} }; }
+    static inline GraphCommand  moveNode( quint64 id, qreal x, qreal y ) { return GraphCommand{ Type::MoveNode, id, 0, 0, x, y, QString{} }; }
+    static inline GraphCommand  insertEdge( quint64 id, quint64 source, quint64 destination ) {
+        return GraphCommand{ Type::InsertEdge, id, source, destination, 0., 0., QString{} };
+    }
+    static inline GraphCommand  removeEdge( quint64 id ) { return GraphCommand{ Type::RemoveEdge, id, 0, 0, 0., 0., QString{} }; }
+};
+
+//! Bounded lock-free queue of graph commands (multiple producers, qan::Graph is the single consumer).
+using GraphCommandQueue = gtpo::MpscQueue< qan::GraphCommand >;
+
+} // ::qan
+
+#endif // qanGraphCommand_h
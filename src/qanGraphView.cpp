@@ -51,6 +51,7 @@ void    GraphView::setGraph( qan::Graph* graph )
     }
     _graph = graph;
     _graph->setContainerItem( getContainerItem() );
+    updateGraphViewport();
     emit graphChanged();
 }
 
@@ -60,6 +61,25 @@ void    GraphView::navigableClicked(QPointF pos)
     if ( _graph != nullptr )
          _graph->clearSelection();
 }
+
+void    GraphView::navigableContainerItemModified()
+{
+    updateGraphViewport();
+}
+
+void    GraphView::geometryChanged( const QRectF& newGeometry, const QRectF& oldGeometry )
+{
+    qan::Navigable::geometryChanged( newGeometry, oldGeometry );
+    updateGraphViewport();
+}
+
+void    GraphView::updateGraphViewport()
+{
+    if ( _graph == nullptr ||
+         getContainerItem() == nullptr )
+        return;
+    _graph->setViewportRect( mapRectToItem( getContainerItem(), QRectF{ 0., 0., width(), height() } ) );
+}
 //-----------------------------------------------------------------------------
 
 } // ::qan
@@ -71,6 +71,12 @@ signals:
 protected:
     //! Called when the mouse is clicked in the container (base implementation empty).
     virtual void    navigableClicked(QPointF pos) override;
+    //! Called on pan and zoom, report new viewport to graph (see qan::Graph::virtualized).
+    virtual void    navigableContainerItemModified() override;
+    virtual void    geometryChanged( const QRectF& newGeometry, const QRectF& oldGeometry ) override;
+private:
+    //! Set graph viewport rect to this view bounding rect mapped in container item coordinates.
+    void            updateGraphViewport();
     //@}
     //-------------------------------------------------------------------------
 };
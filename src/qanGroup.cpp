@@ -120,13 +120,7 @@ auto    Group::removeNode( const qan::Node* node ) -> void
 
 bool    Group::hasNode( qan::Node* node ) const
 {
-    if ( node == nullptr )
-        return false;
-    WeakNode weakNode;
-    try {
-        weakNode = WeakNode{ node->shared_from_this() };
-    } catch ( std::bad_weak_ptr ) { return false; }
-    return gtpo::GenGroup< qan::Config >::hasNode( weakNode );
+    return gtpo::GenGroup< qan::Config >::hasNode( node );     // O(1) owner pointer lookup, nullptr return false
 }
 //-----------------------------------------------------------------------------
 
@@ -0,0 +1,285 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanIncubation.cpp
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QTimer>
+#include <QQmlEngine>
+#include <QDebug>
+
+// QuickQanava headers
+#include "./qanIncubation.h"
+#include "./qanGraph.h"
+#include "./qanNode.h"
+
+namespace qan { // ::qan
+
+/* IncubationController Object Management *///---------------------------------
+IncubationController::IncubationController( QObject* parent ) :
+    QObject{ parent }
+{
+}
+//-----------------------------------------------------------------------------
+
+/* Frame Scheduling *///-------------------------------------------------------
+void    IncubationController::setSliceDuration( int sliceDuration )
+{
+    if ( sliceDuration < 1 ) {
+        qDebug() << "qan::IncubationController::setSliceDuration(): Error: Slice duration must be at least 1ms.";
+        return;
+    }
+    if ( sliceDuration != _sliceDuration ) {
+        _sliceDuration = sliceDuration;
+        emit sliceDurationChanged();
+    }
+}
+
+void    IncubationController::setWindow( QQuickWindow* window )
+{
+    if ( window == _window )
+        return;
+    disconnect( _frameConnection );
+    _window = window;
+    _sliceRequested = false;
+    if ( _window )      // afterAnimating() is emitted in GUI thread once per frame, before scene graph synchronization
+        _frameConnection = connect( _window, &QQuickWindow::afterAnimating, this, [this]() {
+            if ( _sliceRequested )
+                runSlice();
+        } );
+    if ( incubatingObjectCount() > 0 )
+        requestSlice();
+}
+
+void    IncubationController::incubatingObjectCountChanged( int incubatingObjectCount )
+{
+    if ( incubatingObjectCount > 0 )
+        requestSlice();
+}
+
+void    IncubationController::runSlice( )
+{
+    _sliceRequested = false;
+    incubateFor( _sliceDuration );
+    if ( incubatingObjectCount() > 0 )
+        requestSlice();
+}
+
+void    IncubationController::requestSlice( )
+{
+    if ( _sliceRequested )
+        return;
+    _sliceRequested = true;
+    if ( _window )
+        _window->update();      // Schedule a new frame, incubation will be run on afterAnimating()
+    else
+        QTimer::singleShot( 0, this, [this]() {
+            if ( _sliceRequested )
+                runSlice();
+        } );
+}
+//-----------------------------------------------------------------------------
+
+/* Incubation Object Management *///-------------------------------------------
+//! Asynchronous incubator of a single node delegate, forward incubation events to its qan::Incubation.
+class Incubation::NodeIncubator : public QQmlIncubator
+{
+public:
+    NodeIncubator( Incubation& incubation, const QRectF& geometry, bool hasGeometry ) :
+        QQmlIncubator{ QQmlIncubator::Asynchronous },
+        geometry{ geometry }, hasGeometry{ hasGeometry },
+        _incubation( incubation ) { }
+    const QRectF        geometry;
+    const bool          hasGeometry;
+    //! Keep node alive while it is incubated, even if it is removed from graph meanwhile.
+    qan::Graph::SharedNode  node;
+protected:
+    virtual void        setInitialState( QObject* object ) override { _incubation.initialState( *this, object ); }
+    virtual void        statusChanged( Status status ) override { _incubation.statusChanged( *this, status ); }
+private:
+    Incubation&         _incubation;
+};
+
+Incubation::Incubation( qan::Graph& graph, QQmlComponent* component ) :
+    QObject{ &graph },
+    _graph( graph ),
+    _component{ component }
+{
+    QQmlEngine::setObjectOwnership( this, QQmlEngine::CppOwnership );
+}
+
+Incubation::~Incubation()
+{
+    // Incubators are ready (or have been aborted by graph), destroying them does not destroy their objects
+    _incubators.clear();
+}
+
+void    Incubation::start( int count, QQmlContext* context, const QVector< QRectF >& geometries )
+{
+    if ( _started )
+        return;
+    const int geometryOffset = _count;      // Geometries already used by add()
+    _count += qMax( 0, count );
+    _incubators.reserve( static_cast< std::size_t >( qMax( 0, count ) ) );
+    for ( int n = 0; n < count && _component; ++n ) {
+        const int g = geometryOffset + n;
+        const bool hasGeometry = g < geometries.size();
+        _incubators.emplace_back( std::make_unique< NodeIncubator >( *this, hasGeometry ? geometries.at( g ) : QRectF{}, hasGeometry ) );
+        _component->create( *_incubators.back(), context );
+    }
+    _started = true;
+    emit progressChanged();
+    checkFinished();        // Incubation might have been synchronous
+}
+
+void    Incubation::add( qan::Node* node )
+{
+    if ( node == nullptr || _started )
+        return;
+    _nodes.append( node );
+    ++_count;
+    ++_readyCount;
+}
+
+void    Incubation::abort( )
+{
+    _aborted = true;
+    for ( auto& incubator : _incubators )
+        if ( incubator->isLoading() )
+            incubator->forceCompletion();
+    for ( auto& incubator : _incubators )
+        incubator->node.reset();
+    _started = true;
+    checkFinished();
+}
+//-----------------------------------------------------------------------------
+
+/* Incubation Status *///------------------------------------------------------
+QVector< qan::Node* >   Incubation::getNodes( ) const
+{
+    QVector< qan::Node* > nodes;
+    nodes.reserve( _nodes.size() );
+    for ( const auto& node : _nodes )
+        if ( node && node->getGraph() == &_graph )
+            nodes.append( node.data() );
+    return nodes;
+}
+
+QVariantList    Incubation::getQmlNodes( ) const
+{
+    QVariantList nodes;
+    for ( const auto node : getNodes() )
+        nodes.append( QVariant::fromValue( node ) );
+    return nodes;
+}
+
+qan::Incubation*    Incubation::then( QJSValue onReady )
+{
+    if ( !onReady.isCallable() ) {
+        qDebug() << "qan::Incubation::then(): Error: Argument must be a JS function.";
+        return this;
+    }
+    _callbacks.append( onReady );
+    if ( _ready )
+        checkFinished();
+    return this;
+}
+
+void    Incubation::initialState( NodeIncubator& incubator, QObject* object )
+{
+    qan::Node* node = qobject_cast< qan::Node* >( object );
+    if ( node == nullptr ||         // Error is reported when incubation is ready
+         _component.isNull() )
+        return;
+    QQmlEngine::setObjectOwnership( node, QQmlEngine::CppOwnership );
+    if ( incubator.hasGeometry ) {  // Set geometry before bindings are evaluated
+        node->setX( incubator.geometry.x() );
+        node->setY( incubator.geometry.y() );
+        if ( incubator.geometry.width() > 0. )
+            node->setWidth( incubator.geometry.width() );
+        if ( incubator.geometry.height() > 0. )
+            node->setHeight( incubator.geometry.height() );
+    }
+    node->setIncubating( true );    // Kept hidden, even by graph virtualizer, until incubation is ready
+    node->setVisible( false );
+    incubator.node = _graph.insertDelegateNode( node, _component.data() );
+    _nodes.append( node );
+}
+
+void    Incubation::statusChanged( NodeIncubator& incubator, QQmlIncubator::Status status )
+{
+    if ( status == QQmlIncubator::Ready ) {
+        qan::Node* node = incubator.node.get();
+        if ( node == nullptr ) {
+            qDebug() << "qan::Incubation::statusChanged(): Error: Node delegate does not create a qan::Node.";
+            delete incubator.object();
+            ++_errorCount;
+        } else {
+            node->setIncubating( false );
+            if ( _graph.getVirtualizer() != nullptr )   // Visibility is driven by graph virtualizer
+                _graph.getVirtualizer()->nodeIncubated( node );
+            else
+                node->setVisible( true );
+            ++_readyCount;
+            if ( !_aborted )
+                emit nodeReady( node );
+        }
+    } else if ( status == QQmlIncubator::Error ) {
+        qDebug() << "qan::Incubation::statusChanged(): Error: Node delegate incubation failed:";
+        for ( const auto& error : incubator.errors() )
+            qDebug() << "\t" << error.toString();
+        ++_errorCount;
+    } else
+        return;
+    emit progressChanged();
+    checkFinished();
+}
+
+void    Incubation::checkFinished( )
+{
+    if ( !_started ||
+         _readyCount + _errorCount < _count )
+        return;
+    if ( !_ready ) {
+        _ready = true;
+        emit readyChanged();
+        if ( !_aborted )
+            emit finished( getQmlNodes() );
+        deleteLater();
+    }
+    if ( _aborted || _callbacks.isEmpty() )
+        return;
+    QJSEngine* engine = _component ? _component->engine() : qmlEngine( &_graph );
+    const auto callbacks = _callbacks;
+    _callbacks.clear();
+    for ( auto callback : callbacks ) {
+        const QJSValue result = callback.call( QJSValueList{ engine != nullptr ? engine->toScriptValue( getQmlNodes() ) : QJSValue{} } );
+        if ( result.isError() )
+            qDebug() << "qan::Incubation::checkFinished(): Error: then() callback failed: " << result.toString();
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,219 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanIncubation.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef qanIncubation_h
+#define qanIncubation_h
+
+// QT headers
+#include <QObject>
+#include <QPointer>
+#include <QVector>
+#include <QVariant>
+#include <QRectF>
+#include <QJSValue>
+#include <QQmlIncubator>
+#include <QQmlIncubationController>
+#include <QQmlComponent>
+#include <QQmlContext>
+#include <QQuickWindow>
+
+// STD headers
+#include <memory>
+#include <vector>
+
+namespace qan { // ::qan
+
+class Graph;
+class Node;
+
+/*! \brief QML incubation controller incubating objects in per frame time slices of a window.
+ *
+ * Incubation is run once per frame after QQuickWindow::afterAnimating() for at most \c sliceDuration milliseconds, and
+ * new frames are requested while objects are incubating. When no window is set, slices are run from the event loop
+ * with a zero timer.
+ *
+ * qan::Graph install its controller on its QML engine for asynchronous insertions when the engine does not already
+ * have an incubation controller (a QQuickView window controller is used otherwise).
+ * \nosubgrouping
+ */
+class IncubationController : public QObject,
+                             public QQmlIncubationController
+{
+    /*! \name IncubationController Object Management *///----------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit IncubationController( QObject* parent = nullptr );
+    virtual ~IncubationController() { }
+    IncubationController( const IncubationController& ) = delete;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Frame Scheduling *///--------------------------------------------
+    //@{
+public:
+    //! Maximum time spent incubating objects per frame in milliseconds (default to 5).
+    Q_PROPERTY( int sliceDuration READ getSliceDuration WRITE setSliceDuration NOTIFY sliceDurationChanged FINAL )
+    void                setSliceDuration( int sliceDuration );
+    inline int          getSliceDuration( ) const noexcept { return _sliceDuration; }
+signals:
+    void                sliceDurationChanged( );
+private:
+    int                 _sliceDuration{ 5 };
+
+public:
+    //! Window whose frames drive incubation (set automatically for qan::Graph controller).
+    void                setWindow( QQuickWindow* window );
+protected:
+    virtual void        incubatingObjectCountChanged( int incubatingObjectCount ) override;
+private:
+    void                runSlice( );
+    //! Request a new slice on next frame (or on next event loop iteration when there is no window).
+    void                requestSlice( );
+
+    QPointer< QQuickWindow >    _window;
+    QMetaObject::Connection     _frameConnection;
+    bool                        _sliceRequested{ false };
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+/*! \brief Promise like handle on an asynchronous node insertion (see qan::Graph::insertNodesAsync()).
+ *
+ * Node delegates are created with asynchronous QQmlIncubator: a node is inserted in graph topology as soon as its
+ * delegate root object has been created (before its bindings are evaluated and its children created), it stay hidden
+ * until incubation is complete, then nodeReady() is emitted. Once every delegate is ready (or has failed), \c ready is
+ * set, finished() is emitted and callbacks registered with then() are called with the inserted nodes.
+ *
+ * \code
+ *   graph.qmlInsertNodesAsync(1000, nodeDelegate).then(function(nodes) {
+ *       for (var n = 1; n < nodes.length; n++)
+ *           graph.insertEdge(nodes[n - 1], nodes[n])
+ *   })
+ * \endcode
+ *
+ * \note Incubation is owned by its graph and destroyed (with deleteLater()) once finished, clearing or destroying the
+ * graph abort pending incubations (see abort()). Incubating nodes stay hidden even when graph is virtualized, their
+ * visibility is then driven by the graph virtualizer once they are ready. Only node delegates are incubated: edges
+ * inserted from then() callbacks are created synchronously (prefer qan::Graph::insertEdges() for many edges).
+ * \nosubgrouping
+ */
+class Incubation : public QObject
+{
+    /*! \name Incubation Object Management *///--------------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit Incubation( qan::Graph& graph, QQmlComponent* component );
+    virtual ~Incubation();
+    Incubation( const Incubation& ) = delete;
+
+    /*! \brief Start asynchronous creation of \c count nodes in \c context.
+     *
+     * \c geometries (x, y, width, height) are set before node bindings are evaluated, they are applied in order to
+     * nodes created with add() then to incubated nodes.
+     */
+    void                start( int count, QQmlContext* context, const QVector< QRectF >& geometries );
+    //! Register an already created and inserted node (ie recycled from delegate pool), it is immediately ready.
+    void                add( qan::Node* node );
+    /*! \brief Complete pending incubations synchronously (used when graph is cleared or destroyed).
+     *
+     * Incubation is then ready, but neither finished() nor then() callbacks are notified.
+     */
+    void                abort( );
+private:
+    qan::Graph&                 _graph;
+    QPointer< QQmlComponent >   _component;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Incubation Status *///-------------------------------------------
+    //@{
+public:
+    //! Number of requested nodes.
+    Q_PROPERTY( int count READ getCount NOTIFY progressChanged FINAL )
+    inline int          getCount( ) const noexcept { return _count; }
+    //! Number of nodes with a complete delegate.
+    Q_PROPERTY( int readyCount READ getReadyCount NOTIFY progressChanged FINAL )
+    inline int          getReadyCount( ) const noexcept { return _readyCount; }
+    //! Number of nodes whose delegate creation failed.
+    Q_PROPERTY( int errorCount READ getErrorCount NOTIFY progressChanged FINAL )
+    inline int          getErrorCount( ) const noexcept { return _errorCount; }
+    //! Incubation progress between 0. and 1.
+    Q_PROPERTY( qreal progress READ getProgress NOTIFY progressChanged FINAL )
+    inline qreal        getProgress( ) const noexcept { return _count > 0 ? static_cast< qreal >( _readyCount + _errorCount ) / _count : 1.; }
+    //! True once every delegate is complete (or has failed).
+    Q_PROPERTY( bool ready READ isReady NOTIFY readyChanged FINAL )
+    inline bool         isReady( ) const noexcept { return _ready; }
+
+    //! Inserted nodes (including nodes not ready yet), removed nodes are omitted.
+    QVector< qan::Node* >   getNodes( ) const;
+    //! QML interface for getNodes().
+    Q_PROPERTY( QVariantList nodes READ getQmlNodes NOTIFY progressChanged FINAL )
+    QVariantList        getQmlNodes( ) const;
+
+    /*! \brief Call JS function \c onReady with a JS array of inserted nodes once every delegate is ready.
+     *
+     * \c onReady is called immediately if incubation is already finished, return this incubation.
+     */
+    Q_INVOKABLE qan::Incubation*    then( QJSValue onReady );
+signals:
+    void                progressChanged( );
+    void                readyChanged( );
+    //! Emitted when \c node delegate incubation is complete.
+    void                nodeReady( qan::Node* node );
+    //! Emitted once every delegate is ready (or has failed) with a list of inserted nodes.
+    void                finished( QVariantList nodes );
+
+private:
+    class NodeIncubator;
+    friend NodeIncubator;
+    //! Called by \c incubator when its root object has been created, insert node in graph topology.
+    void                initialState( NodeIncubator& incubator, QObject* object );
+    //! Called by \c incubator when its status change.
+    void                statusChanged( NodeIncubator& incubator, QQmlIncubator::Status status );
+    //! Set ready, emit finished() and call then() callbacks when there is no pending incubation.
+    void                checkFinished( );
+
+    std::vector< std::unique_ptr< NodeIncubator > > _incubators;
+    QVector< QPointer< qan::Node > >                _nodes;
+    QList< QJSValue >   _callbacks;
+    int                 _count{ 0 };
+    int                 _readyCount{ 0 };
+    int                 _errorCount{ 0 };
+    bool                _started{ false };
+    bool                _ready{ false };
+    bool                _aborted{ false };
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE( qan::Incubation )
+
+#endif // qanIncubation_h
@@ -0,0 +1,558 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLabelLayer.cpp
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#if QT_VERSION >= QT_VERSION_CHECK( 5, 8, 0 )
+#include <QSGRendererInterface>
+#endif
+#include <QSGSimpleTextureNode>
+#include <QSGTextureMaterial>
+#include <QFontMetricsF>
+#include <QPainter>
+
+// STD headers
+#include <cmath>        // std::ceil std::sqrt
+#include <algorithm>    // std::min std::max
+
+// QuickQanava headers
+#include "./qanLabelLayer.h"
+#include "./qanGraph.h"
+#include "./qanNode.h"
+#include "./qanEdge.h"
+#include "./qanStyle.h"
+#include "./qanFastNodeItem.h"
+
+namespace qan { // ::qan
+
+/* LabelLayer Object Management *///-------------------------------------------
+LabelLayer::LabelLayer( qan::Graph& graph, QQuickItem* parent ) :
+    QQuickItem{ parent },
+    gtpo::GraphBehaviour< qan::Config >{},
+    _graph( graph )
+{
+    setFlag( QQuickItem::ItemHasContents, true );
+    setZ( 1e6 );        // Draw labels over nodes and edges
+    connect( this, &QQuickItem::parentChanged, this, &LabelLayer::onParentChanged );
+    if ( parent != nullptr ) {
+        onParentChanged();
+        return;
+    }
+    setParentItem( graph.getContainerItem() );
+    connect( &graph, &qan::Graph::containerItemChanged, this, [this]() {
+        setParentItem( _graph.getContainerItem() );
+    } );
+}
+
+LabelLayer::~LabelLayer() { }     // Primitives connections are closed with this QObject
+
+void    LabelLayer::load()
+{
+    unload();
+    enable();
+    for ( const auto& node : _graph.getNodes() )
+        if ( qobject_cast< qan::FastNodeItem* >( node.get() ) != nullptr )
+            insertNode( node.get() );
+    const auto edgeRenderer = _graph.getEdgeRenderer();
+    if ( edgeRenderer != nullptr )
+        for ( const auto& edge : _graph.getEdges() )
+            if ( edgeRenderer->contains( edge.get() ) )
+                insertEdge( edge.get() );
+}
+
+void    LabelLayer::unload()
+{
+    disable();
+    clearLabels();
+}
+//-----------------------------------------------------------------------------
+
+/* Labels Management *///------------------------------------------------------
+void    LabelLayer::insertNode( qan::Node* node )
+{
+    if ( node == nullptr ||
+         _slots.find( node ) != _slots.cend() )
+        return;
+    auto fastNode = qobject_cast< qan::FastNodeItem* >( node );
+    if ( fastNode != nullptr )
+        fastNode->setDrawLabel( false );
+    insertSlot( node, node, nullptr );
+    connect( node, &qan::Node::labelChanged,    this, &LabelLayer::onLabelModified );
+    connect( node, &qan::Node::styleChanged,    this, &LabelLayer::onLabelModified );
+    connect( node, &QQuickItem::xChanged,       this, &LabelLayer::onLabelModified );
+    connect( node, &QQuickItem::yChanged,       this, &LabelLayer::onLabelModified );
+    connect( node, &QQuickItem::widthChanged,   this, &LabelLayer::onLabelModified );
+    connect( node, &QQuickItem::heightChanged,  this, &LabelLayer::onLabelModified );
+    connect( node, &QQuickItem::visibleChanged, this, &LabelLayer::onLabelModified );
+}
+
+void    LabelLayer::removeNode( qan::Node* node )
+{
+    if ( node == nullptr ||
+         _slots.find( node ) == _slots.cend() )
+        return;
+    removeSlot( node );
+    auto fastNode = qobject_cast< qan::FastNodeItem* >( node );
+    if ( fastNode != nullptr )
+        fastNode->setDrawLabel( true );
+}
+
+void    LabelLayer::insertEdge( qan::Edge* edge )
+{
+    if ( edge == nullptr ||
+         _slots.find( edge ) != _slots.cend() )
+        return;
+    insertSlot( edge, nullptr, edge );
+    connect( edge, &qan::Edge::labelChanged,    this, &LabelLayer::onLabelModified );
+    connect( edge, &qan::Edge::labelPosChanged, this, &LabelLayer::onLabelModified );     // Emitted when edge geometry change
+    connect( edge, &QQuickItem::visibleChanged, this, &LabelLayer::onLabelModified );
+}
+
+void    LabelLayer::removeEdge( qan::Edge* edge )
+{
+    if ( edge != nullptr )
+        removeSlot( edge );
+}
+
+void    LabelLayer::clearLabels( )
+{
+    for ( const auto& slot : _slots ) {
+        QObject::disconnect( slot.first, nullptr, this, nullptr );
+        auto fastNode = qobject_cast< qan::FastNodeItem* >( slot.first );
+        if ( fastNode != nullptr )
+            fastNode->setDrawLabel( true );
+    }
+    _slots.clear();
+    _slotItems.clear();
+    _freeSlots.clear();
+    _dirtySlots.clear();
+    _dirtyFlags.clear();
+    _quads.clear();
+    _reallocate = true;
+    update();
+}
+
+void    LabelLayer::insertSlot( QQuickItem* item, qan::Node* node, qan::Edge* edge )
+{
+    int slot = 0;
+    if ( !_freeSlots.empty() ) {
+        slot = _freeSlots.back();
+        _freeSlots.pop_back();
+        _slotItems[ slot ] = Slot{ node, edge };
+    } else {
+        slot = static_cast< int >( _slotItems.size() );
+        _slotItems.push_back( Slot{ node, edge } );
+        _dirtyFlags.push_back( 0 );
+        _quads.push_back( Quad{} );
+        _reallocate = true;
+    }
+    _slots.emplace( item, slot );
+    markDirty( slot );
+}
+
+void    LabelLayer::removeSlot( QQuickItem* item )
+{
+    const auto slot = _slots.find( item );
+    if ( slot == _slots.end() )
+        return;
+    QObject::disconnect( item, nullptr, this, nullptr );
+    _slotItems[ slot->second ] = Slot{};
+    _freeSlots.push_back( slot->second );
+    markDirty( slot->second );     // Clear slot quad
+    _slots.erase( slot );
+}
+
+void    LabelLayer::markDirty( int slot )
+{
+    if ( _dirtyFlags[ slot ] == 0 ) {
+        _dirtyFlags[ slot ] = 1;
+        _dirtySlots.push_back( slot );
+    }
+    update();
+}
+
+void    LabelLayer::nodeInserted( WeakNode& weakNode ) noexcept
+{
+    if ( !Behaviour::isEnabled() )
+        return;
+    auto fastNode = qobject_cast< qan::FastNodeItem* >( static_cast< qan::Node* >( weakNode.lock().get() ) );
+    if ( fastNode != nullptr )
+        insertNode( fastNode );
+}
+
+void    LabelLayer::nodeRemoved( WeakNode& weakNode ) noexcept
+{
+    if ( Behaviour::isEnabled() )
+        removeNode( static_cast< qan::Node* >( weakNode.lock().get() ) );
+}
+
+void    LabelLayer::edgeRemoved( WeakEdge& weakEdge ) noexcept
+{
+    if ( Behaviour::isEnabled() )
+        removeEdge( static_cast< qan::Edge* >( weakEdge.lock().get() ) );
+}
+
+void    LabelLayer::setMinimumPixelSize( qreal minimumPixelSize )
+{
+    _minimumPixelSize = minimumPixelSize;
+    invalidate();
+}
+
+void    LabelLayer::setViewport( const QRectF& viewport )
+{
+    const QRectF rect = parentItem() != nullptr && !viewport.isEmpty() ? mapRectFromItem( parentItem(), viewport ) : viewport;
+    if ( rect.isEmpty() ) {
+        if ( !_cullRect.isEmpty() ) {
+            _cullRect = QRectF{};
+            invalidate();
+        }
+        return;
+    }
+    if ( _cullRect.contains( rect ) )
+        return;         // Small pans do not rewrite labels
+    const qreal dx = rect.width() / 2.;
+    const qreal dy = rect.height() / 2.;
+    _cullRect = rect.adjusted( -dx, -dy, dx, dy );
+    invalidate();
+}
+
+void    LabelLayer::invalidate( )
+{
+    _rewrite = true;
+    update();
+}
+
+void    LabelLayer::onLabelModified( )
+{
+    const auto slot = _slots.find( qobject_cast< QQuickItem* >( sender() ) );
+    if ( slot != _slots.end() )
+        markDirty( slot->second );
+}
+
+void    LabelLayer::onParentChanged( )
+{
+    if ( _scaledParent )
+        QObject::disconnect( _scaledParent.data(), nullptr, this, nullptr );
+    _scaledParent = parentItem();
+    if ( _scaledParent )    // Note: Navigable zoom is applied on container item scale
+        connect( _scaledParent.data(), &QQuickItem::scaleChanged, this, &LabelLayer::invalidate );
+    invalidate();
+}
+//-----------------------------------------------------------------------------
+
+/* Glyph Atlas Management *///-------------------------------------------------
+const LabelLayer::Glyph*    LabelLayer::getGlyph( const QString& label, const QFont& font )
+{
+    const QString key = font.key() + QChar{ '\n' } + label;
+    const auto glyph = _glyphs.constFind( key );
+    if ( glyph != _glyphs.constEnd() )
+        return &glyph.value();
+
+    // Label is laid out once on a single line, then rasterized in current atlas shelf (or a new one)
+    const QFontMetricsF metrics{ font };
+    const QSizeF size{ metrics.width( label ), metrics.height() };
+    const int width = static_cast< int >( std::ceil( size.width() * rasterScale ) ) + 2;     // 1 pixel padding on each side
+    const int height = static_cast< int >( std::ceil( size.height() * rasterScale ) ) + 2;
+    if ( width > atlasSize || height > atlasSize )
+        return nullptr;
+    if ( _atlas.isNull() ) {
+        _atlas = QImage{ atlasSize, atlasSize, QImage::Format_ARGB32_Premultiplied };
+        _atlas.fill( Qt::transparent );
+    }
+    if ( _shelf.x() + width > atlasSize ) {     // Open a new shelf
+        _shelf = QPoint{ 0, _shelf.y() + _shelfHeight };
+        _shelfHeight = 0;
+    }
+    if ( _shelf.y() + height > atlasSize )
+        return nullptr;                         // Atlas is full
+    const QRect atlasRect{ _shelf, QSize{ width, height } };
+    {
+        QPainter painter{ &_atlas };
+        painter.setRenderHint( QPainter::TextAntialiasing );
+        painter.setPen( Qt::black );
+        painter.setFont( font );
+        painter.translate( atlasRect.topLeft() + QPoint{ 1, 1 } );
+        painter.scale( rasterScale, rasterScale );
+        painter.drawText( QPointF{ 0., metrics.ascent() }, label );
+    }
+    _shelf.rx() += width;
+    _shelfHeight = std::max( _shelfHeight, height );
+    _atlasModified = true;
+    return &_glyphs.insert( key, Glyph{ atlasRect, size } ).value();
+}
+
+qreal   LabelLayer::getFontHeight( const QFont& font )
+{
+    const QString key = font.key();
+    auto height = _fontHeights.constFind( key );
+    if ( height == _fontHeights.constEnd() )
+        height = _fontHeights.insert( key, QFontMetricsF{ font }.height() );
+    return height.value();
+}
+
+void    LabelLayer::clearAtlas( )
+{
+    _glyphs.clear();
+    if ( !_atlas.isNull() )
+        _atlas.fill( Qt::transparent );
+    _shelf = QPoint{ 0, 0 };
+    _shelfHeight = 0;
+    _atlasModified = true;
+}
+//-----------------------------------------------------------------------------
+
+/* Scene Graph Management *///-------------------------------------------------
+namespace { // ::anonymous
+
+//! Layer root node, own atlas texture shared by its children.
+class LabelLayerNode : public QSGNode
+{
+public:
+    explicit LabelLayerNode( bool software ) : QSGNode{}, software{ software } { }
+    virtual ~LabelLayerNode() { delete texture; }   // Children do not own texture
+    const bool          software;
+    QSGTexture*         texture{ nullptr };
+    QSGGeometryNode*    glyphs{ nullptr };  //!< Single quads batch (when not using software backend).
+    std::vector< QSGSimpleTextureNode* >    labels; //!< One texture node per slot (software backend only).
+};
+
+} // ::anonymous
+
+bool    LabelLayer::updateQuad( int slot )
+{
+    Quad& quad = _quads[ slot ];
+    quad = Quad{};
+    const Slot& item = _slotItems[ slot ];
+    const QQuickItem* parent = parentItem();
+    if ( item.node != nullptr ) {
+        qan::Node* node = item.node;
+        const QString& label = node->getLabel();
+        if ( label.isEmpty() || !node->isVisible() )
+            return true;
+        const QFont font = node->getStyle() != nullptr ? node->getStyle()->getLabelFont() : QFont{};
+        if ( getFontHeight( font ) * _scale < _minimumPixelSize )
+            return true;        // Culled: too small to be read
+        const QPointF position = node->parentItem() == parent ? node->position() : mapFromItem( node, QPointF{ 0., 0. } );
+        if ( !_cullRect.isEmpty() &&
+             !_cullRect.intersects( QRectF{ position, QSizeF{ node->width(), node->height() } } ) )
+            return true;        // Culled: outside of viewport, label is not rasterized
+        const Glyph* glyph = getGlyph( label, font );
+        if ( glyph == nullptr )
+            return false;
+        // Center label in node, clip it on node width
+        const QSizeF size{ std::min( glyph->size.width(), node->width() ), glyph->size.height() };
+        quad.rect = QRectF{ position + QPointF{ ( node->width() - size.width() ) / 2., ( node->height() - size.height() ) / 2. }, size };
+        quad.source = QRectF{ glyph->atlasRect.x() + 1., glyph->atlasRect.y() + 1.,     // Clipped glyph pixels, padding excluded
+                              size.width() * rasterScale, size.height() * rasterScale };
+    } else if ( item.edge != nullptr ) {
+        qan::Edge* edge = item.edge;
+        const QString& label = edge->getLabel();
+        const QFont font;
+        if ( label.isEmpty() || !edge->isVisible() ||
+             getFontHeight( font ) * _scale < _minimumPixelSize )
+            return true;
+        const bool sameParent = edge->parentItem() == parent;
+        const QRectF edgeRect = sameParent ? QRectF{ edge->position(), QSizeF{ edge->width(), edge->height() } } :
+                                             mapRectFromItem( edge, QRectF{ 0., 0., edge->width(), edge->height() } );
+        if ( !_cullRect.isEmpty() &&
+             !_cullRect.intersects( edgeRect ) )
+            return true;
+        const Glyph* glyph = getGlyph( label, font );
+        if ( glyph == nullptr )
+            return false;
+        const QPointF position = sameParent ? edge->position() + edge->getLabelPos() : mapFromItem( edge, edge->getLabelPos() );
+        quad.rect = QRectF{ position, glyph->size };
+        quad.source = QRectF{ glyph->atlasRect.x() + 1., glyph->atlasRect.y() + 1.,
+                              glyph->size.width() * rasterScale, glyph->size.height() * rasterScale };
+    }
+    return true;
+}
+
+void    LabelLayer::updateQuads( bool all )
+{
+    for ( int attempt = 0; attempt < 2; ++attempt ) {
+        bool full = false;
+        if ( all ) {
+            for ( int slot = 0; slot < static_cast< int >( _quads.size() ) && !full; ++slot )
+                full = !updateQuad( slot );
+        } else {
+            for ( std::size_t d = 0; d < _dirtySlots.size() && !full; ++d )
+                full = !updateQuad( _dirtySlots[ d ] );
+        }
+        if ( !full )
+            return;
+        clearAtlas();       // Atlas is full: drop labels no longer drawn and rasterize all labels again
+        all = true;
+        _rewrite = true;
+    }
+}
+
+QSGNode*    LabelLayer::updatePaintNode( QSGNode* oldNode, UpdatePaintNodeData* )
+{
+    // Note: Called from the render thread while GUI thread is blocked, labelled primitives could be read safely
+    auto root = static_cast< LabelLayerNode* >( oldNode );
+    if ( root == nullptr ) {
+        // Software adaptation (used for offscreen and headless rendering, explicitly or as a fallback when OpenGL is not
+        // available) does not draw custom geometry nodes
+        if ( window() == nullptr )
+            return nullptr;
+#if QT_VERSION >= QT_VERSION_CHECK( 5, 8, 0 )
+        const QSGRendererInterface* rendererInterface = window()->rendererInterface();
+        root = new LabelLayerNode{ rendererInterface != nullptr &&
+                                   rendererInterface->graphicsApi() == QSGRendererInterface::Software };
+#else
+        root = new LabelLayerNode{ false };     // Before Qt 5.8, OpenGL is the only scene graph backend
+#endif
+        _atlasModified = true;
+        _reallocate = true;
+    }
+
+    // On screen size of a layer unit (ie view zoom), layer usually has a translation and uniform scale
+    const QPointF origin = mapToScene( QPointF{ 0., 0. } );
+    const QPointF unit = mapToScene( QPointF{ 1., 0. } ) - origin;
+    const qreal scale = std::sqrt( unit.x() * unit.x() + unit.y() * unit.y() );
+    if ( !qFuzzyCompare( 1. + scale, 1. + _scale ) ) {
+        _scale = scale;
+        _rewrite = true;
+    }
+    const bool all = _rewrite || _reallocate;
+    if ( !all && _dirtySlots.empty() && !_atlasModified )
+        return root;
+    updateQuads( all );
+    const bool rewrite = _rewrite || _reallocate;      // Atlas may have been refilled by updateQuads()
+
+    if ( _atlasModified && !_atlas.isNull() ) {    // Upload atlas, previous texture is no longer referenced once children are updated
+        QSGTexture* texture = window()->createTextureFromImage( _atlas );
+        texture->setFiltering( QSGTexture::Linear );
+        if ( root->glyphs != nullptr )
+            static_cast< QSGTextureMaterial* >( root->glyphs->material() )->setTexture( texture );
+        for ( auto label : root->labels )
+            label->setTexture( texture );
+        delete root->texture;
+        root->texture = texture;
+        _atlasModified = false;
+    }
+    const auto clearDirty = [this]() {
+        for ( const auto slot : _dirtySlots )
+            _dirtyFlags[ slot ] = 0;
+        _dirtySlots.clear();
+        _rewrite = false;
+        _reallocate = false;
+    };
+    if ( root->texture == nullptr ) {  // Nothing has been rasterized, no label is drawn
+        clearDirty();
+        return root;
+    }
+
+    if ( root->software ) {     // One texture node per slot, all sharing atlas texture
+        while ( root->labels.size() > _quads.size() ) {    // Remove unused nodes
+            auto label = root->labels.back();
+            root->labels.pop_back();
+            root->removeChildNode( label );
+            delete label;
+        }
+        while ( root->labels.size() < _quads.size() ) {
+            auto label = new QSGSimpleTextureNode{};
+            label->setOwnsTexture( false );
+            label->setFiltering( QSGTexture::Linear );
+            label->setTexture( root->texture );
+            root->appendChildNode( label );
+            root->labels.push_back( label );
+        }
+        const auto writeLabel = [root, this]( int slot ) {
+            root->labels[ slot ]->setRect( _quads[ slot ].rect );
+            root->labels[ slot ]->setSourceRect( _quads[ slot ].source );
+        };
+        if ( rewrite ) {
+            for ( int slot = 0; slot < static_cast< int >( _quads.size() ); ++slot )
+                writeLabel( slot );
+        } else {
+            for ( const auto slot : _dirtySlots )
+                writeLabel( slot );
+        }
+        clearDirty();
+        return root;
+    }
+
+    if ( root->glyphs == nullptr ) {
+        root->glyphs = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{ QSGGeometry::defaultAttributes_TexturedPoint2D(), 0 };
+        geometry->setDrawingMode( QSGGeometry::DrawTriangles );
+        geometry->setVertexDataPattern( QSGGeometry::DynamicPattern );
+        root->glyphs->setGeometry( geometry );
+        root->glyphs->setFlag( QSGNode::OwnsGeometry );
+        auto material = new QSGTextureMaterial{};
+        material->setTexture( root->texture );
+        material->setFiltering( QSGTexture::Linear );
+        root->glyphs->setMaterial( material );
+        root->glyphs->setFlag( QSGNode::OwnsMaterial );
+        root->appendChildNode( root->glyphs );
+    }
+    QSGGeometry* geometry = root->glyphs->geometry();
+    const int vertexCount = static_cast< int >( _quads.size() ) * vertexCountPerLabel;
+    const bool reallocated = geometry->vertexCount() != vertexCount;
+    if ( reallocated )
+        geometry->allocate( vertexCount );
+    const QSizeF atlas{ static_cast< qreal >( _atlas.width() ), static_cast< qreal >( _atlas.height() ) };
+    auto vertices = geometry->vertexDataAsTexturedPoint2D();
+    const auto writeLabel = [this, vertices, atlas]( int slot ) {
+        const Quad& quad = _quads[ slot ];
+        auto v = vertices + slot * vertexCountPerLabel;
+        if ( quad.rect.isEmpty() ) {    // Degenerated triangles for free, hidden and culled slots
+            std::fill( v, v + vertexCountPerLabel, QSGGeometry::TexturedPoint2D{ 0.f, 0.f, 0.f, 0.f } );
+            return;
+        }
+        const auto x1 = static_cast< float >( quad.rect.left() );
+        const auto y1 = static_cast< float >( quad.rect.top() );
+        const auto x2 = static_cast< float >( quad.rect.right() );
+        const auto y2 = static_cast< float >( quad.rect.bottom() );
+        const auto u1 = static_cast< float >( quad.source.left() / atlas.width() );
+        const auto v1 = static_cast< float >( quad.source.top() / atlas.height() );
+        const auto u2 = static_cast< float >( quad.source.right() / atlas.width() );
+        const auto v2 = static_cast< float >( quad.source.bottom() / atlas.height() );
+        v[ 0 ].set( x1, y1, u1, v1 );
+        v[ 1 ].set( x2, y1, u2, v1 );
+        v[ 2 ].set( x1, y2, u1, v2 );
+        v[ 3 ].set( x1, y2, u1, v2 );
+        v[ 4 ].set( x2, y1, u2, v1 );
+        v[ 5 ].set( x2, y2, u2, v2 );
+    };
+    if ( rewrite || reallocated ) {
+        for ( int slot = 0; slot < static_cast< int >( _quads.size() ); ++slot )
+            writeLabel( slot );
+    } else {                    // Rewrite dirty slots in place
+        for ( const auto slot : _dirtySlots )
+            writeLabel( slot );
+    }
+    clearDirty();
+    root->glyphs->markDirty( QSGNode::DirtyGeometry | QSGNode::DirtyMaterial );
+    return root;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
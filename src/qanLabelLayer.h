@@ -0,0 +1,236 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLabelLayer.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef qanLabelLayer_h
+#define qanLabelLayer_h
+
+// QT headers
+#include <QQuickItem>
+#include <QPointer>
+#include <QImage>
+#include <QHash>
+#include <QFont>
+
+// STD headers
+#include <memory>         // std::weak_ptr
+#include <vector>
+#include <unordered_map>
+
+// GTpo headers
+#include "../GTpo/src/gtpoBehaviour.h"
+
+// QuickQanava headers
+#include "./qanConfig.h"
+
+namespace qan { // ::qan
+
+class Graph;
+class Node;
+class Edge;
+
+/*! \brief Graph behaviour drawing registered nodes and edges labels in a single scene graph batch.
+ *
+ * Used by qan::Graph when \c batchedLabels is set: labels of qan::FastNodeItem nodes (centered in node) and batched edges
+ * (centered on edge line) are drawn by this item, a child of graph container item, instead of one text item per primitive.
+ * Each distinct label string is laid out and rasterized once per font in a glyph atlas image shared by all labels, all
+ * visible labels are then drawn as textured quads sampling this atlas with a single geometry node and one draw call.
+ *
+ * Like qan::EdgeRenderer, each label owns a fixed quad slot: when a primitive label, geometry, style or visibility change, only its
+ * slot is rewritten on next scene graph synchronization. All slots are rewritten when zoom, culling rectangle or atlas change.
+ *
+ * Labels whose on screen height (font height multiplied by the layer scene scale, ie view zoom) is below \c minimumPixelSize are
+ * culled, as well as labels of hidden primitives (see qan::ViewportVirtualizer) and labels outside of graph viewport (see
+ * setViewport()). With the software scene graph backend (offscreen or headless rendering), where custom geometry is not supported,
+ * labels are drawn with one texture node each sharing the atlas texture.
+ *
+ * Layer is owned by its graph behaviours (see qan::Graph::setBatchedLabels()), it must not be deleted manually.
+ * \nosubgrouping
+ */
+class LabelLayer : public QQuickItem,
+                   public gtpo::GraphBehaviour< qan::Config >
+{
+    Q_OBJECT
+    /*! \name LabelLayer Object Management *///--------------------------------
+    //@{
+public:
+    //! Layer is a child of \c parent, or of \c graph container item (following its changes) when \c parent is nullptr.
+    explicit LabelLayer( qan::Graph& graph, QQuickItem* parent = nullptr );
+    virtual ~LabelLayer();
+    LabelLayer( const LabelLayer& ) = delete;
+
+    //! Note: Both QQuickItem and behaviour define isEnabled(), use Behaviour::isEnabled() for behaviour state.
+    using Behaviour = gtpo::GraphBehaviour< qan::Config >;
+    using WeakNode  = std::weak_ptr< qan::Config::Node >;
+    using WeakEdge  = std::weak_ptr< qan::Config::Edge >;
+
+    static constexpr gtpo::BehaviourEventMask   events = gtpo::BehaviourEvent::NodeInserted | gtpo::BehaviourEvent::NodeRemoved |
+                                                         gtpo::BehaviourEvent::EdgeRemoved;
+    virtual auto    getEvents() const noexcept -> gtpo::BehaviourEventMask override { return events; }
+public:
+    //! Register graph qan::FastNodeItem nodes and edges drawn by graph qan::EdgeRenderer, then enable layer.
+    void            load();
+    //! Stop drawing all labels and disable layer until load() is called.
+    void            unload();
+    //! Return true if layer is loaded (ie behaviour is enabled).
+    inline bool     isLoaded() const noexcept { return Behaviour::isEnabled(); }
+private:
+    qan::Graph&     _graph;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Labels Management *///-------------------------------------------
+    //@{
+public:
+    //! Draw \c node label with this layer (qan::FastNodeItem nodes stop drawing their own label).
+    void            insertNode( qan::Node* node );
+    void            removeNode( qan::Node* node );
+    //! Draw \c edge label with this layer.
+    void            insertEdge( qan::Edge* edge );
+    void            removeEdge( qan::Edge* edge );
+    //! Stop drawing all labels (qan::FastNodeItem nodes draw their own label again).
+    void            clearLabels( );
+
+    inline std::size_t  getLabelCount( ) const noexcept { return _slots.size(); }
+
+    //! Register inserted qan::FastNodeItem nodes.
+    virtual void    nodeInserted( WeakNode& weakNode ) noexcept override;
+    virtual void    nodeRemoved( WeakNode& weakNode ) noexcept override;
+    virtual void    edgeRemoved( WeakEdge& weakEdge ) noexcept override;
+
+public:
+    //! Labels with an on screen height below \c minimumPixelSize (in pixels) are not drawn, default to 5.
+    void            setMinimumPixelSize( qreal minimumPixelSize );
+    inline qreal    getMinimumPixelSize( ) const noexcept { return _minimumPixelSize; }
+private:
+    qreal           _minimumPixelSize{ 5. };
+
+public:
+    /*! \brief Set visible area in layer parent item coordinates, labels outside of it are not drawn (an empty viewport disable culling).
+     *
+     * Labels are culled against a rectangle twice as large as viewport, slots are rewritten only when viewport leave this rectangle.
+     */
+    void            setViewport( const QRectF& viewport );
+private:
+    QRectF          _cullRect;
+
+private slots:
+    //! Rewrite all labels on next update (called on zoom, minimum pixel size and culling changes).
+    void            invalidate( );
+    //! Connected to registered primitives label, geometry and visibility change notifications.
+    void            onLabelModified( );
+    //! Follow parent item (usually a navigable container) scale changes.
+    void            onParentChanged( );
+private:
+    //! Register \c item (either \c node or \c edge) label in a free slot.
+    void            insertSlot( QQuickItem* item, qan::Node* node, qan::Edge* edge );
+    void            removeSlot( QQuickItem* item );
+    //! Mark label \c slot for update on next scene graph synchronization.
+    void            markDirty( int slot );
+
+    //! Labelled primitive of a slot (both are nullptr for a free slot).
+    struct Slot {
+        qan::Node*  node{ nullptr };
+        qan::Edge*  edge{ nullptr };
+    };
+    std::unordered_map< QQuickItem*, int >  _slots;
+    std::vector< Slot >                     _slotItems;
+    std::vector< int >                      _freeSlots;
+    std::vector< int >                      _dirtySlots;
+    std::vector< char >                     _dirtyFlags;
+    //! Set when slot count has changed, the whole vertex buffer is then reallocated and rewritten.
+    bool                                    _reallocate{ true };
+    //! Set when all slots must be rewritten (zoom, culling rectangle or atlas change).
+    bool                                    _rewrite{ true };
+    QPointer< QQuickItem >                  _scaledParent;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Glyph Atlas Management *///--------------------------------------
+    //@{
+public:
+    //! Number of distinct (label, font) entries rasterized in glyph atlas.
+    inline int      getGlyphCount( ) const noexcept { return _glyphs.size(); }
+private:
+    //! Label layout cached in glyph atlas.
+    struct Glyph {
+        QRect       atlasRect;  //!< Label pixels in atlas image.
+        QSizeF      size;       //!< Label size in layer coordinates.
+    };
+    /*! \brief Return \c label glyph for \c font, laying it out and rasterizing it in atlas on first use.
+     *
+     * Return nullptr when atlas is full (it is then cleared on next update).
+     */
+    const Glyph*    getGlyph( const QString& label, const QFont& font );
+    //! Return cached \c font height in layer coordinates.
+    qreal           getFontHeight( const QFont& font );
+    void            clearAtlas( );
+
+    //! Atlas pixels per layer unit, labels keep readable up to a 2x zoom.
+    static constexpr qreal  rasterScale = 2.;
+    static constexpr int    atlasSize = 2048;
+
+    QHash< QString, Glyph > _glyphs;
+    QHash< QString, qreal > _fontHeights;
+    QImage                  _atlas;
+    //! Shelf packing: current shelf origin and height in atlas.
+    QPoint                  _shelf;
+    int                     _shelfHeight{ 0 };
+    bool                    _atlasModified{ false };
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Scene Graph Management *///--------------------------------------
+    //@{
+protected:
+    virtual QSGNode*    updatePaintNode( QSGNode* oldNode, UpdatePaintNodeData* ) override;
+public:
+    //! Number of vertices used to draw a label (two triangles).
+    static constexpr int    vertexCountPerLabel = 6;
+private:
+    //! Label quad in layer coordinates and its glyph pixels in atlas (empty \c rect when label is not drawn).
+    struct Quad {
+        QRectF          rect;
+        QRectF          source;
+    };
+    /*! \brief Update \c slot quad from its primitive, rasterizing its label in atlas if necessary.
+     *
+     * \return false if atlas is full.
+     */
+    bool                updateQuad( int slot );
+    //! Update quads of dirty slots (or of all slots), clear and refill atlas if it is full.
+    void                updateQuads( bool all );
+
+    std::vector< Quad > _quads;
+    //! Layer on screen scale (ie view zoom) used for last update.
+    qreal               _scale{ 0. };
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+#endif // qanLabelLayer_h
@@ -39,7 +39,7 @@ namespace qan { // ::qan
 /* Node Object Management *///-------------------------------------------------
 Node::Node( QQuickItem* parent ) :
     gtpo::GenNode< qan::Config >( parent ),
-    _defaultStyle{ new qan::NodeStyle{ "", QStringLiteral("qan::Node") } },
+    _defaultStyle{ qan::NodeStyle::getSharedDefault( QStringLiteral("qan::Node") ) },
     _style{ nullptr }
 {
     setAcceptDrops( true );
@@ -54,6 +54,34 @@ Node::Node( QQuickItem* parent ) :
 
 Node::~Node( ) { }
 
+bool    Node::resetForRecycling()
+{
+    if ( getSelected() ||       // Still referenced in graph selection
+         hasBehaviours() )      // Behaviours state can't be reset
+        return false;
+    setStyle( nullptr );        // Reset to shared default style
+    setLabel( QString{} );
+    setX( 0. );
+    setY( 0. );
+    setZ( 0. );
+    _incubating = false;
+    if ( _delegateSize.isValid() ) {   // Node could have been resized
+        setWidth( _delegateSize.width() );
+        setHeight( _delegateSize.height() );
+    } else {
+        resetWidth();
+        resetHeight();
+    }
+    resetTopology();
+    return true;
+}
+
+void    Node::componentComplete()
+{
+    gtpo::GenNode< qan::Config >::componentComplete();
+    _delegateSize = QSizeF{ width(), height() };
+}
+
 qan::Graph* Node::getGraph() noexcept
 {
     return qobject_cast< qan::Graph* >( gtpo::GenNode< qan::Config >::getGraph() );
@@ -99,12 +127,25 @@ void    Node::setSelectable( bool selectable )
     if ( getSelectionItem() != nullptr &&
          getSelectionItem()->isVisible() )
         getSelectionItem()->setVisible( false );
+    if ( !selectable )
+        releaseSelectionItem();
     _selectable = selectable;
     emit selectableChanged();
 }
 
 void    Node::setSelected( bool selected )
 {
+    if ( selected &&
+         isSelectable() &&
+         _selectionItem == nullptr ) {  // Lazily acquire a selection item from graph pool
+        qan::Graph* graph = getGraph();
+        QQuickItem* selectionItem = graph != nullptr ? graph->acquireSelectionItem( *this ) : nullptr;
+        if ( selectionItem != nullptr ) {
+            setSelectionItem( selectionItem );
+            _selectionItemPooled = true;
+        }
+    } else if ( !selected )
+        releaseSelectionItem();
     if ( getSelectionItem() != nullptr &&
          isSelectable() )
         getSelectionItem()->setVisible( selected );
@@ -120,7 +161,9 @@ void Node::setSelectionItem( QQuickItem* selectionItem )
         qDebug() << "qan::Node::setSelectionItem(): Error: Can't set a nullptr selection hilight item.";
         return;
     }
+    releaseSelectionItem();                 // Previous pooled item (if any) is no longer used
     _selectionItem.reset( selectionItem );
+    _selectionItemPooled = false;
     _selectionItem->setParentItem( this );  // Configure Quick item
     qan::Graph* graph = getGraph();
     if ( graph != nullptr )
@@ -129,6 +172,20 @@ void Node::setSelectionItem( QQuickItem* selectionItem )
     emit selectionItemChanged();
 }
 
+void    Node::releaseSelectionItem()
+{
+    if ( !_selectionItemPooled ||
+         _selectionItem == nullptr )
+        return;
+    _selectionItemPooled = false;
+    qan::Graph* graph = getGraph();
+    if ( graph != nullptr )
+        graph->releaseSelectionItem( _selectionItem.release() );
+    else
+        _selectionItem.reset();
+    emit selectionItemChanged();
+}
+
 void    Node::configureSelectionItem( QColor selectionColor, qreal selectionWeight, qreal selectionMargin )
 {
     if ( _selectionItem != nullptr ) {
@@ -377,20 +434,11 @@ void    Node::setStyle( NodeStyle* style )
         return;
     if ( style == nullptr )
         style = _defaultStyle.data();
-    if ( _style != nullptr &&
-         _style != _defaultStyle.data() )  // Every style that is non default is disconnect from this node
+    if ( _style != nullptr )    // Disconnect previous style (including shared default style) from this node
         QObject::disconnect( _style, 0, this, 0 );
-    _style = style;
-    connect( _style, &QObject::destroyed, this, &Node::styleDestroyed );    // Monitor eventual style destruction
+    _style = style;     // Note: Style destruction is handled in qan::StyleManager, see getStyle()
     emit styleChanged( );
 }
-
-void    Node::styleDestroyed( QObject* style )
-{
-    if ( style != nullptr &&
-         style != _defaultStyle.data() )
-        setStyle( _defaultStyle.data() );   // Set default style when current style is destroyed
-}
 //-----------------------------------------------------------------------------
 
 
@@ -70,6 +70,27 @@ public:
 public:
     inline auto         getClassName() const noexcept -> std::string { return getDynamicClassName(); }
     virtual std::string getDynamicClassName() const noexcept { return "qan::Node"; }
+
+    /*! \brief Reset this node once it has been removed from its graph so that it could be reused (see qan::DelegatePool).
+     *
+     * Style is reset to default style, label and position are cleared, size is restored to the size node had when its
+     * delegate component was completed (or to its implicit size) and GTpo topology is reset.
+     * Return false if the node can't be recycled (it is still selected or has behaviours), it must then be destroyed.
+     */
+    virtual bool        resetForRecycling();
+protected:
+    //! Call base implementation and record delegate default size, restored by resetForRecycling().
+    virtual void        componentComplete() override;
+private:
+    //! Node size once its delegate has been completed, invalid for nodes not created from a QML component.
+    QSizeF              _delegateSize;
+public:
+    //! True while node delegate is being incubated (see qan::Incubation), node is then kept hidden.
+    inline bool         isIncubating( ) const noexcept { return _incubating; }
+    //! Used by qan::Incubation, do not call directly.
+    inline void         setIncubating( bool incubating ) noexcept { _incubating = incubating; }
+private:
+    bool                _incubating{ false };
 public:
     //! Shortcut to gtpo::GenNode<>::getGraph().
     qan::Graph*     getGraph() noexcept;
@@ -148,12 +169,18 @@ signals:
 public:
     /*! \brief Item used to hilight selection (usually a Rectangle quick item).
      *
+     * When no selection item has been set, a Rectangle is taken from graph selection items pool when node is selected
+     * and returned to the pool when it is deselected (selectionItem is then nullptr).
      */
     Q_PROPERTY( QQuickItem* selectionItem READ getSelectionItem WRITE setSelectionItem NOTIFY selectionItemChanged FINAL )
     inline QQuickItem*  getSelectionItem() { return _selectionItem.get(); }
     void                setSelectionItem( QQuickItem* selectionItem );
 private:
     std::unique_ptr< QQuickItem >  _selectionItem{ nullptr };
+    //! True when _selectionItem has been acquired from graph selection items pool and must be returned on deselection.
+    bool                _selectionItemPooled{ false };
+    //! Return a pooled selection item to graph selection items pool.
+    void                releaseSelectionItem();
 signals:
     void                selectionItemChanged();
 
@@ -272,20 +299,22 @@ signals:
     /*! \name Appearance Management *///---------------------------------------
     //@{
 private:
-    using SharedNodeStyle = QSharedPointer< qan::NodeStyle >;
+    using SharedNodeStyle = qan::NodeStyle::SharedNodeStyle;
+    //! Default style shared with all nodes (see qan::NodeStyle::getSharedDefault()), kept alive while this node exists.
     SharedNodeStyle _defaultStyle;
 public:
-    //! Node current style object (this property is never null, a default style is returned when no style has been manually set).
+    /*! \brief Node current style object (this property is never null, a default style is returned when no style has been manually set).
+     *
+     * Node does not monitor its style destruction: qan::StyleManager reset graph nodes style before removing a style, and
+     * the shared default style is returned if style is destroyed elsewhere (styleChanged() is then not emitted).
+     */
     Q_PROPERTY( qan::NodeStyle* style READ getStyle WRITE setStyle NOTIFY styleChanged FINAL )
     void            setStyle( NodeStyle* style );
-    qan::NodeStyle* getStyle( ) const { return _style.data(); }
+    qan::NodeStyle* getStyle( ) const { return _style ? _style.data() : _defaultStyle.data(); }
 private:
     QPointer<qan::NodeStyle>    _style;
 signals:
     void            styleChanged( );
-private slots:
-    //! Called when the style associed to this node is destroyed.
-    void            styleDestroyed( QObject* style );
 
 public:
     Q_PROPERTY( QString label READ getLabel WRITE setLabel NOTIFY labelChanged FINAL )
@@ -145,6 +145,8 @@ void    ProtoSerializer::loadGraphFrom( QString fileName, qan::Graph* graph, qan
         return;
     }
 
+    cancelAsyncLoad();
+
     QUrl url( fileName );
     if ( url.isValid() )
         fileName = url.toLocalFile();
@@ -172,6 +174,62 @@ void    ProtoSerializer::loadGraphFrom( QString fileName, qan::Graph* graph, qan
         is.close();
 }
 
+int     ProtoSerializer::loadGraphFromAsync( QString fileName, qan::Graph* graph, qan::ProgressNotifier* progress )
+{
+    if ( fileName.isEmpty() ) {
+        qDebug() << "qan::ProtoSerializer::loadGraphFromAsync(): Error: file name is invalid.";
+        return -1;
+    }
+    if ( graph == nullptr ) {
+        qDebug() << "qan::ProtoSerializer::loadGraphFromAsync(" << fileName << "): Error: graph is nullptr.";
+        return -1;
+    }
+    QUrl url( fileName );
+    if ( url.isValid() )
+        fileName = url.toLocalFile();
+
+    std::ifstream is( fileName.toStdString(), std::ios::in | std::ios::binary );
+    if ( !is ) {
+        std::cerr << "qan::ProtoSerializer::loadGraphFromAsync(): Error: Can't open input stream " << fileName.toStdString() << std::endl;
+        return -1;
+    }
+    auto pbGraph = std::make_shared< qan::pb::Graph >();
+    if ( !pbGraph->ParseFromIstream( &is ) ) {  // Parsing is fast compared to Qt Quick items creation, it is done synchronously
+        std::cerr << "qan::ProtoSerializer::loadGraphFromAsync(): Error: Protocol Buffer QAN graph in serialization fails." << std::endl;
+        return -1;
+    }
+    is.close();
+    cancelAsyncLoad();
+
+    // Each job resolve ids with its own cursor id map: graph could be modified (or another file loaded) between slices
+    using InCursor = gtpo::ProtoSerializer< qan::Config >::InCursor;
+    auto cursor = std::make_shared< InCursor >();
+    QPointer< ProtoSerializer > serializer{ this };
+    QPointer< qan::Graph > target{ graph };
+    _asyncLoadGraph = graph;
+    _asyncLoadJob = graph->getScheduler()->schedule( [serializer, target, pbGraph, cursor]() -> double {
+        if ( !serializer || !target )
+            return 1.;
+        if ( !serializer->_gtpoSerializer.serializeInSome( pbGraph->graph(), *target, *cursor, 8 ) )
+            return cursor->getProgress( pbGraph->graph() );
+        serializer->_asyncLoadGraph = nullptr;
+        serializer->_asyncLoadJob = -1;
+        qan::StyleManager* styleManager = target->getStyleManager();
+        if ( styleManager != nullptr )      // Style manager must be serialized _after_ topology (it use topology object id map)
+            serializer->serializeStyleManagerIn( pbGraph->style_manager(), *styleManager, cursor->idObjectMap );
+        return 1.;
+    }, QStringLiteral( "Loading graph" ), progress );
+    return _asyncLoadJob;
+}
+
+void    ProtoSerializer::cancelAsyncLoad( )
+{
+    if ( _asyncLoadGraph && _asyncLoadJob >= 0 )
+        _asyncLoadGraph->getScheduler()->cancel( _asyncLoadJob );     // No-op if job has already been canceled by scheduler
+    _asyncLoadGraph = nullptr;
+    _asyncLoadJob = -1;
+}
+
 auto    ProtoSerializer::serializeIn( const qan::pb::Graph& pbGraph,
                                       qan::Graph& graph,
                                       gtpo::IProgressNotifier& progress ) -> void
@@ -184,7 +242,7 @@ auto    ProtoSerializer::serializeIn( const qan::pb::Graph& pbGraph,
             return;
         }
         _gtpoSerializer.serializeIn( pbGraph.graph(), graph, progress );
-        serializeStyleManagerIn( pbGraph.style_manager(), *styleManager );  // Note 20160404: Warning, gtpoSerializer.serializeIn() clear the objectIdMap, style manager should be serialized _after_ topology
+        serializeStyleManagerIn( pbGraph.style_manager(), *styleManager, _gtpoSerializer.getIdObjectMap() );  // Note 20160404: Warning, gtpoSerializer.serializeIn() clear the objectIdMap, style manager should be serialized _after_ topology
     } catch ( ... ) { std::cerr << "qan::ProtoSerializer::serializeIn(): Error while serializing in graph." << std::endl; }
     progress.endProgress();
 }
@@ -287,9 +345,9 @@ auto    ProtoSerializer::serializeStyleManagerOut( const qan::Graph& graph,
 }
 
 auto    ProtoSerializer::serializeStyleManagerIn( const qan::pb::StyleManager& pbStyleManager,
-                                                  qan::StyleManager& styleManager ) -> void
+                                                  qan::StyleManager& styleManager,
+                                                  IdObjectMap& idObjectMap ) -> void
 {
-    IdObjectMap& idObjectMap = _gtpoSerializer.getIdObjectMap();
     for ( auto pbStyle : pbStyleManager.styles() ) {
         qan::Style* style = nullptr;
         std::string styleName = pbStyle.name();
@@ -121,8 +121,22 @@ public:
 public:
     //! Serialize graph \c graph to file \c fileName (fileName could a be a file:// URL).
     Q_INVOKABLE void    saveGraphTo( qan::Graph* graph, QString fileName, qan::ProgressNotifier* progress = nullptr );
-    //! Serialize graph \c graph from file \c fileName (fileName could a be a file:// URL).
+    //! Serialize graph \c graph from file \c fileName (fileName could a be a file:// URL), cancel any running loadGraphFromAsync() job.
     Q_INVOKABLE void    loadGraphFrom( QString fileName, qan::Graph* graph, qan::ProgressNotifier* progress = nullptr );
+    /*! \brief Asynchronous variant of loadGraphFrom(): file is parsed immediately, graph primitives are created in per frame time slices.
+     *
+     * Loading is scheduled on \c graph qan::Graph::scheduler, serializer must stay alive until loading job is finished. Graph
+     * stay interactive during loading: primitives removed before loading end are skipped when resolving references to them.
+     * A running loading job started with this serializer is canceled (one load at a time per serializer).
+     * \return scheduled job ID (see qan::WorkScheduler::jobFinished()), or -1 if \c fileName could not be parsed.
+     */
+    Q_INVOKABLE int     loadGraphFromAsync( QString fileName, qan::Graph* graph, qan::ProgressNotifier* progress = nullptr );
+private:
+    //! Cancel running loadGraphFromAsync() job, if any.
+    void                cancelAsyncLoad( );
+    QPointer< qan::Graph >  _asyncLoadGraph;
+    int                 _asyncLoadJob{ -1 };
+public:
 
     //! Low level access to protocol buffer GTpoGraph message.
     auto    serializeOut( const qan::Graph& graph,
@@ -145,8 +159,10 @@ protected:
     auto serializeStyleManagerOut( const qan::Graph& graph,
                                    const qan::StyleManager& styleManager,
                                    qan::pb::StyleManager& pbStyleManager ) -> void;
+    //! Load style manager \c styleManager from \c pbStyleManager, \c idObjectMap is used to resolve styles nodes and edges ids.
     auto serializeStyleManagerIn( const qan::pb::StyleManager& pbStyleManager,
-                                  qan::StyleManager& styleManager  ) -> void;
+                                  qan::StyleManager& styleManager,
+                                  IdObjectMap& idObjectMap ) -> void;
     //@}
     //-------------------------------------------------------------------------
 
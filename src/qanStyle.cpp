@@ -27,6 +27,8 @@
 
 // QT headers
 #include <QFont>
+#include <QHash>
+#include <QDebug>
 
 // Qanava headers
 #include "./qanStyle.h"
@@ -63,6 +65,15 @@ Style* Style::duplicate( QString duplicatedStyleName, QObject* dstParent )
     }
     return dst;
 }
+
+bool    Style::isWritable( const char* property ) const
+{
+    if ( !_readOnly )
+        return true;
+    qWarning() << "qan::Style::isWritable(): Warning: Can't modify property" << property << "of shared default style for target"
+               << getTarget() << ", create a style with qan::StyleManager instead.";
+    return false;
+}
 //-----------------------------------------------------------------------------
 
 
@@ -71,6 +82,18 @@ NodeStyle::NodeStyle( QString name, QString target, QObject* parent ) :
     qan::Style( name, target, QStringLiteral("qan::Node"), parent )
 {
 }
+
+NodeStyle::SharedNodeStyle  NodeStyle::getSharedDefault( const QString& target )
+{
+    static QHash< QString, QWeakPointer< qan::NodeStyle > > defaultStyles;
+    SharedNodeStyle style = defaultStyles.value( target ).toStrongRef();
+    if ( !style ) {     // Not yet created or destroyed with the last node using it
+        style = SharedNodeStyle{ new qan::NodeStyle{ "", target } };
+        style->setReadOnly();
+        defaultStyles.insert( target, style.toWeakRef() );
+    }
+    return style;
+}
 //-----------------------------------------------------------------------------
 
 
@@ -79,6 +102,18 @@ EdgeStyle::EdgeStyle( QString name, QString target, QObject* parent ) :
     qan::Style( name, target, QStringLiteral("qan::Edge"), parent )
 {
 }
+
+EdgeStyle::SharedEdgeStyle  EdgeStyle::getSharedDefault( const QString& target )
+{
+    static QHash< QString, QWeakPointer< qan::EdgeStyle > > defaultStyles;
+    SharedEdgeStyle style = defaultStyles.value( target ).toStrongRef();
+    if ( !style ) {     // Not yet created or destroyed with the last edge using it
+        style = SharedEdgeStyle{ new qan::EdgeStyle{ "", target } };
+        style->setReadOnly();
+        defaultStyles.insert( target, style.toWeakRef() );
+    }
+    return style;
+}
 //-----------------------------------------------------------------------------
 
 } // ::qan
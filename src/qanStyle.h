@@ -34,6 +34,7 @@
 // QT headers
 #include <QColor>
 #include <QFont>
+#include <QSharedPointer>
 #include <QSizeF>
 
 namespace qan { // ::qan
@@ -126,6 +127,16 @@ public:
      * \param   dstParent optionnal parent for the duplicated style object.
      */
     qan::Style*     duplicate( QString duplicatedStyleName, QObject* dstParent = nullptr );
+
+public:
+    //! Return true if this style can't be modified (shared default styles, see qan::NodeStyle::getSharedDefault()).
+    inline bool     isReadOnly( ) const noexcept { return _readOnly; }
+protected:
+    inline void     setReadOnly( ) noexcept { _readOnly = true; }
+    //! Return false and print a warning when style is read only, called before modifying a property.
+    bool            isWritable( const char* property ) const;
+private:
+    bool            _readOnly{ false };
     //@}
     //-------------------------------------------------------------------------
 };
@@ -145,6 +156,16 @@ public:
     explicit NodeStyle( QString name = "", QString target = "", QObject* parent = nullptr );
     virtual ~NodeStyle( ) { }
     NodeStyle( const NodeStyle& ) = delete;
+
+    using SharedNodeStyle   = QSharedPointer< qan::NodeStyle >;
+    /*! \brief Return the default style shared by all nodes with \c target class name, style is created on first use.
+     *
+     * Shared default styles are reference counted and destroyed with the last node referencing them. They are read only
+     * (see qan::Style::isReadOnly()), property changes are ignored with a warning: use qan::StyleManager to create a
+     * customized style and set it on nodes.
+     * \note Must be called from GUI thread.
+     */
+    static SharedNodeStyle  getSharedDefault( const QString& target );
     //@}
     //-------------------------------------------------------------------------
 
@@ -152,7 +173,7 @@ public:
     //@{
 public:
     Q_PROPERTY( QColor backColor READ getBackColor WRITE setBackColor NOTIFY backColorChanged FINAL )
-    void            setBackColor( const QColor& backColor ) { _backColor = backColor; emit backColorChanged( ); }
+    void            setBackColor( const QColor& backColor ) { if ( !isWritable( "backColor" ) ) return; _backColor = backColor; emit backColorChanged( ); }
     const QColor&   getBackColor( ) const { return _backColor; }
 protected:
     QColor          _backColor = QColor( Qt::white );
@@ -161,7 +182,7 @@ signals:
 
 public:
     Q_PROPERTY( QColor borderColor READ getBorderColor WRITE setBorderColor NOTIFY borderColorChanged FINAL )
-    void            setBorderColor( const QColor& borderColor ) { _borderColor = borderColor; emit borderColorChanged( ); }
+    void            setBorderColor( const QColor& borderColor ) { if ( !isWritable( "borderColor" ) ) return; _borderColor = borderColor; emit borderColorChanged( ); }
     const QColor&   getBorderColor( ) const { return _borderColor; }
 protected:
     QColor          _borderColor = QColor( Qt::black );
@@ -170,7 +191,7 @@ signals:
 
 public:
     Q_PROPERTY( qreal borderWidth READ getBorderWidth WRITE setBorderWidth NOTIFY borderWidthChanged FINAL )
-    void            setBorderWidth( qreal borderWidth ) { _borderWidth = borderWidth; emit borderWidthChanged( ); }
+    void            setBorderWidth( qreal borderWidth ) { if ( !isWritable( "borderWidth" ) ) return; _borderWidth = borderWidth; emit borderWidthChanged( ); }
     qreal           getBorderWidth( ) const { return _borderWidth; }
 protected:
     qreal           _borderWidth = 1.0;
@@ -179,7 +200,7 @@ signals:
 
 public:
     Q_PROPERTY( QFont labelFont READ getLabelFont WRITE setLabelFont NOTIFY labelFontChanged FINAL )
-    void            setLabelFont( QFont labelFont ) { _labelFont = labelFont; emit labelFontChanged( ); }
+    void            setLabelFont( QFont labelFont ) { if ( !isWritable( "labelFont" ) ) return; _labelFont = labelFont; emit labelFontChanged( ); }
     QFont           getLabelFont( ) const { return _labelFont; }
 protected:
     QFont           _labelFont;
@@ -188,7 +209,7 @@ signals:
 
 public:
     Q_PROPERTY( bool hasShadow READ getHasShadow WRITE setHasShadow NOTIFY hasShadowChanged FINAL )
-    void            setHasShadow( bool hasShadow ) { _hasShadow = hasShadow; emit hasShadowChanged( ); }
+    void            setHasShadow( bool hasShadow ) { if ( !isWritable( "hasShadow" ) ) return; _hasShadow = hasShadow; emit hasShadowChanged( ); }
     bool            getHasShadow( ) const { return _hasShadow; }
 protected:
     bool            _hasShadow = true;
@@ -197,7 +218,7 @@ signals:
 
 public:
     Q_PROPERTY( QColor shadowColor READ getShadowColor WRITE setShadowColor NOTIFY shadowColorChanged FINAL )
-    void            setShadowColor( QColor shadowColor ) { _shadowColor = shadowColor; emit shadowColorChanged( ); }
+    void            setShadowColor( QColor shadowColor ) { if ( !isWritable( "shadowColor" ) ) return; _shadowColor = shadowColor; emit shadowColorChanged( ); }
     QColor          getShadowColor( ) const { return _shadowColor; }
 protected:
     QColor          _shadowColor = QColor{ 0, 0, 0, 127 };
@@ -206,7 +227,7 @@ signals:
 
 public:
     Q_PROPERTY( QSizeF shadowOffset READ getShadowOffset WRITE setShadowOffset NOTIFY shadowOffsetChanged FINAL )
-    void            setShadowOffset( QSizeF shadowOffset ) { _shadowOffset = shadowOffset; emit shadowOffsetChanged( ); }
+    void            setShadowOffset( QSizeF shadowOffset ) { if ( !isWritable( "shadowOffset" ) ) return; _shadowOffset = shadowOffset; emit shadowOffsetChanged( ); }
     QSizeF          getShadowOffset( ) const { return _shadowOffset; }
 protected:
     QSizeF          _shadowOffset = QSizeF{ 3., 3. };
@@ -231,6 +252,10 @@ public:
     explicit EdgeStyle( QString name = "", QString target = "", QObject* parent = nullptr );
     virtual ~EdgeStyle( ) { }
     EdgeStyle( const EdgeStyle& ) = delete;
+
+    using SharedEdgeStyle   = QSharedPointer< qan::EdgeStyle >;
+    //! Return the default style shared by all edges with \c target class name, see NodeStyle::getSharedDefault().
+    static SharedEdgeStyle  getSharedDefault( const QString& target );
     //@}
     //-------------------------------------------------------------------------
 
@@ -241,7 +266,7 @@ signals:
 
 public:
     Q_PROPERTY( QColor lineColor READ getLineColor WRITE setLineColor NOTIFY lineColorChanged FINAL )
-    void            setLineColor( const QColor& lineColor ) { _lineColor = lineColor; emit lineColorChanged( ); emit styleModified(); }
+    void            setLineColor( const QColor& lineColor ) { if ( !isWritable( "lineColor" ) ) return; _lineColor = lineColor; emit lineColorChanged( ); emit styleModified(); }
     const QColor&   getLineColor( ) const { return _lineColor; }
 protected:
     QColor          _lineColor = QColor( 0, 0, 0, 255 );
@@ -250,7 +275,7 @@ signals:
 
 public:
     Q_PROPERTY( qreal lineWidth READ getLineWidth WRITE setLineWidth NOTIFY lineWidthChanged FINAL )
-    void            setLineWidth( qreal lineWidth ) { _lineWidth = lineWidth; emit lineWidthChanged( ); emit styleModified();  }
+    void            setLineWidth( qreal lineWidth ) { if ( !isWritable( "lineWidth" ) ) return; _lineWidth = lineWidth; emit lineWidthChanged( ); emit styleModified();  }
     qreal           getLineWidth( ) const { return _lineWidth; }
 protected:
     qreal           _lineWidth = 2.0;
@@ -259,7 +284,7 @@ signals:
 
 public:
     Q_PROPERTY( qreal arrowSize READ getArrowSize WRITE setArrowSize NOTIFY arrowSizeChanged FINAL )
-    void        setArrowSize( qreal arrowSize ) { _arrowSize = arrowSize; emit arrowSizeChanged( ); emit styleModified();  }
+    void        setArrowSize( qreal arrowSize ) { if ( !isWritable( "arrowSize" ) ) return; _arrowSize = arrowSize; emit arrowSizeChanged( ); emit styleModified();  }
     qreal       getArrowSize( ) const { return _arrowSize; }
 protected:
     qreal       _arrowSize = 4.0;
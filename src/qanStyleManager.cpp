@@ -134,6 +134,10 @@ StyleManager::~StyleManager( )
 
 void    StyleManager::clear()
 {
+    QSet< qan::Style* > styles;
+    for ( const auto object : qAsConst(_styles) )
+        styles.insert( qobject_cast< qan::Style* >( object ) );
+    resetStyles( styles );
     _styles.clear( true );
     for ( const auto& model : _targetModelMap )
         delete model;
@@ -217,12 +221,31 @@ bool    StyleManager::removeStyle( QString styleName )
         return false;
     qan::Style* style = findStyleByName( styleName );
     if ( style != nullptr ) {
+        resetStyles( QSet< qan::Style* >{ style } );
         _styles.remove( style );
         return true;
     }
     return false;
 }
 
+void    StyleManager::resetStyles( const QSet< qan::Style* >& styles )
+{
+    // Nodes and edges do not monitor their style destruction (that would cost one connection per primitive): reset them
+    // to their default style in a single pass over graph primitives
+    const auto graph = qobject_cast< qan::Graph* >( parent() );
+    if ( graph == nullptr ||
+         styles.isEmpty() )
+        return;
+    for ( const auto& node : graph->getNodes() )
+        if ( node != nullptr &&
+             styles.contains( node->getStyle() ) )
+            node->setStyle( nullptr );
+    for ( const auto& edge : graph->getEdges() )
+        if ( edge != nullptr &&
+             styles.contains( edge->getStyle() ) )
+            edge->setStyle( nullptr );
+}
+
 Style*  StyleManager::findStyleByName( QString styleName ) const
 {
     if ( styleName.isEmpty( ) )
@@ -31,6 +31,7 @@
 // QT headers
 #include <QSortFilterProxyModel>
 #include <QQuickImageProvider>
+#include <QSet>
 
 // QuickContainers headers
 #include "../QuickContainers/src/qcmContainerModel.h"
@@ -143,9 +144,15 @@ public:
      */
     Q_INVOKABLE qan::Style* duplicateStyle( QString styleName, QString duplicatedStyleName );
     /*! \brief Remove an existing style from this manager and automatically delete it.
+     *
+     * Graph nodes and edges using the removed style are reset to their default style.
      *  \return true if the style was succesfully removed.
      */
     bool                    removeStyle( QString styleName );
+private:
+    //! Reset parent graph nodes and edges using one of \c styles to their default style (called before \c styles are dropped).
+    void                    resetStyles( const QSet< qan::Style* >& styles );
+public:
 
     //! Return a style with a given name, return \c nullptr if no such style exists.
     qan::Style*             findStyleByName( QString styleName ) const;
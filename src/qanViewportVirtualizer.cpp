@@ -0,0 +1,279 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanViewportVirtualizer.cpp
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QQuickItem>
+
+// STD headers
+#include <algorithm>  // std::max
+
+// QuickQanava headers
+#include "./qanViewportVirtualizer.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/* ViewportVirtualizer Object Management *///----------------------------------
+ViewportVirtualizer::ViewportVirtualizer( qan::Graph& graph, QObject* parent ) :
+    QObject{ parent },
+    gtpo::GraphBehaviour< qan::Config >{},
+    _graph( graph )
+{
+}
+
+ViewportVirtualizer::~ViewportVirtualizer() { }   // Geometry connections are closed with this QObject
+
+void    ViewportVirtualizer::load()
+{
+    unload();
+    enable();
+    for ( const auto& node : _graph.getNodes() )
+        insertNode( node.get() );
+    for ( const auto& edge : _graph.getEdges() )
+        updateEdge( edge.get() );
+}
+
+void    ViewportVirtualizer::unload()
+{
+    disable();
+    for ( const auto& node : _graph.getNodes() ) {
+        QObject::disconnect( node.get(), nullptr, this, nullptr );
+        if ( _nodes.contains( node.get() ) )
+            showNode( node.get(), true );
+    }
+    for ( const auto& edge : _graph.getEdges() )
+        if ( _edges.contains( edge.get() ) )
+            edge->setVisible( true );
+    _nodes.clear();
+    _edges.clear();
+    _visibleNodes.clear();
+    _visibleEdges.clear();
+}
+//-----------------------------------------------------------------------------
+
+/* Viewport Management *///----------------------------------------------------
+void    ViewportVirtualizer::setViewport( const QRectF& viewport )
+{
+    if ( viewport == _viewport )
+        return;
+    _viewport = viewport;
+    updateVisibility();
+}
+
+void    ViewportVirtualizer::setMargin( qreal margin )
+{
+    margin = std::max( 0., margin );
+    if ( qFuzzyCompare( 1. + margin, 1. + _margin ) )
+        return;
+    _margin = margin;
+    updateVisibility();
+}
+
+void    ViewportVirtualizer::updateVisibility()
+{
+    if ( !isEnabled() )
+        return;
+    std::unordered_set< qan::Node* > visibleNodes;
+    std::unordered_set< qan::Edge* > visibleEdges;
+    if ( _viewport.isEmpty() ) {   // No viewport, show everything
+        for ( const auto& node : _graph.getNodes() )
+            if ( _nodes.contains( node.get() ) )
+                visibleNodes.insert( node.get() );
+        for ( const auto& edge : _graph.getEdges() )
+            if ( _edges.contains( edge.get() ) )
+                visibleEdges.insert( edge.get() );
+    } else {
+        const QRectF r = getQueryRect();
+        _nodes.query( r.x(), r.y(), r.width(), r.height(), [&visibleNodes]( qan::Node* node ) { visibleNodes.insert( node ); } );
+        _edges.query( r.x(), r.y(), r.width(), r.height(), [&visibleEdges]( qan::Edge* edge ) { visibleEdges.insert( edge ); } );
+    }
+    // Apply visibility changes only: cost is O(visible primitives), not O(graph primitives)
+    for ( auto node : _visibleNodes )
+        if ( visibleNodes.find( node ) == visibleNodes.cend() )
+            showNode( node, false );
+    for ( auto node : visibleNodes )
+        if ( _visibleNodes.find( node ) == _visibleNodes.cend() )
+            showNode( node, true );
+    for ( auto edge : _visibleEdges )
+        if ( visibleEdges.find( edge ) == visibleEdges.cend() )
+            edge->setVisible( false );
+    for ( auto edge : visibleEdges )
+        if ( _visibleEdges.find( edge ) == _visibleEdges.cend() )
+            edge->setVisible( true );
+    _visibleNodes = std::move( visibleNodes );
+    _visibleEdges = std::move( visibleEdges );
+}
+//-----------------------------------------------------------------------------
+
+/* Primitives Indexing *///----------------------------------------------------
+void    ViewportVirtualizer::nodeInserted( WeakNode& weakNode ) noexcept
+{
+    if ( isEnabled() )
+        insertNode( weakNode.lock().get() );
+}
+
+void    ViewportVirtualizer::nodeRemoved( WeakNode& weakNode ) noexcept
+{
+    if ( isEnabled() )
+        removeNode( weakNode.lock().get() );
+}
+
+void    ViewportVirtualizer::edgeInserted( WeakEdge& weakEdge ) noexcept
+{
+    if ( isEnabled() )
+        updateEdge( weakEdge.lock().get() );
+}
+
+void    ViewportVirtualizer::edgeRemoved( WeakEdge& weakEdge ) noexcept
+{
+    if ( isEnabled() )
+        removeEdge( weakEdge.lock().get() );
+}
+
+bool    ViewportVirtualizer::isManaged( qan::Node* node ) const noexcept
+{
+    return node != nullptr &&
+           node->parentItem() != nullptr &&
+           node->parentItem() == _graph.getContainerItem();
+}
+
+bool    ViewportVirtualizer::isManaged( qan::Edge* edge ) const noexcept
+{
+    return edge != nullptr &&
+           isManaged( edge->getSourceItem() ) &&
+           isManaged( edge->getDestinationItem() );
+}
+
+void    ViewportVirtualizer::insertNode( qan::Node* node )
+{
+    if ( node == nullptr )
+        return;
+    const auto onGeometryChanged = [this, node]() { updateNode( node ); };
+    connect( node, &QQuickItem::xChanged, this, onGeometryChanged );
+    connect( node, &QQuickItem::yChanged, this, onGeometryChanged );
+    connect( node, &QQuickItem::widthChanged, this, onGeometryChanged );
+    connect( node, &QQuickItem::heightChanged, this, onGeometryChanged );
+    connect( node, &QQuickItem::parentChanged, this, onGeometryChanged );   // Node inserted in or removed from a group
+    if ( isManaged( node ) ) {
+        _nodes.insert( node, node->x(), node->y(), node->width(), node->height() );
+        setNodeVisible( node, _viewport.isEmpty() ||
+                              getQueryRect().intersects( QRectF{ node->x(), node->y(), node->width(), node->height() } ) );
+    }
+}
+
+void    ViewportVirtualizer::removeNode( qan::Node* node )
+{
+    if ( node == nullptr )
+        return;
+    QObject::disconnect( node, nullptr, this, nullptr );
+    _nodes.remove( node );
+    _visibleNodes.erase( node );
+}
+
+void    ViewportVirtualizer::updateNode( qan::Node* node )
+{
+    if ( !isEnabled() || node == nullptr )
+        return;
+    if ( isManaged( node ) ) {
+        const QRectF nodeRect{ node->x(), node->y(), node->width(), node->height() };
+        _nodes.insert( node, nodeRect.x(), nodeRect.y(), nodeRect.width(), nodeRect.height() );
+        setNodeVisible( node, _viewport.isEmpty() || getQueryRect().intersects( nodeRect ) );
+    } else if ( _nodes.remove( node ) ) {   // Node is no longer managed, restore its visibility
+        _visibleNodes.erase( node );
+        showNode( node, true );
+    }
+    for ( const auto& inEdge : node->getInEdges() )
+        updateEdge( static_cast< qan::Edge* >( inEdge.lock().get() ) );
+    for ( const auto& outEdge : node->getOutEdges() )
+        updateEdge( static_cast< qan::Edge* >( outEdge.lock().get() ) );
+}
+
+void    ViewportVirtualizer::updateEdge( qan::Edge* edge )
+{
+    if ( edge == nullptr )
+        return;
+    if ( !isManaged( edge ) ) {
+        if ( _edges.remove( edge ) ) {  // Edge is no longer managed, restore its visibility
+            _visibleEdges.erase( edge );
+            edge->setVisible( true );
+        }
+        return;
+    }
+    const qan::Node* source = edge->getSourceItem();
+    const qan::Node* destination = edge->getDestinationItem();
+    const QRectF edgeRect = QRectF{ source->x(), source->y(), source->width(), source->height() }.united(
+                            QRectF{ destination->x(), destination->y(), destination->width(), destination->height() } );
+    _edges.insert( edge, edgeRect.x(), edgeRect.y(), edgeRect.width(), edgeRect.height() );
+    setEdgeVisible( edge, _viewport.isEmpty() || getQueryRect().intersects( edgeRect ) );
+}
+
+void    ViewportVirtualizer::removeEdge( qan::Edge* edge )
+{
+    if ( edge == nullptr )
+        return;
+    _edges.remove( edge );
+    _visibleEdges.erase( edge );
+}
+
+void    ViewportVirtualizer::setNodeVisible( qan::Node* node, bool visible )
+{
+    if ( visible )
+        _visibleNodes.insert( node );
+    else
+        _visibleNodes.erase( node );
+    showNode( node, visible );
+}
+
+void    ViewportVirtualizer::showNode( qan::Node* node, bool visible )
+{
+    if ( !node->isIncubating() &&   // Incubating nodes are shown by nodeIncubated()
+         node->isVisible() != visible )
+        node->setVisible( visible );
+}
+
+void    ViewportVirtualizer::nodeIncubated( qan::Node* node )
+{
+    if ( node == nullptr )
+        return;
+    if ( !isEnabled() || !_nodes.contains( node ) )
+        node->setVisible( true );
+    else
+        showNode( node, _visibleNodes.find( node ) != _visibleNodes.cend() );
+}
+
+void    ViewportVirtualizer::setEdgeVisible( qan::Edge* edge, bool visible )
+{
+    if ( visible )
+        _visibleEdges.insert( edge );
+    else
+        _visibleEdges.erase( edge );
+    if ( edge->isVisible() != visible )
+        edge->setVisible( visible );
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,159 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanViewportVirtualizer.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef qanViewportVirtualizer_h
+#define qanViewportVirtualizer_h
+
+// QT headers
+#include <QObject>
+#include <QRectF>
+
+// STD headers
+#include <memory>         // std::weak_ptr
+#include <unordered_set>
+
+// GTpo headers
+#include "../GTpo/src/gtpoBehaviour.h"
+#include "../GTpo/src/gtpoSpatialGrid.h"
+
+// QuickQanava headers
+#include "./qanConfig.h"
+
+namespace qan { // ::qan
+
+class Graph;
+class Node;
+class Edge;
+
+/*! \brief Graph behaviour hiding nodes and edges outside of graph view viewport.
+ *
+ * Nodes and edges bounding boxes are kept in gtpo::SpatialGrid indexes updated on primitive insertion, removal and
+ * geometry changes. When the viewport change (pan, zoom or view resize), only primitives entering or leaving the
+ * viewport (expanded with \c margin on each side) have their visibility modified: hidden items are not synchronized
+ * with the scene graph and do not receive input events.
+ *
+ * Nodes inside groups and edges with a grouped or hyper edge endpoint are not managed (they keep their visibility). Nodes
+ * whose delegate is still incubating are indexed but stay hidden until nodeIncubated() is called.
+ * Virtualizer is owned by its graph behaviours (see qan::Graph::setVirtualized()), it must not be deleted manually.
+ *
+ * \nosubgrouping
+ */
+class ViewportVirtualizer : public QObject,
+                            public gtpo::GraphBehaviour< qan::Config >
+{
+    Q_OBJECT
+    /*! \name ViewportVirtualizer Object Management *///------------------------
+    //@{
+public:
+    explicit ViewportVirtualizer( qan::Graph& graph, QObject* parent = nullptr );
+    virtual ~ViewportVirtualizer();
+    ViewportVirtualizer( const ViewportVirtualizer& ) = delete;
+
+    using WeakNode  = std::weak_ptr< qan::Config::Node >;
+    using WeakEdge  = std::weak_ptr< qan::Config::Edge >;
+
+    static constexpr gtpo::BehaviourEventMask   events = gtpo::BehaviourEvent::NodeInserted | gtpo::BehaviourEvent::NodeRemoved |
+                                                         gtpo::BehaviourEvent::EdgeInserted | gtpo::BehaviourEvent::EdgeRemoved;
+    virtual auto    getEvents() const noexcept -> gtpo::BehaviourEventMask override { return events; }
+
+public:
+    //! Index all graph nodes and edges and apply current viewport.
+    void            load();
+    //! Show all hidden primitives and clear spatial indexes (virtualizer is then disabled until load() is called).
+    void            unload();
+private:
+    qan::Graph&     _graph;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Viewport Management *///-----------------------------------------
+    //@{
+public:
+    //! Set viewport rectangle in graph container item coordinates (an empty viewport show all primitives).
+    void            setViewport( const QRectF& viewport );
+    inline const QRectF&    getViewport() const noexcept { return _viewport; }
+
+    //! Set margin added around viewport before primitives are hidden (avoid popping primitives on small pans).
+    void            setMargin( qreal margin );
+    inline qreal    getMargin() const noexcept { return _margin; }
+
+    inline std::size_t  getVisibleNodeCount() const noexcept { return _visibleNodes.size(); }
+    inline std::size_t  getHiddenNodeCount() const noexcept { return _nodes.size() - _visibleNodes.size(); }
+    inline std::size_t  getVisibleEdgeCount() const noexcept { return _visibleEdges.size(); }
+    inline std::size_t  getHiddenEdgeCount() const noexcept { return _edges.size() - _visibleEdges.size(); }
+
+private:
+    //! Show primitives intersecting query rect and hide the others, only visibility changes are applied.
+    void            updateVisibility();
+    inline QRectF   getQueryRect() const noexcept { return _viewport.adjusted( -_margin, -_margin, _margin, _margin ); }
+
+    QRectF          _viewport;
+    qreal           _margin{ 200. };
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Primitives Indexing *///-----------------------------------------
+    //@{
+public:
+    virtual void    nodeInserted( WeakNode& weakNode ) noexcept override;
+    virtual void    nodeRemoved( WeakNode& weakNode ) noexcept override;
+    virtual void    edgeInserted( WeakEdge& weakEdge ) noexcept override;
+    virtual void    edgeRemoved( WeakEdge& weakEdge ) noexcept override;
+    //! Apply current viewport visibility to \c node once its delegate incubation is complete (see qan::Incubation).
+    void            nodeIncubated( qan::Node* node );
+
+private:
+    //! Return true if \c node is a direct child of graph container item (ie not in a group).
+    bool            isManaged( qan::Node* node ) const noexcept;
+    //! Return true if \c edge source and destination are managed nodes.
+    bool            isManaged( qan::Edge* edge ) const noexcept;
+
+    //! Start monitoring \c node geometry and index it.
+    void            insertNode( qan::Node* node );
+    void            removeNode( qan::Node* node );
+    //! Called when \c node geometry or parent change, update \c node and adjacent edges bounding boxes and visibility.
+    void            updateNode( qan::Node* node );
+    //! Index \c edge with its current bounding box (or remove it if it is no longer managed) and update its visibility.
+    void            updateEdge( qan::Edge* edge );
+    void            removeEdge( qan::Edge* edge );
+
+    void            setNodeVisible( qan::Node* node, bool visible );
+    //! Set \c node item visibility, unless it is incubating (it is then hidden until nodeIncubated() is called).
+    void            showNode( qan::Node* node, bool visible );
+    void            setEdgeVisible( qan::Edge* edge, bool visible );
+
+    gtpo::SpatialGrid< qan::Node* >     _nodes;
+    gtpo::SpatialGrid< qan::Edge* >     _edges;
+    std::unordered_set< qan::Node* >    _visibleNodes;
+    std::unordered_set< qan::Edge* >    _visibleEdges;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+#endif // qanViewportVirtualizer_h
@@ -0,0 +1,197 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanWorkScheduler.cpp
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QDebug>
+
+// QuickQanava headers
+#include "./qanWorkScheduler.h"
+
+namespace qan { // ::qan
+
+/* WorkScheduler Object Management *///----------------------------------------
+WorkScheduler::WorkScheduler( QObject* parent ) :
+    QObject{ parent }
+{
+}
+//-----------------------------------------------------------------------------
+
+/* Job Management *///---------------------------------------------------------
+int     WorkScheduler::schedule( Job job, const QString& label, qan::ProgressNotifier* progress )
+{
+    if ( !job ) {
+        qDebug() << "qan::WorkScheduler::schedule(): Error: Can't schedule an empty job.";
+        return -1;
+    }
+    const bool wasBusy = isBusy();
+    JobEntry entry;
+    entry.id = _nextJobId++;
+    entry.job = std::move( job );
+    entry.label = label;
+    entry.progress = progress;
+    _jobs.emplace_back( std::move( entry ) );
+    if ( !wasBusy )
+        emit busyChanged();
+    requestSlice();
+    return _jobs.back().id;
+}
+
+void    WorkScheduler::cancel( int jobId )
+{
+    for ( auto& entry : _jobs )
+        if ( entry.id == jobId )
+            entry.canceled = true;
+    if ( !_running )        // Otherwise canceled jobs are removed by runSlice()
+        runSlice( 0 );
+}
+
+void    WorkScheduler::cancelAll( )
+{
+    for ( auto& entry : _jobs )
+        entry.canceled = true;
+    if ( !_running )
+        runSlice( 0 );
+}
+
+void    WorkScheduler::popJob( bool finished )
+{
+    JobEntry entry{ std::move( _jobs.front() ) };
+    _jobs.pop_front();
+    if ( entry.progress && entry.started ) {
+        if ( finished )
+            entry.progress->setProgress( 1. );
+        entry.progress->endProgress();
+    }
+    if ( finished )
+        emit jobFinished( entry.id );
+    else
+        emit jobCanceled( entry.id );
+    if ( _jobs.empty() )
+        emit busyChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Frame Scheduling *///-------------------------------------------------------
+void    WorkScheduler::setSliceDuration( int sliceDuration )
+{
+    if ( sliceDuration < 1 ) {
+        qDebug() << "qan::WorkScheduler::setSliceDuration(): Error: Slice duration must be at least 1ms.";
+        return;
+    }
+    if ( sliceDuration != _sliceDuration ) {
+        _sliceDuration = sliceDuration;
+        emit sliceDurationChanged();
+    }
+}
+
+void    WorkScheduler::setWindow( QQuickWindow* window )
+{
+    if ( window == _window )
+        return;
+    disconnect( _frameConnection );
+    _window = window;
+    _sliceRequested = false;
+    if ( _window )      // afterAnimating() is emitted in GUI thread once per frame, before scene graph synchronization
+        _frameConnection = connect( _window, &QQuickWindow::afterAnimating, this, [this]() {
+            if ( _sliceRequested )
+                runSlice();
+        } );
+    if ( isBusy() )
+        requestSlice();
+}
+
+void    WorkScheduler::runSlice( int duration )
+{
+    if ( _running )     // Progress notifiers might process events, and re-enter runSlice()
+        return;
+    _running = true;
+    _sliceRequested = false;
+    if ( duration < 0 )
+        duration = _sliceDuration;
+    QElapsedTimer timer;
+    timer.start();
+    while ( !_jobs.empty() ) {
+        JobEntry& entry = _jobs.front();
+        if ( entry.canceled ||
+             ( entry.progress && entry.progress->isCanceled() ) ) {
+            popJob( false );
+            continue;
+        }
+        if ( timer.elapsed() >= duration )
+            break;
+        if ( !entry.started ) {
+            entry.started = true;
+            if ( entry.progress ) {
+                entry.progress->reset();
+                entry.progress->beginProgress( entry.label.toStdString() );
+            }
+        }
+        double progress = 0.;
+        try {
+            // Call the job until it is finished or slice is exhausted (job step is usually far shorter than a slice)
+            do {
+                progress = entry.job();
+            } while ( progress < 1. && timer.elapsed() < duration && !entry.canceled );
+        } catch ( const std::exception& e ) {
+            qDebug() << "qan::WorkScheduler::runSlice(): Error: Job " << entry.id << " has thrown: " << e.what();
+            entry.canceled = true;
+            continue;
+        } catch ( ... ) {
+            qDebug() << "qan::WorkScheduler::runSlice(): Error: Job " << entry.id << " has thrown an unknown exception.";
+            entry.canceled = true;
+            continue;
+        }
+        if ( progress >= 1. && !entry.canceled )
+            popJob( true );
+        else if ( entry.progress && !entry.canceled &&
+                  progress > entry.lastProgress ) {
+            entry.lastProgress = progress;
+            entry.progress->setProgress( progress );   // Notified once per slice, notifier might process events
+        }
+    }
+    _running = false;
+    if ( !_jobs.empty() )
+        requestSlice();
+}
+
+void    WorkScheduler::requestSlice( )
+{
+    if ( _sliceRequested )
+        return;
+    _sliceRequested = true;
+    if ( _window )
+        _window->update();      // Schedule a new frame, job will be run on afterAnimating()
+    else
+        QTimer::singleShot( 0, this, [this]() {
+            if ( _sliceRequested )
+                runSlice();
+        } );
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,161 @@
+/*
+    This file is part of QuickQanava library.
+
+    Copyright (C) 2008-2017 Benoit AUTHEMAN
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanWorkScheduler.h
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#ifndef qanWorkScheduler_h
+#define qanWorkScheduler_h
+
+// QT headers
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QQuickWindow>
+
+// STD headers
+#include <deque>
+#include <functional>
+
+// QuickQanava headers
+#include "./qanProgressNotifier.h"
+
+namespace qan { // ::qan
+
+/*! \brief Cooperative scheduler running long GUI thread jobs in per frame time slices.
+ *
+ * A job is a resumable functor: each call perform a small amount of work (for example creating a few nodes) and
+ * return the job progress between 0. and 1., job is finished when it return 1. (or more). Jobs are run in schedule
+ * order, once per frame after QQuickWindow::afterAnimating(), for at most \c sliceDuration milliseconds: a job is
+ * called repeatedly until its slice duration is exhausted, then the scheduler request a new frame and continue on
+ * next frame, keeping the view interactive while the job run.
+ *
+ * When no window is set, slices are run from the event loop with a zero timer.
+ *
+ * \code
+ *   auto nodes = std::make_shared< int >( 0 );
+ *   graph->getScheduler()->schedule( [graph, nodes]() -> double {
+ *       graph->insertNode();
+ *       return static_cast< double >( ++*nodes ) / 40000.;
+ *   }, "Inserting nodes" );
+ * \endcode
+ *
+ * \note Jobs run in GUI thread, they are never called from the scene graph render thread (they usually create or
+ * modify Qt Quick items, QQuickWindow::beforeSynchronizing() is emitted from the render thread with the threaded
+ * render loop and can not be used for that purpose).
+ * \nosubgrouping
+ */
+class WorkScheduler : public QObject
+{
+    /*! \name WorkScheduler Object Management *///-----------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit WorkScheduler( QObject* parent = nullptr );
+    virtual ~WorkScheduler() { }
+    WorkScheduler( const WorkScheduler& ) = delete;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Job Management *///----------------------------------------------
+    //@{
+public:
+    //! Resumable job step, return current job progress between 0. and 1. (job is finished when 1. is returned).
+    using Job = std::function< double() >;
+
+    /*! \brief Schedule \c job for execution after all currently scheduled jobs and return its ID.
+     *
+     * When \c progress is not nullptr, it is notified at most once per slice (beginProgress() when \c job start,
+     * setProgress(), endProgress() when it ends or is canceled), and canceling \c progress cancel \c job.
+     */
+    int                 schedule( Job job, const QString& label = QString{}, qan::ProgressNotifier* progress = nullptr );
+
+    //! Cancel scheduled or running job \c jobId (the job will not be called anymore, it could be partially done).
+    Q_INVOKABLE void    cancel( int jobId );
+    //! Cancel all scheduled jobs.
+    Q_INVOKABLE void    cancelAll( );
+
+    //! True while there is at least one scheduled job.
+    Q_PROPERTY( bool busy READ isBusy NOTIFY busyChanged FINAL )
+    inline bool         isBusy( ) const noexcept { return !_jobs.empty(); }
+    //! Number of scheduled jobs (including the running job).
+    Q_INVOKABLE int     getJobCount( ) const noexcept { return static_cast< int >( _jobs.size() ); }
+signals:
+    void                busyChanged( );
+    //! Emitted when job \c jobId has been completed.
+    void                jobFinished( int jobId );
+    //! Emitted when job \c jobId has been canceled (with cancel() or its progress notifier, or if it has thrown).
+    void                jobCanceled( int jobId );
+
+private:
+    struct JobEntry {
+        int                                 id{ 0 };
+        Job                                 job{};
+        QString                             label{};
+        QPointer< qan::ProgressNotifier >   progress{};
+        bool                                started{ false };
+        bool                                canceled{ false };
+        double                              lastProgress{ 0. };
+    };
+    //! Remove front job, notifying its progress and emitting \c jobFinished or \c jobCanceled.
+    void                popJob( bool finished );
+
+    std::deque< JobEntry >  _jobs;
+    int                     _nextJobId{ 1 };
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Frame Scheduling *///--------------------------------------------
+    //@{
+public:
+    //! Maximum time spent running jobs per frame in milliseconds (default to 8, ie half a 60 fps frame).
+    Q_PROPERTY( int sliceDuration READ getSliceDuration WRITE setSliceDuration NOTIFY sliceDurationChanged FINAL )
+    void                setSliceDuration( int sliceDuration );
+    inline int          getSliceDuration( ) const noexcept { return _sliceDuration; }
+signals:
+    void                sliceDurationChanged( );
+private:
+    int                 _sliceDuration{ 8 };
+
+public:
+    //! Window whose frames drive job execution (set automatically for qan::Graph scheduler).
+    void                setWindow( QQuickWindow* window );
+    //! Run scheduled jobs for at most \c duration milliseconds (negative \c duration use \c sliceDuration).
+    Q_INVOKABLE void    runSlice( int duration = -1 );
+private:
+    //! Request a new slice on next frame (or on next event loop iteration when there is no window).
+    void                requestSlice( );
+
+    QPointer< QQuickWindow >    _window;
+    QMetaObject::Connection     _frameConnection;
+    bool                        _running{ false };
+    bool                        _sliceRequested{ false };
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE( qan::WorkScheduler )
+
+#endif // qanWorkScheduler_h
@@ -51,9 +51,17 @@ HEADERS +=  $$PWD/QuickQanava.h             \
             $$PWD/qanBehaviour.h            \
             $$PWD/qanGroup.h                \
             $$PWD/qanGraph.h                \
+            $$PWD/qanGraphCommand.h         \
             $$PWD/qanLayout.h               \
             $$PWD/qanLinear.h               \
             $$PWD/qanProgressNotifier.h     \
+            $$PWD/qanWorkScheduler.h        \
+            $$PWD/qanViewportVirtualizer.h  \
+            $$PWD/qanDelegatePool.h         \
+            $$PWD/qanIncubation.h           \
+            $$PWD/qanEdgeRenderer.h         \
+            $$PWD/qanFastNodeItem.h         \
+            $$PWD/qanLabelLayer.h           \
             $$PWD/qanStyle.h                \
             $$PWD/qanStyleManager.h         \
             $$PWD/qanNavigable.h            \
@@ -69,6 +77,13 @@ SOURCES +=  $$PWD/qanGraphView.cpp          \
             $$PWD/qanLayout.cpp             \
             $$PWD/qanLinear.cpp             \
             $$PWD/qanProgressNotifier.cpp   \
+            $$PWD/qanWorkScheduler.cpp      \
+            $$PWD/qanViewportVirtualizer.cpp \
+            $$PWD/qanDelegatePool.cpp       \
+            $$PWD/qanIncubation.cpp         \
+            $$PWD/qanEdgeRenderer.cpp       \
+            $$PWD/qanFastNodeItem.cpp       \
+            $$PWD/qanLabelLayer.cpp         \
             $$PWD/qanStyle.cpp              \
             $$PWD/qanStyleManager.cpp       \
             $$PWD/qanNavigable.cpp          \